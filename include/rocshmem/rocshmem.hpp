@@ -94,6 +94,17 @@ __host__ void rocshmem_dump_stats();
  */
 __host__ void rocshmem_reset_stats();
 
+/**
+ * @brief Query symmetric heap usage and fragmentation of the calling PE.
+ *
+ * Rates are averaged since initialization or the last call to
+ * rocshmem_reset_stats. The high-water mark is also reset to the
+ * current usage by rocshmem_reset_stats.
+ *
+ * @param[out] stats Heap statistics.
+ */
+__host__ void rocshmem_heap_stats(rocshmem_heap_stats_t *stats);
+
 /**
  * @brief Finalize the rocSHMEM runtime.
  */
@@ -119,6 +130,44 @@ __host__ void *rocshmem_malloc(size_t size);
  */
 __host__ void rocshmem_free(void *ptr);
 
+/**
+ * @brief Allocate zero-initialized memory for an array of \p count
+ * elements of \p size bytes from the symmetric heap.
+ * This is a collective operation and must be called by all PEs.
+ *
+ * @param[in] count Number of elements.
+ * @param[in] size  Size in bytes of each element.
+ *
+ * @return A pointer to the allocated memory on the symmetric heap.
+ */
+__host__ void *rocshmem_calloc(size_t count, size_t size);
+
+/**
+ * @brief Allocate memory of \p size bytes from the symmetric heap with
+ * an address aligned to \p alignment bytes.
+ * This is a collective operation and must be called by all PEs.
+ *
+ * @param[in] alignment Power-of-two alignment in bytes.
+ * @param[in] size      Memory allocation size in bytes.
+ *
+ * @return A pointer to the allocated memory on the symmetric heap.
+ */
+__host__ void *rocshmem_align(size_t alignment, size_t size);
+
+/**
+ * @brief Change the size of a symmetric heap allocation to \p size bytes.
+ * The allocation is grown in place when possible; otherwise its contents
+ * are moved. This is a collective operation and must be called by all PEs.
+ *
+ * @param[in] ptr  Pointer to previously allocated memory on the symmetric
+ *                 heap (or NULL).
+ * @param[in] size New allocation size in bytes.
+ *
+ * @return A pointer to the resized memory on the symmetric heap. NULL is
+ * returned on failure and \p ptr remains valid.
+ */
+__host__ void *rocshmem_realloc(void *ptr, size_t size);
+
 /**
  * @brief Query for the number of PEs.
  *
@@ -136,7 +185,11 @@ __host__ int rocshmem_my_pe();
 /**
  * @brief Creates an OpenSHMEM context.
  *
- * @param[in] options Options for context creation. Ignored in current design.
+ * A context is used by one host thread at a time unless it is created with
+ * ROCSHMEM_CTX_SHARED. ROCSHMEM_HOST_CTX_DEFAULT is always shared.
+ * ROCSHMEM_CTX_AGGREGATE has no effect on a shared context.
+ *
+ * @param[in] options Options for context creation (ROCSHMEM_CTX_*).
  * @param[out] ctx    Context handle.
  *
  * @return Zero on success and nonzero otherwise.
@@ -252,6 +305,27 @@ __host__ void rocshmem_ctx_quiet(rocshmem_ctx_t ctx);
 
 __host__ void rocshmem_quiet();
 
+/**
+ * @brief Issues a batch of contiguous puts and gets described by \p ops.
+ *
+ * The batch is grouped by target PE and adjacent transfers are merged, so
+ * the operations of one batch are not ordered with respect to each other.
+ * On return every operation has completed locally, as with
+ * rocshmem_putmem and rocshmem_getmem: sources may be reused and fetched
+ * data is available. Call rocshmem_quiet() if remote completion of the puts
+ * is required.
+ *
+ * @param[in] ctx  Context with which to perform the operations.
+ * @param[in] ops  Array of \p nops descriptors.
+ * @param[in] nops Number of descriptors.
+ *
+ * @return void
+ */
+__host__ void rocshmem_ctx_batch(rocshmem_ctx_t ctx,
+                                 const rocshmem_batch_op_t *ops, size_t nops);
+
+__host__ void rocshmem_batch(const rocshmem_batch_op_t *ops, size_t nops);
+
 /**
  * @brief perform a collective barrier between all PEs in the system.
  * The caller is blocked until the barrier is resolved.
@@ -272,6 +346,41 @@ __host__ void rocshmem_barrier_all();
  */
 __host__ void rocshmem_sync_all();
 
+/**
+ * @brief Starts a collective barrier between all PEs in the system.
+ *
+ * Previously issued operations on the default host context are completed
+ * before the barrier starts. The caller returns immediately and completes
+ * the barrier with rocshmem_test or rocshmem_wait.
+ *
+ * @param[out] request Handle of the barrier.
+ *
+ * @return void
+ */
+__host__ void rocshmem_barrier_all_nbi(rocshmem_request_t *request);
+
+/**
+ * @brief Checks whether a non-blocking host collective has completed.
+ *
+ * On completion the handle is released and set to ROCSHMEM_REQUEST_NULL.
+ *
+ * @param[in, out] request Handle returned by a host *_nbi collective.
+ *
+ * @return 1 if the collective has completed, 0 otherwise.
+ */
+__host__ int rocshmem_test(rocshmem_request_t *request);
+
+/**
+ * @brief Blocks until a non-blocking host collective has completed.
+ *
+ * The handle is released and set to ROCSHMEM_REQUEST_NULL.
+ *
+ * @param[in, out] request Handle returned by a host *_nbi collective.
+ *
+ * @return void
+ */
+__host__ void rocshmem_wait(rocshmem_request_t *request);
+
 /**
  * @brief allows any PE to force the termination of an entire program.
  *
@@ -281,6 +390,26 @@ __host__ void rocshmem_sync_all();
  */
 __host__ void rocshmem_global_exit(int status);
 
+/**
+ * @brief Registers a host function which device threads can trigger with
+ * rocshmem_host_callback.
+ *
+ * Only the reverse offload backend has a host proxy to run callbacks.
+ * With ROCSHMEM_HOST_CALLBACK_HANDOFF the callback runs on a worker pool of
+ * ROCSHMEM_HOST_CALLBACK_THREADS threads (one by default) instead of the
+ * proxy thread.
+ *
+ * @param[in] fn        Host function to run.
+ * @param[in] user_data Passed unchanged to every invocation of fn.
+ * @param[in] flags     ROCSHMEM_HOST_CALLBACK_PROXY or
+ *                      ROCSHMEM_HOST_CALLBACK_HANDOFF.
+ *
+ * @return Callback id to pass to rocshmem_host_callback, or -1 if the
+ * backend cannot run host callbacks or the callback table is full.
+ */
+__host__ int rocshmem_register_host_callback(rocshmem_host_callback_t fn,
+                                             void *user_data, int flags);
+
 /******************************************************************************
  **************************** DEVICE INTERFACE ********************************
  *****************************************************************************/
@@ -540,6 +669,38 @@ __device__ ATTR_NO_INLINE void rocshmem_ctx_threadfence_system(
 
 __device__ ATTR_NO_INLINE void rocshmem_threadfence_system();
 
+/**
+ * @brief Runs a registered host callback from the device.
+ *
+ * The request travels through the reverse offload queue of the context and
+ * the caller returns as soon as it is queued. Operations issued earlier on
+ * the context have been submitted, but not necessarily completed, when the
+ * callback runs; call rocshmem_ctx_quiet first if it must observe them.
+ * Only the reverse offload backend supports host callbacks.
+ *
+ * Can be called per thread with no performance penalty.
+ *
+ * @param[in] ctx      Context with which to perform this operation.
+ * @param[in] id       Id returned by rocshmem_register_host_callback.
+ * @param[in] args     Arguments copied into the request.
+ * @param[in] nargs    Number of arguments, at most
+ *                     ROCSHMEM_HOST_CALLBACK_MAX_ARGS.
+ * @param[in] sig_addr Symmetric address of the calling PE set to signal
+ *                     once the callback has returned, or nullptr.
+ * @param[in] signal   Value stored at sig_addr.
+ *
+ * @return void
+ */
+__device__ ATTR_NO_INLINE void rocshmem_ctx_host_callback(
+    rocshmem_ctx_t ctx, int id, const uint64_t *args, int nargs,
+    uint64_t *sig_addr, uint64_t signal);
+
+__device__ ATTR_NO_INLINE void rocshmem_host_callback(int id,
+                                                      const uint64_t *args,
+                                                      int nargs,
+                                                      uint64_t *sig_addr,
+                                                      uint64_t signal);
+
 }  // namespace rocshmem
 
 #endif  // LIBRARY_INCLUDE_ROCSHMEM_HPP
@@ -44,54 +44,181 @@ namespace rocshmem {
 __device__ ATTR_NO_INLINE void rocshmem_ctx_float_wg_alltoall(
     rocshmem_ctx_t ctx, rocshmem_team_t team, float *dest,
     const float *source, int nelems);
+__host__ void rocshmem_ctx_float_alltoall(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, float *dest,
+    const float *source, int nelems);
 
 __device__ ATTR_NO_INLINE void rocshmem_ctx_double_wg_alltoall(
     rocshmem_ctx_t ctx, rocshmem_team_t team, double *dest,
     const double *source, int nelems);
+__host__ void rocshmem_ctx_double_alltoall(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, double *dest,
+    const double *source, int nelems);
 
 __device__ ATTR_NO_INLINE void rocshmem_ctx_char_wg_alltoall(
     rocshmem_ctx_t ctx, rocshmem_team_t team, char *dest,
     const char *source, int nelems);
+__host__ void rocshmem_ctx_char_alltoall(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, char *dest,
+    const char *source, int nelems);
 
 __device__ ATTR_NO_INLINE void rocshmem_ctx_schar_wg_alltoall(
     rocshmem_ctx_t ctx, rocshmem_team_t team, signed char *dest,
     const signed char *source, int nelems);
+__host__ void rocshmem_ctx_schar_alltoall(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, signed char *dest,
+    const signed char *source, int nelems);
 
 __device__ ATTR_NO_INLINE void rocshmem_ctx_short_wg_alltoall(
     rocshmem_ctx_t ctx, rocshmem_team_t team, short *dest,
     const short *source, int nelems);
+__host__ void rocshmem_ctx_short_alltoall(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, short *dest,
+    const short *source, int nelems);
 
 __device__ ATTR_NO_INLINE void rocshmem_ctx_int_wg_alltoall(
     rocshmem_ctx_t ctx, rocshmem_team_t team, int *dest,
     const int *source, int nelems);
+__host__ void rocshmem_ctx_int_alltoall(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, int *dest,
+    const int *source, int nelems);
 
 __device__ ATTR_NO_INLINE void rocshmem_ctx_long_wg_alltoall(
     rocshmem_ctx_t ctx, rocshmem_team_t team, long *dest,
     const long *source, int nelems);
+__host__ void rocshmem_ctx_long_alltoall(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, long *dest,
+    const long *source, int nelems);
 
 __device__ ATTR_NO_INLINE void rocshmem_ctx_longlong_wg_alltoall(
     rocshmem_ctx_t ctx, rocshmem_team_t team, long long *dest,
     const long long *source, int nelems);
+__host__ void rocshmem_ctx_longlong_alltoall(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, long long *dest,
+    const long long *source, int nelems);
 
 __device__ ATTR_NO_INLINE void rocshmem_ctx_uchar_wg_alltoall(
     rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned char *dest,
     const unsigned char *source, int nelems);
+__host__ void rocshmem_ctx_uchar_alltoall(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned char *dest,
+    const unsigned char *source, int nelems);
 
 __device__ ATTR_NO_INLINE void rocshmem_ctx_ushort_wg_alltoall(
     rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned short *dest,
     const unsigned short *source, int nelems);
+__host__ void rocshmem_ctx_ushort_alltoall(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned short *dest,
+    const unsigned short *source, int nelems);
 
 __device__ ATTR_NO_INLINE void rocshmem_ctx_uint_wg_alltoall(
     rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned int *dest,
     const unsigned int *source, int nelems);
+__host__ void rocshmem_ctx_uint_alltoall(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned int *dest,
+    const unsigned int *source, int nelems);
 
 __device__ ATTR_NO_INLINE void rocshmem_ctx_ulong_wg_alltoall(
     rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned long *dest,
     const unsigned long *source, int nelems);
+__host__ void rocshmem_ctx_ulong_alltoall(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned long *dest,
+    const unsigned long *source, int nelems);
 
 __device__ ATTR_NO_INLINE void rocshmem_ctx_ulonglong_wg_alltoall(
     rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned long long *dest,
     const unsigned long long *source, int nelems);
+__host__ void rocshmem_ctx_ulonglong_alltoall(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned long long *dest,
+    const unsigned long long *source, int nelems);
+
+
+/**
+ * @name SHMEM_ALLTOALLV
+ * @brief Exchanges a variable amount of contiguous data between all pairs
+ * of PEs participating in the collective routine. The caller is blocked
+ * until the exchange completes.
+ *
+ * Counts and displacements are in elements and are indexed by the PE number
+ * in the team. The counts must match pairwise: source_counts[j] on PE i
+ * equals dest_counts[i] on PE j.
+ *
+ * @param[in] team          The team participating in the collective.
+ * @param[in] dest          Destination address. Must be an address on the
+ *                          symmetric heap.
+ * @param[in] dest_counts   Number of elements received from each PE.
+ * @param[in] dest_displs   Offset in dest of the data received from each PE.
+ * @param[in] source        Source address. Must be an address on the
+ *                          symmetric heap.
+ * @param[in] source_counts Number of elements sent to each PE.
+ * @param[in] source_displs Offset in source of the data sent to each PE.
+ *
+ * @return void
+ */
+__host__ void rocshmem_ctx_float_alltoallv(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, float *dest,
+    const int *dest_counts, const int *dest_displs, const float *source,
+    const int *source_counts, const int *source_displs);
+
+__host__ void rocshmem_ctx_double_alltoallv(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, double *dest,
+    const int *dest_counts, const int *dest_displs, const double *source,
+    const int *source_counts, const int *source_displs);
+
+__host__ void rocshmem_ctx_char_alltoallv(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, char *dest,
+    const int *dest_counts, const int *dest_displs, const char *source,
+    const int *source_counts, const int *source_displs);
+
+__host__ void rocshmem_ctx_schar_alltoallv(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, signed char *dest,
+    const int *dest_counts, const int *dest_displs, const signed char *source,
+    const int *source_counts, const int *source_displs);
+
+__host__ void rocshmem_ctx_short_alltoallv(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, short *dest,
+    const int *dest_counts, const int *dest_displs, const short *source,
+    const int *source_counts, const int *source_displs);
+
+__host__ void rocshmem_ctx_int_alltoallv(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, int *dest,
+    const int *dest_counts, const int *dest_displs, const int *source,
+    const int *source_counts, const int *source_displs);
+
+__host__ void rocshmem_ctx_long_alltoallv(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, long *dest,
+    const int *dest_counts, const int *dest_displs, const long *source,
+    const int *source_counts, const int *source_displs);
+
+__host__ void rocshmem_ctx_longlong_alltoallv(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, long long *dest,
+    const int *dest_counts, const int *dest_displs, const long long *source,
+    const int *source_counts, const int *source_displs);
+
+__host__ void rocshmem_ctx_uchar_alltoallv(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned char *dest,
+    const int *dest_counts, const int *dest_displs, const unsigned char *source,
+    const int *source_counts, const int *source_displs);
+
+__host__ void rocshmem_ctx_ushort_alltoallv(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned short *dest,
+    const int *dest_counts, const int *dest_displs, const unsigned short *source,
+    const int *source_counts, const int *source_displs);
+
+__host__ void rocshmem_ctx_uint_alltoallv(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned int *dest,
+    const int *dest_counts, const int *dest_displs, const unsigned int *source,
+    const int *source_counts, const int *source_displs);
+
+__host__ void rocshmem_ctx_ulong_alltoallv(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned long *dest,
+    const int *dest_counts, const int *dest_displs, const unsigned long *source,
+    const int *source_counts, const int *source_displs);
+
+__host__ void rocshmem_ctx_ulonglong_alltoallv(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned long long *dest,
+    const int *dest_counts, const int *dest_displs, const unsigned long long *source,
+    const int *source_counts, const int *source_displs);
 
 
 /**
@@ -113,6 +240,9 @@ __device__ ATTR_NO_INLINE void rocshmem_ctx_ulonglong_wg_alltoall(
  * @param[in] PE_size      Number PEs participating in the reduction.
  * @param[in] pSync        Temporary sync buffer provided to ROCSHMEM. Must
                            be of size at least ROCSHMEM_REDUCE_SYNC_SIZE.
+ * @param[out] request     Handle of a host *_nbi broadcast. The caller
+                           returns immediately and completes the broadcast
+                           with rocshmem_test or rocshmem_wait.
  *
  * @return void
  */
@@ -126,6 +256,10 @@ __host__ void rocshmem_ctx_float_broadcast(
 __host__ void rocshmem_ctx_float_broadcast(
     rocshmem_ctx_t ctx, rocshmem_team_t team, float *dest,
     const float *source, int nelems, int pe_root);
+__host__ void rocshmem_ctx_float_broadcast_nbi(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, float *dest,
+    const float *source, int nelems, int pe_root,
+    rocshmem_request_t *request);
 
 __device__ ATTR_NO_INLINE void rocshmem_ctx_double_wg_broadcast(
     rocshmem_ctx_t ctx, rocshmem_team_t team, double *dest,
@@ -137,6 +271,10 @@ __host__ void rocshmem_ctx_double_broadcast(
 __host__ void rocshmem_ctx_double_broadcast(
     rocshmem_ctx_t ctx, rocshmem_team_t team, double *dest,
     const double *source, int nelems, int pe_root);
+__host__ void rocshmem_ctx_double_broadcast_nbi(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, double *dest,
+    const double *source, int nelems, int pe_root,
+    rocshmem_request_t *request);
 
 __device__ ATTR_NO_INLINE void rocshmem_ctx_char_wg_broadcast(
     rocshmem_ctx_t ctx, rocshmem_team_t team, char *dest,
@@ -148,6 +286,10 @@ __host__ void rocshmem_ctx_char_broadcast(
 __host__ void rocshmem_ctx_char_broadcast(
     rocshmem_ctx_t ctx, rocshmem_team_t team, char *dest,
     const char *source, int nelems, int pe_root);
+__host__ void rocshmem_ctx_char_broadcast_nbi(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, char *dest,
+    const char *source, int nelems, int pe_root,
+    rocshmem_request_t *request);
 
 __device__ ATTR_NO_INLINE void rocshmem_ctx_schar_wg_broadcast(
     rocshmem_ctx_t ctx, rocshmem_team_t team, signed char *dest,
@@ -159,6 +301,10 @@ __host__ void rocshmem_ctx_schar_broadcast(
 __host__ void rocshmem_ctx_schar_broadcast(
     rocshmem_ctx_t ctx, rocshmem_team_t team, signed char *dest,
     const signed char *source, int nelems, int pe_root);
+__host__ void rocshmem_ctx_schar_broadcast_nbi(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, signed char *dest,
+    const signed char *source, int nelems, int pe_root,
+    rocshmem_request_t *request);
 
 __device__ ATTR_NO_INLINE void rocshmem_ctx_short_wg_broadcast(
     rocshmem_ctx_t ctx, rocshmem_team_t team, short *dest,
@@ -170,6 +316,10 @@ __host__ void rocshmem_ctx_short_broadcast(
 __host__ void rocshmem_ctx_short_broadcast(
     rocshmem_ctx_t ctx, rocshmem_team_t team, short *dest,
     const short *source, int nelems, int pe_root);
+__host__ void rocshmem_ctx_short_broadcast_nbi(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, short *dest,
+    const short *source, int nelems, int pe_root,
+    rocshmem_request_t *request);
 
 __device__ ATTR_NO_INLINE void rocshmem_ctx_int_wg_broadcast(
     rocshmem_ctx_t ctx, rocshmem_team_t team, int *dest,
@@ -181,6 +331,10 @@ __host__ void rocshmem_ctx_int_broadcast(
 __host__ void rocshmem_ctx_int_broadcast(
     rocshmem_ctx_t ctx, rocshmem_team_t team, int *dest,
     const int *source, int nelems, int pe_root);
+__host__ void rocshmem_ctx_int_broadcast_nbi(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, int *dest,
+    const int *source, int nelems, int pe_root,
+    rocshmem_request_t *request);
 
 __device__ ATTR_NO_INLINE void rocshmem_ctx_long_wg_broadcast(
     rocshmem_ctx_t ctx, rocshmem_team_t team, long *dest,
@@ -192,6 +346,10 @@ __host__ void rocshmem_ctx_long_broadcast(
 __host__ void rocshmem_ctx_long_broadcast(
     rocshmem_ctx_t ctx, rocshmem_team_t team, long *dest,
     const long *source, int nelems, int pe_root);
+__host__ void rocshmem_ctx_long_broadcast_nbi(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, long *dest,
+    const long *source, int nelems, int pe_root,
+    rocshmem_request_t *request);
 
 __device__ ATTR_NO_INLINE void rocshmem_ctx_longlong_wg_broadcast(
     rocshmem_ctx_t ctx, rocshmem_team_t team, long long *dest,
@@ -203,6 +361,10 @@ __host__ void rocshmem_ctx_longlong_broadcast(
 __host__ void rocshmem_ctx_longlong_broadcast(
     rocshmem_ctx_t ctx, rocshmem_team_t team, long long *dest,
     const long long *source, int nelems, int pe_root);
+__host__ void rocshmem_ctx_longlong_broadcast_nbi(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, long long *dest,
+    const long long *source, int nelems, int pe_root,
+    rocshmem_request_t *request);
 
 __device__ ATTR_NO_INLINE void rocshmem_ctx_uchar_wg_broadcast(
     rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned char *dest,
@@ -214,6 +376,10 @@ __host__ void rocshmem_ctx_uchar_broadcast(
 __host__ void rocshmem_ctx_uchar_broadcast(
     rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned char *dest,
     const unsigned char *source, int nelems, int pe_root);
+__host__ void rocshmem_ctx_uchar_broadcast_nbi(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned char *dest,
+    const unsigned char *source, int nelems, int pe_root,
+    rocshmem_request_t *request);
 
 __device__ ATTR_NO_INLINE void rocshmem_ctx_ushort_wg_broadcast(
     rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned short *dest,
@@ -225,6 +391,10 @@ __host__ void rocshmem_ctx_ushort_broadcast(
 __host__ void rocshmem_ctx_ushort_broadcast(
     rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned short *dest,
     const unsigned short *source, int nelems, int pe_root);
+__host__ void rocshmem_ctx_ushort_broadcast_nbi(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned short *dest,
+    const unsigned short *source, int nelems, int pe_root,
+    rocshmem_request_t *request);
 
 __device__ ATTR_NO_INLINE void rocshmem_ctx_uint_wg_broadcast(
     rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned int *dest,
@@ -236,6 +406,10 @@ __host__ void rocshmem_ctx_uint_broadcast(
 __host__ void rocshmem_ctx_uint_broadcast(
     rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned int *dest,
     const unsigned int *source, int nelems, int pe_root);
+__host__ void rocshmem_ctx_uint_broadcast_nbi(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned int *dest,
+    const unsigned int *source, int nelems, int pe_root,
+    rocshmem_request_t *request);
 
 __device__ ATTR_NO_INLINE void rocshmem_ctx_ulong_wg_broadcast(
     rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned long *dest,
@@ -247,6 +421,10 @@ __host__ void rocshmem_ctx_ulong_broadcast(
 __host__ void rocshmem_ctx_ulong_broadcast(
     rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned long *dest,
     const unsigned long *source, int nelems, int pe_root);
+__host__ void rocshmem_ctx_ulong_broadcast_nbi(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned long *dest,
+    const unsigned long *source, int nelems, int pe_root,
+    rocshmem_request_t *request);
 
 __device__ ATTR_NO_INLINE void rocshmem_ctx_ulonglong_wg_broadcast(
     rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned long long *dest,
@@ -258,6 +436,10 @@ __host__ void rocshmem_ctx_ulonglong_broadcast(
 __host__ void rocshmem_ctx_ulonglong_broadcast(
     rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned long long *dest,
     const unsigned long long *source, int nelems, int pe_root);
+__host__ void rocshmem_ctx_ulonglong_broadcast_nbi(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned long long *dest,
+    const unsigned long long *source, int nelems, int pe_root,
+    rocshmem_request_t *request);
 
 
 /**
@@ -279,54 +461,93 @@ __host__ void rocshmem_ctx_ulonglong_broadcast(
 __device__ ATTR_NO_INLINE void rocshmem_ctx_float_wg_fcollect(
     rocshmem_ctx_t ctx, rocshmem_team_t team, float *dest,
     const float *source, int nelems);
+__host__ void rocshmem_ctx_float_fcollect(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, float *dest,
+    const float *source, int nelems);
 
 __device__ ATTR_NO_INLINE void rocshmem_ctx_double_wg_fcollect(
     rocshmem_ctx_t ctx, rocshmem_team_t team, double *dest,
     const double *source, int nelems);
+__host__ void rocshmem_ctx_double_fcollect(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, double *dest,
+    const double *source, int nelems);
 
 __device__ ATTR_NO_INLINE void rocshmem_ctx_char_wg_fcollect(
     rocshmem_ctx_t ctx, rocshmem_team_t team, char *dest,
     const char *source, int nelems);
+__host__ void rocshmem_ctx_char_fcollect(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, char *dest,
+    const char *source, int nelems);
 
 __device__ ATTR_NO_INLINE void rocshmem_ctx_schar_wg_fcollect(
     rocshmem_ctx_t ctx, rocshmem_team_t team, signed char *dest,
     const signed char *source, int nelems);
+__host__ void rocshmem_ctx_schar_fcollect(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, signed char *dest,
+    const signed char *source, int nelems);
 
 __device__ ATTR_NO_INLINE void rocshmem_ctx_short_wg_fcollect(
     rocshmem_ctx_t ctx, rocshmem_team_t team, short *dest,
     const short *source, int nelems);
+__host__ void rocshmem_ctx_short_fcollect(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, short *dest,
+    const short *source, int nelems);
 
 __device__ ATTR_NO_INLINE void rocshmem_ctx_int_wg_fcollect(
     rocshmem_ctx_t ctx, rocshmem_team_t team, int *dest,
     const int *source, int nelems);
+__host__ void rocshmem_ctx_int_fcollect(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, int *dest,
+    const int *source, int nelems);
 
 __device__ ATTR_NO_INLINE void rocshmem_ctx_long_wg_fcollect(
     rocshmem_ctx_t ctx, rocshmem_team_t team, long *dest,
     const long *source, int nelems);
+__host__ void rocshmem_ctx_long_fcollect(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, long *dest,
+    const long *source, int nelems);
 
 __device__ ATTR_NO_INLINE void rocshmem_ctx_longlong_wg_fcollect(
     rocshmem_ctx_t ctx, rocshmem_team_t team, long long *dest,
     const long long *source, int nelems);
+__host__ void rocshmem_ctx_longlong_fcollect(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, long long *dest,
+    const long long *source, int nelems);
 
 __device__ ATTR_NO_INLINE void rocshmem_ctx_uchar_wg_fcollect(
     rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned char *dest,
     const unsigned char *source, int nelems);
+__host__ void rocshmem_ctx_uchar_fcollect(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned char *dest,
+    const unsigned char *source, int nelems);
 
 __device__ ATTR_NO_INLINE void rocshmem_ctx_ushort_wg_fcollect(
     rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned short *dest,
     const unsigned short *source, int nelems);
+__host__ void rocshmem_ctx_ushort_fcollect(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned short *dest,
+    const unsigned short *source, int nelems);
 
 __device__ ATTR_NO_INLINE void rocshmem_ctx_uint_wg_fcollect(
     rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned int *dest,
     const unsigned int *source, int nelems);
+__host__ void rocshmem_ctx_uint_fcollect(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned int *dest,
+    const unsigned int *source, int nelems);
 
 __device__ ATTR_NO_INLINE void rocshmem_ctx_ulong_wg_fcollect(
     rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned long *dest,
     const unsigned long *source, int nelems);
+__host__ void rocshmem_ctx_ulong_fcollect(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned long *dest,
+    const unsigned long *source, int nelems);
 
 __device__ ATTR_NO_INLINE void rocshmem_ctx_ulonglong_wg_fcollect(
     rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned long long *dest,
     const unsigned long long *source, int nelems);
+__host__ void rocshmem_ctx_ulonglong_fcollect(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned long long *dest,
+    const unsigned long long *source, int nelems);
 
 
 /**
@@ -342,6 +563,9 @@ __device__ ATTR_NO_INLINE void rocshmem_ctx_ulonglong_wg_fcollect(
  * @param[in] source       Source address. Must be an address on the symmetric
                            heap.
  * @param[in] nreduce      Size of the buffer to participate in the reduction.
+ * @param[out] request     Handle of a host *_nbi reduction. The caller
+                           returns immediately and completes the reduction
+                           with rocshmem_test or rocshmem_wait.
  *
  * @return int (Zero on successful local completion. Nonzero otherwise.)
  */
@@ -351,6 +575,9 @@ __device__ ATTR_NO_INLINE int rocshmem_ctx_short_sum_wg_reduce(
 __host__ int rocshmem_ctx_short_sum_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, short *dest, const short *source,
     int nreduce);
+__host__ int rocshmem_ctx_short_sum_reduce_nbi(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, short *dest, const short *source,
+    int nreduce, rocshmem_request_t *request);
 
 __device__ ATTR_NO_INLINE int rocshmem_ctx_short_min_wg_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, short *dest, const short *source,
@@ -358,6 +585,9 @@ __device__ ATTR_NO_INLINE int rocshmem_ctx_short_min_wg_reduce(
 __host__ int rocshmem_ctx_short_min_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, short *dest, const short *source,
     int nreduce);
+__host__ int rocshmem_ctx_short_min_reduce_nbi(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, short *dest, const short *source,
+    int nreduce, rocshmem_request_t *request);
 
 __device__ ATTR_NO_INLINE int rocshmem_ctx_short_max_wg_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, short *dest, const short *source,
@@ -365,6 +595,9 @@ __device__ ATTR_NO_INLINE int rocshmem_ctx_short_max_wg_reduce(
 __host__ int rocshmem_ctx_short_max_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, short *dest, const short *source,
     int nreduce);
+__host__ int rocshmem_ctx_short_max_reduce_nbi(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, short *dest, const short *source,
+    int nreduce, rocshmem_request_t *request);
 
 __device__ ATTR_NO_INLINE int rocshmem_ctx_short_prod_wg_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, short *dest, const short *source,
@@ -372,6 +605,9 @@ __device__ ATTR_NO_INLINE int rocshmem_ctx_short_prod_wg_reduce(
 __host__ int rocshmem_ctx_short_prod_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, short *dest, const short *source,
     int nreduce);
+__host__ int rocshmem_ctx_short_prod_reduce_nbi(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, short *dest, const short *source,
+    int nreduce, rocshmem_request_t *request);
 
 __device__ ATTR_NO_INLINE int rocshmem_ctx_short_or_wg_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, short *dest, const short *source,
@@ -379,6 +615,9 @@ __device__ ATTR_NO_INLINE int rocshmem_ctx_short_or_wg_reduce(
 __host__ int rocshmem_ctx_short_or_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, short *dest, const short *source,
     int nreduce);
+__host__ int rocshmem_ctx_short_or_reduce_nbi(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, short *dest, const short *source,
+    int nreduce, rocshmem_request_t *request);
 
 __device__ ATTR_NO_INLINE int rocshmem_ctx_short_and_wg_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, short *dest, const short *source,
@@ -386,6 +625,9 @@ __device__ ATTR_NO_INLINE int rocshmem_ctx_short_and_wg_reduce(
 __host__ int rocshmem_ctx_short_and_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, short *dest, const short *source,
     int nreduce);
+__host__ int rocshmem_ctx_short_and_reduce_nbi(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, short *dest, const short *source,
+    int nreduce, rocshmem_request_t *request);
 
 __device__ ATTR_NO_INLINE int rocshmem_ctx_short_xor_wg_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, short *dest, const short *source,
@@ -393,6 +635,9 @@ __device__ ATTR_NO_INLINE int rocshmem_ctx_short_xor_wg_reduce(
 __host__ int rocshmem_ctx_short_xor_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, short *dest, const short *source,
     int nreduce);
+__host__ int rocshmem_ctx_short_xor_reduce_nbi(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, short *dest, const short *source,
+    int nreduce, rocshmem_request_t *request);
 
 __device__ ATTR_NO_INLINE int rocshmem_ctx_int_sum_wg_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, int *dest, const int *source,
@@ -400,6 +645,9 @@ __device__ ATTR_NO_INLINE int rocshmem_ctx_int_sum_wg_reduce(
 __host__ int rocshmem_ctx_int_sum_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, int *dest, const int *source,
     int nreduce);
+__host__ int rocshmem_ctx_int_sum_reduce_nbi(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, int *dest, const int *source,
+    int nreduce, rocshmem_request_t *request);
 
 __device__ ATTR_NO_INLINE int rocshmem_ctx_int_min_wg_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, int *dest, const int *source,
@@ -407,6 +655,9 @@ __device__ ATTR_NO_INLINE int rocshmem_ctx_int_min_wg_reduce(
 __host__ int rocshmem_ctx_int_min_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, int *dest, const int *source,
     int nreduce);
+__host__ int rocshmem_ctx_int_min_reduce_nbi(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, int *dest, const int *source,
+    int nreduce, rocshmem_request_t *request);
 
 __device__ ATTR_NO_INLINE int rocshmem_ctx_int_max_wg_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, int *dest, const int *source,
@@ -414,6 +665,9 @@ __device__ ATTR_NO_INLINE int rocshmem_ctx_int_max_wg_reduce(
 __host__ int rocshmem_ctx_int_max_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, int *dest, const int *source,
     int nreduce);
+__host__ int rocshmem_ctx_int_max_reduce_nbi(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, int *dest, const int *source,
+    int nreduce, rocshmem_request_t *request);
 
 __device__ ATTR_NO_INLINE int rocshmem_ctx_int_prod_wg_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, int *dest, const int *source,
@@ -421,6 +675,9 @@ __device__ ATTR_NO_INLINE int rocshmem_ctx_int_prod_wg_reduce(
 __host__ int rocshmem_ctx_int_prod_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, int *dest, const int *source,
     int nreduce);
+__host__ int rocshmem_ctx_int_prod_reduce_nbi(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, int *dest, const int *source,
+    int nreduce, rocshmem_request_t *request);
 
 __device__ ATTR_NO_INLINE int rocshmem_ctx_int_or_wg_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, int *dest, const int *source,
@@ -428,6 +685,9 @@ __device__ ATTR_NO_INLINE int rocshmem_ctx_int_or_wg_reduce(
 __host__ int rocshmem_ctx_int_or_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, int *dest, const int *source,
     int nreduce);
+__host__ int rocshmem_ctx_int_or_reduce_nbi(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, int *dest, const int *source,
+    int nreduce, rocshmem_request_t *request);
 
 __device__ ATTR_NO_INLINE int rocshmem_ctx_int_and_wg_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, int *dest, const int *source,
@@ -435,6 +695,9 @@ __device__ ATTR_NO_INLINE int rocshmem_ctx_int_and_wg_reduce(
 __host__ int rocshmem_ctx_int_and_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, int *dest, const int *source,
     int nreduce);
+__host__ int rocshmem_ctx_int_and_reduce_nbi(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, int *dest, const int *source,
+    int nreduce, rocshmem_request_t *request);
 
 __device__ ATTR_NO_INLINE int rocshmem_ctx_int_xor_wg_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, int *dest, const int *source,
@@ -442,6 +705,9 @@ __device__ ATTR_NO_INLINE int rocshmem_ctx_int_xor_wg_reduce(
 __host__ int rocshmem_ctx_int_xor_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, int *dest, const int *source,
     int nreduce);
+__host__ int rocshmem_ctx_int_xor_reduce_nbi(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, int *dest, const int *source,
+    int nreduce, rocshmem_request_t *request);
 
 __device__ ATTR_NO_INLINE int rocshmem_ctx_long_sum_wg_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, long *dest, const long *source,
@@ -449,6 +715,9 @@ __device__ ATTR_NO_INLINE int rocshmem_ctx_long_sum_wg_reduce(
 __host__ int rocshmem_ctx_long_sum_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, long *dest, const long *source,
     int nreduce);
+__host__ int rocshmem_ctx_long_sum_reduce_nbi(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, long *dest, const long *source,
+    int nreduce, rocshmem_request_t *request);
 
 __device__ ATTR_NO_INLINE int rocshmem_ctx_long_min_wg_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, long *dest, const long *source,
@@ -456,6 +725,9 @@ __device__ ATTR_NO_INLINE int rocshmem_ctx_long_min_wg_reduce(
 __host__ int rocshmem_ctx_long_min_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, long *dest, const long *source,
     int nreduce);
+__host__ int rocshmem_ctx_long_min_reduce_nbi(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, long *dest, const long *source,
+    int nreduce, rocshmem_request_t *request);
 
 __device__ ATTR_NO_INLINE int rocshmem_ctx_long_max_wg_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, long *dest, const long *source,
@@ -463,6 +735,9 @@ __device__ ATTR_NO_INLINE int rocshmem_ctx_long_max_wg_reduce(
 __host__ int rocshmem_ctx_long_max_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, long *dest, const long *source,
     int nreduce);
+__host__ int rocshmem_ctx_long_max_reduce_nbi(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, long *dest, const long *source,
+    int nreduce, rocshmem_request_t *request);
 
 __device__ ATTR_NO_INLINE int rocshmem_ctx_long_prod_wg_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, long *dest, const long *source,
@@ -470,6 +745,9 @@ __device__ ATTR_NO_INLINE int rocshmem_ctx_long_prod_wg_reduce(
 __host__ int rocshmem_ctx_long_prod_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, long *dest, const long *source,
     int nreduce);
+__host__ int rocshmem_ctx_long_prod_reduce_nbi(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, long *dest, const long *source,
+    int nreduce, rocshmem_request_t *request);
 
 __device__ ATTR_NO_INLINE int rocshmem_ctx_long_or_wg_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, long *dest, const long *source,
@@ -477,6 +755,9 @@ __device__ ATTR_NO_INLINE int rocshmem_ctx_long_or_wg_reduce(
 __host__ int rocshmem_ctx_long_or_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, long *dest, const long *source,
     int nreduce);
+__host__ int rocshmem_ctx_long_or_reduce_nbi(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, long *dest, const long *source,
+    int nreduce, rocshmem_request_t *request);
 
 __device__ ATTR_NO_INLINE int rocshmem_ctx_long_and_wg_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, long *dest, const long *source,
@@ -484,6 +765,9 @@ __device__ ATTR_NO_INLINE int rocshmem_ctx_long_and_wg_reduce(
 __host__ int rocshmem_ctx_long_and_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, long *dest, const long *source,
     int nreduce);
+__host__ int rocshmem_ctx_long_and_reduce_nbi(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, long *dest, const long *source,
+    int nreduce, rocshmem_request_t *request);
 
 __device__ ATTR_NO_INLINE int rocshmem_ctx_long_xor_wg_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, long *dest, const long *source,
@@ -491,6 +775,9 @@ __device__ ATTR_NO_INLINE int rocshmem_ctx_long_xor_wg_reduce(
 __host__ int rocshmem_ctx_long_xor_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, long *dest, const long *source,
     int nreduce);
+__host__ int rocshmem_ctx_long_xor_reduce_nbi(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, long *dest, const long *source,
+    int nreduce, rocshmem_request_t *request);
 
 __device__ ATTR_NO_INLINE int rocshmem_ctx_longlong_sum_wg_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, long long *dest, const long long *source,
@@ -498,6 +785,9 @@ __device__ ATTR_NO_INLINE int rocshmem_ctx_longlong_sum_wg_reduce(
 __host__ int rocshmem_ctx_longlong_sum_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, long long *dest, const long long *source,
     int nreduce);
+__host__ int rocshmem_ctx_longlong_sum_reduce_nbi(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, long long *dest, const long long *source,
+    int nreduce, rocshmem_request_t *request);
 
 __device__ ATTR_NO_INLINE int rocshmem_ctx_longlong_min_wg_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, long long *dest, const long long *source,
@@ -505,6 +795,9 @@ __device__ ATTR_NO_INLINE int rocshmem_ctx_longlong_min_wg_reduce(
 __host__ int rocshmem_ctx_longlong_min_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, long long *dest, const long long *source,
     int nreduce);
+__host__ int rocshmem_ctx_longlong_min_reduce_nbi(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, long long *dest, const long long *source,
+    int nreduce, rocshmem_request_t *request);
 
 __device__ ATTR_NO_INLINE int rocshmem_ctx_longlong_max_wg_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, long long *dest, const long long *source,
@@ -512,6 +805,9 @@ __device__ ATTR_NO_INLINE int rocshmem_ctx_longlong_max_wg_reduce(
 __host__ int rocshmem_ctx_longlong_max_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, long long *dest, const long long *source,
     int nreduce);
+__host__ int rocshmem_ctx_longlong_max_reduce_nbi(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, long long *dest, const long long *source,
+    int nreduce, rocshmem_request_t *request);
 
 __device__ ATTR_NO_INLINE int rocshmem_ctx_longlong_prod_wg_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, long long *dest, const long long *source,
@@ -519,6 +815,9 @@ __device__ ATTR_NO_INLINE int rocshmem_ctx_longlong_prod_wg_reduce(
 __host__ int rocshmem_ctx_longlong_prod_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, long long *dest, const long long *source,
     int nreduce);
+__host__ int rocshmem_ctx_longlong_prod_reduce_nbi(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, long long *dest, const long long *source,
+    int nreduce, rocshmem_request_t *request);
 
 __device__ ATTR_NO_INLINE int rocshmem_ctx_longlong_or_wg_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, long long *dest, const long long *source,
@@ -526,6 +825,9 @@ __device__ ATTR_NO_INLINE int rocshmem_ctx_longlong_or_wg_reduce(
 __host__ int rocshmem_ctx_longlong_or_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, long long *dest, const long long *source,
     int nreduce);
+__host__ int rocshmem_ctx_longlong_or_reduce_nbi(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, long long *dest, const long long *source,
+    int nreduce, rocshmem_request_t *request);
 
 __device__ ATTR_NO_INLINE int rocshmem_ctx_longlong_and_wg_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, long long *dest, const long long *source,
@@ -533,6 +835,9 @@ __device__ ATTR_NO_INLINE int rocshmem_ctx_longlong_and_wg_reduce(
 __host__ int rocshmem_ctx_longlong_and_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, long long *dest, const long long *source,
     int nreduce);
+__host__ int rocshmem_ctx_longlong_and_reduce_nbi(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, long long *dest, const long long *source,
+    int nreduce, rocshmem_request_t *request);
 
 __device__ ATTR_NO_INLINE int rocshmem_ctx_longlong_xor_wg_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, long long *dest, const long long *source,
@@ -540,6 +845,9 @@ __device__ ATTR_NO_INLINE int rocshmem_ctx_longlong_xor_wg_reduce(
 __host__ int rocshmem_ctx_longlong_xor_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, long long *dest, const long long *source,
     int nreduce);
+__host__ int rocshmem_ctx_longlong_xor_reduce_nbi(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, long long *dest, const long long *source,
+    int nreduce, rocshmem_request_t *request);
 
 __device__ ATTR_NO_INLINE int rocshmem_ctx_float_sum_wg_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, float *dest, const float *source,
@@ -547,6 +855,9 @@ __device__ ATTR_NO_INLINE int rocshmem_ctx_float_sum_wg_reduce(
 __host__ int rocshmem_ctx_float_sum_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, float *dest, const float *source,
     int nreduce);
+__host__ int rocshmem_ctx_float_sum_reduce_nbi(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, float *dest, const float *source,
+    int nreduce, rocshmem_request_t *request);
 
 __device__ ATTR_NO_INLINE int rocshmem_ctx_float_min_wg_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, float *dest, const float *source,
@@ -554,6 +865,9 @@ __device__ ATTR_NO_INLINE int rocshmem_ctx_float_min_wg_reduce(
 __host__ int rocshmem_ctx_float_min_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, float *dest, const float *source,
     int nreduce);
+__host__ int rocshmem_ctx_float_min_reduce_nbi(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, float *dest, const float *source,
+    int nreduce, rocshmem_request_t *request);
 
 __device__ ATTR_NO_INLINE int rocshmem_ctx_float_max_wg_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, float *dest, const float *source,
@@ -561,6 +875,9 @@ __device__ ATTR_NO_INLINE int rocshmem_ctx_float_max_wg_reduce(
 __host__ int rocshmem_ctx_float_max_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, float *dest, const float *source,
     int nreduce);
+__host__ int rocshmem_ctx_float_max_reduce_nbi(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, float *dest, const float *source,
+    int nreduce, rocshmem_request_t *request);
 
 __device__ ATTR_NO_INLINE int rocshmem_ctx_float_prod_wg_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, float *dest, const float *source,
@@ -568,6 +885,9 @@ __device__ ATTR_NO_INLINE int rocshmem_ctx_float_prod_wg_reduce(
 __host__ int rocshmem_ctx_float_prod_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, float *dest, const float *source,
     int nreduce);
+__host__ int rocshmem_ctx_float_prod_reduce_nbi(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, float *dest, const float *source,
+    int nreduce, rocshmem_request_t *request);
 
 __device__ ATTR_NO_INLINE int rocshmem_ctx_double_sum_wg_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, double *dest, const double *source,
@@ -575,6 +895,9 @@ __device__ ATTR_NO_INLINE int rocshmem_ctx_double_sum_wg_reduce(
 __host__ int rocshmem_ctx_double_sum_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, double *dest, const double *source,
     int nreduce);
+__host__ int rocshmem_ctx_double_sum_reduce_nbi(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, double *dest, const double *source,
+    int nreduce, rocshmem_request_t *request);
 
 __device__ ATTR_NO_INLINE int rocshmem_ctx_double_min_wg_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, double *dest, const double *source,
@@ -582,6 +905,9 @@ __device__ ATTR_NO_INLINE int rocshmem_ctx_double_min_wg_reduce(
 __host__ int rocshmem_ctx_double_min_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, double *dest, const double *source,
     int nreduce);
+__host__ int rocshmem_ctx_double_min_reduce_nbi(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, double *dest, const double *source,
+    int nreduce, rocshmem_request_t *request);
 
 __device__ ATTR_NO_INLINE int rocshmem_ctx_double_max_wg_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, double *dest, const double *source,
@@ -589,6 +915,9 @@ __device__ ATTR_NO_INLINE int rocshmem_ctx_double_max_wg_reduce(
 __host__ int rocshmem_ctx_double_max_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, double *dest, const double *source,
     int nreduce);
+__host__ int rocshmem_ctx_double_max_reduce_nbi(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, double *dest, const double *source,
+    int nreduce, rocshmem_request_t *request);
 
 __device__ ATTR_NO_INLINE int rocshmem_ctx_double_prod_wg_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, double *dest, const double *source,
@@ -596,8 +925,287 @@ __device__ ATTR_NO_INLINE int rocshmem_ctx_double_prod_wg_reduce(
 __host__ int rocshmem_ctx_double_prod_reduce(
     rocshmem_ctx_t ctx, rocshmem_team_t team, double *dest, const double *source,
     int nreduce);
+__host__ int rocshmem_ctx_double_prod_reduce_nbi(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, double *dest, const double *source,
+    int nreduce, rocshmem_request_t *request);
 
 
+/**
+ * @name SHMEM_GRID_COLLECTIVES
+ * @brief Grid-cooperative variants of the reduction, broadcast, alltoall
+ * and fcollect collectives.
+ *
+ * These functions must be called by every thread of every work-group of
+ * the grid with the same arguments. The work-groups split the buffer
+ * between them and synchronize with each other, so the whole grid must be
+ * resident at once: launch the kernel with hipLaunchCooperativeKernel or
+ * with no more work-groups than fit on the device. The work-groups meet on
+ * a grid barrier owned by the team, so every work-group must pass the same
+ * team, though each may use its own context, and only one grid collective
+ * may be in flight on a team at a time; concurrent grids must use
+ * different teams. The calls return once the collective is complete on
+ * the calling PE for every work-group.
+ *
+ * Grid collectives are supported by the IPC conduit.
+ *
+ * @param[in] team         The team participating in the collective.
+ * @param[in] dest         Destination address. Must be an address on the
+ *                         symmetric heap.
+ * @param[in] source       Source address. Must be an address on the symmetric
+                           heap.
+ * @param[in] nreduce      Size of the buffer to participate in the reduction.
+ * @param[in] nelems       Number of elements to broadcast, or of data blocks
+                           per PE for alltoall and fcollect.
+ * @param[in] pe_root      Zero-based ordinal of the PE, with respect to the
+                           team, from which the data is copied.
+ *
+ * @return int for the reductions (Zero on successful local completion.
+ * Nonzero otherwise.), void for the others.
+ */
+__device__ ATTR_NO_INLINE int rocshmem_ctx_short_sum_grid_reduce(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, short *dest,
+    const short *source, int nreduce);
+__device__ ATTR_NO_INLINE int rocshmem_ctx_short_min_grid_reduce(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, short *dest,
+    const short *source, int nreduce);
+__device__ ATTR_NO_INLINE int rocshmem_ctx_short_max_grid_reduce(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, short *dest,
+    const short *source, int nreduce);
+__device__ ATTR_NO_INLINE int rocshmem_ctx_short_prod_grid_reduce(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, short *dest,
+    const short *source, int nreduce);
+__device__ ATTR_NO_INLINE int rocshmem_ctx_short_or_grid_reduce(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, short *dest,
+    const short *source, int nreduce);
+__device__ ATTR_NO_INLINE int rocshmem_ctx_short_and_grid_reduce(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, short *dest,
+    const short *source, int nreduce);
+__device__ ATTR_NO_INLINE int rocshmem_ctx_short_xor_grid_reduce(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, short *dest,
+    const short *source, int nreduce);
+
+__device__ ATTR_NO_INLINE int rocshmem_ctx_int_sum_grid_reduce(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, int *dest,
+    const int *source, int nreduce);
+__device__ ATTR_NO_INLINE int rocshmem_ctx_int_min_grid_reduce(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, int *dest,
+    const int *source, int nreduce);
+__device__ ATTR_NO_INLINE int rocshmem_ctx_int_max_grid_reduce(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, int *dest,
+    const int *source, int nreduce);
+__device__ ATTR_NO_INLINE int rocshmem_ctx_int_prod_grid_reduce(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, int *dest,
+    const int *source, int nreduce);
+__device__ ATTR_NO_INLINE int rocshmem_ctx_int_or_grid_reduce(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, int *dest,
+    const int *source, int nreduce);
+__device__ ATTR_NO_INLINE int rocshmem_ctx_int_and_grid_reduce(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, int *dest,
+    const int *source, int nreduce);
+__device__ ATTR_NO_INLINE int rocshmem_ctx_int_xor_grid_reduce(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, int *dest,
+    const int *source, int nreduce);
+
+__device__ ATTR_NO_INLINE int rocshmem_ctx_long_sum_grid_reduce(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, long *dest,
+    const long *source, int nreduce);
+__device__ ATTR_NO_INLINE int rocshmem_ctx_long_min_grid_reduce(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, long *dest,
+    const long *source, int nreduce);
+__device__ ATTR_NO_INLINE int rocshmem_ctx_long_max_grid_reduce(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, long *dest,
+    const long *source, int nreduce);
+__device__ ATTR_NO_INLINE int rocshmem_ctx_long_prod_grid_reduce(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, long *dest,
+    const long *source, int nreduce);
+__device__ ATTR_NO_INLINE int rocshmem_ctx_long_or_grid_reduce(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, long *dest,
+    const long *source, int nreduce);
+__device__ ATTR_NO_INLINE int rocshmem_ctx_long_and_grid_reduce(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, long *dest,
+    const long *source, int nreduce);
+__device__ ATTR_NO_INLINE int rocshmem_ctx_long_xor_grid_reduce(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, long *dest,
+    const long *source, int nreduce);
+
+__device__ ATTR_NO_INLINE int rocshmem_ctx_longlong_sum_grid_reduce(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, long long *dest,
+    const long long *source, int nreduce);
+__device__ ATTR_NO_INLINE int rocshmem_ctx_longlong_min_grid_reduce(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, long long *dest,
+    const long long *source, int nreduce);
+__device__ ATTR_NO_INLINE int rocshmem_ctx_longlong_max_grid_reduce(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, long long *dest,
+    const long long *source, int nreduce);
+__device__ ATTR_NO_INLINE int rocshmem_ctx_longlong_prod_grid_reduce(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, long long *dest,
+    const long long *source, int nreduce);
+__device__ ATTR_NO_INLINE int rocshmem_ctx_longlong_or_grid_reduce(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, long long *dest,
+    const long long *source, int nreduce);
+__device__ ATTR_NO_INLINE int rocshmem_ctx_longlong_and_grid_reduce(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, long long *dest,
+    const long long *source, int nreduce);
+__device__ ATTR_NO_INLINE int rocshmem_ctx_longlong_xor_grid_reduce(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, long long *dest,
+    const long long *source, int nreduce);
+
+__device__ ATTR_NO_INLINE int rocshmem_ctx_float_sum_grid_reduce(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, float *dest,
+    const float *source, int nreduce);
+__device__ ATTR_NO_INLINE int rocshmem_ctx_float_min_grid_reduce(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, float *dest,
+    const float *source, int nreduce);
+__device__ ATTR_NO_INLINE int rocshmem_ctx_float_max_grid_reduce(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, float *dest,
+    const float *source, int nreduce);
+__device__ ATTR_NO_INLINE int rocshmem_ctx_float_prod_grid_reduce(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, float *dest,
+    const float *source, int nreduce);
+
+__device__ ATTR_NO_INLINE int rocshmem_ctx_double_sum_grid_reduce(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, double *dest,
+    const double *source, int nreduce);
+__device__ ATTR_NO_INLINE int rocshmem_ctx_double_min_grid_reduce(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, double *dest,
+    const double *source, int nreduce);
+__device__ ATTR_NO_INLINE int rocshmem_ctx_double_max_grid_reduce(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, double *dest,
+    const double *source, int nreduce);
+__device__ ATTR_NO_INLINE int rocshmem_ctx_double_prod_grid_reduce(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, double *dest,
+    const double *source, int nreduce);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_float_grid_broadcast(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, float *dest,
+    const float *source, int nelems, int pe_root);
+__device__ ATTR_NO_INLINE void rocshmem_ctx_float_grid_alltoall(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, float *dest,
+    const float *source, int nelems);
+__device__ ATTR_NO_INLINE void rocshmem_ctx_float_grid_fcollect(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, float *dest,
+    const float *source, int nelems);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_double_grid_broadcast(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, double *dest,
+    const double *source, int nelems, int pe_root);
+__device__ ATTR_NO_INLINE void rocshmem_ctx_double_grid_alltoall(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, double *dest,
+    const double *source, int nelems);
+__device__ ATTR_NO_INLINE void rocshmem_ctx_double_grid_fcollect(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, double *dest,
+    const double *source, int nelems);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_char_grid_broadcast(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, char *dest,
+    const char *source, int nelems, int pe_root);
+__device__ ATTR_NO_INLINE void rocshmem_ctx_char_grid_alltoall(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, char *dest,
+    const char *source, int nelems);
+__device__ ATTR_NO_INLINE void rocshmem_ctx_char_grid_fcollect(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, char *dest,
+    const char *source, int nelems);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_schar_grid_broadcast(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, signed char *dest,
+    const signed char *source, int nelems, int pe_root);
+__device__ ATTR_NO_INLINE void rocshmem_ctx_schar_grid_alltoall(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, signed char *dest,
+    const signed char *source, int nelems);
+__device__ ATTR_NO_INLINE void rocshmem_ctx_schar_grid_fcollect(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, signed char *dest,
+    const signed char *source, int nelems);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_short_grid_broadcast(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, short *dest,
+    const short *source, int nelems, int pe_root);
+__device__ ATTR_NO_INLINE void rocshmem_ctx_short_grid_alltoall(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, short *dest,
+    const short *source, int nelems);
+__device__ ATTR_NO_INLINE void rocshmem_ctx_short_grid_fcollect(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, short *dest,
+    const short *source, int nelems);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_int_grid_broadcast(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, int *dest,
+    const int *source, int nelems, int pe_root);
+__device__ ATTR_NO_INLINE void rocshmem_ctx_int_grid_alltoall(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, int *dest,
+    const int *source, int nelems);
+__device__ ATTR_NO_INLINE void rocshmem_ctx_int_grid_fcollect(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, int *dest,
+    const int *source, int nelems);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_long_grid_broadcast(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, long *dest,
+    const long *source, int nelems, int pe_root);
+__device__ ATTR_NO_INLINE void rocshmem_ctx_long_grid_alltoall(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, long *dest,
+    const long *source, int nelems);
+__device__ ATTR_NO_INLINE void rocshmem_ctx_long_grid_fcollect(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, long *dest,
+    const long *source, int nelems);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_longlong_grid_broadcast(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, long long *dest,
+    const long long *source, int nelems, int pe_root);
+__device__ ATTR_NO_INLINE void rocshmem_ctx_longlong_grid_alltoall(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, long long *dest,
+    const long long *source, int nelems);
+__device__ ATTR_NO_INLINE void rocshmem_ctx_longlong_grid_fcollect(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, long long *dest,
+    const long long *source, int nelems);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_uchar_grid_broadcast(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned char *dest,
+    const unsigned char *source, int nelems, int pe_root);
+__device__ ATTR_NO_INLINE void rocshmem_ctx_uchar_grid_alltoall(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned char *dest,
+    const unsigned char *source, int nelems);
+__device__ ATTR_NO_INLINE void rocshmem_ctx_uchar_grid_fcollect(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned char *dest,
+    const unsigned char *source, int nelems);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_ushort_grid_broadcast(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned short *dest,
+    const unsigned short *source, int nelems, int pe_root);
+__device__ ATTR_NO_INLINE void rocshmem_ctx_ushort_grid_alltoall(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned short *dest,
+    const unsigned short *source, int nelems);
+__device__ ATTR_NO_INLINE void rocshmem_ctx_ushort_grid_fcollect(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned short *dest,
+    const unsigned short *source, int nelems);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_uint_grid_broadcast(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned int *dest,
+    const unsigned int *source, int nelems, int pe_root);
+__device__ ATTR_NO_INLINE void rocshmem_ctx_uint_grid_alltoall(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned int *dest,
+    const unsigned int *source, int nelems);
+__device__ ATTR_NO_INLINE void rocshmem_ctx_uint_grid_fcollect(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned int *dest,
+    const unsigned int *source, int nelems);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_ulong_grid_broadcast(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned long *dest,
+    const unsigned long *source, int nelems, int pe_root);
+__device__ ATTR_NO_INLINE void rocshmem_ctx_ulong_grid_alltoall(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned long *dest,
+    const unsigned long *source, int nelems);
+__device__ ATTR_NO_INLINE void rocshmem_ctx_ulong_grid_fcollect(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned long *dest,
+    const unsigned long *source, int nelems);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_ulonglong_grid_broadcast(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned long long *dest,
+    const unsigned long long *source, int nelems, int pe_root);
+__device__ ATTR_NO_INLINE void rocshmem_ctx_ulonglong_grid_alltoall(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned long long *dest,
+    const unsigned long long *source, int nelems);
+__device__ ATTR_NO_INLINE void rocshmem_ctx_ulonglong_grid_fcollect(
+    rocshmem_ctx_t ctx, rocshmem_team_t team, unsigned long long *dest,
+    const unsigned long long *source, int nelems);
+
 }  // namespace rocshmem
 
 #endif  // LIBRARY_INCLUDE_ROCSHMEM_COLL_HPP
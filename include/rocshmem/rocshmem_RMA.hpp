@@ -1143,6 +1143,393 @@ __host__ void rocshmem_ulonglong_get_nbi(unsigned long long *dest,
     const unsigned long long *source, size_t nelems, int pe);
 
 
+/**
+ * @name SHMEM_IPUT
+ * @brief Writes \p nelems elements from \p source on the calling PE, read
+ * with a stride of \p sst elements, to \p dest at \p pe, written with a
+ * stride of \p dst elements. The caller will block until the operation
+ * completes locally (it is safe to reuse \p source). The caller must
+ * call into rocshmem_quiet() if remote completion is required.
+ *
+ * This function can be called from divergent control paths at per-thread
+ * granularity.
+ *
+ * @param[in] ctx    Context with which to perform this operation.
+ * @param[in] dest   Destination address. Must be an address on the symmetric
+ *                   heap.
+ * @param[in] source Source address. Must be an address on the symmetric heap.
+ * @param[in] dst    Stride between consecutive elements of \p dest, in
+ *                   elements.
+ * @param[in] sst    Stride between consecutive elements of \p source, in
+ *                   elements.
+ * @param[in] nelems Number of elements to transfer.
+ * @param[in] pe     PE of the remote process.
+ *
+ * @return void.
+ */
+__device__ ATTR_NO_INLINE void rocshmem_ctx_float_iput(
+    rocshmem_ctx_t ctx, float *dest, const float *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_float_iput(
+    float *dest, const float *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+__host__ void rocshmem_ctx_float_iput(
+    rocshmem_ctx_t ctx, float *dest, const float *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__host__ void rocshmem_float_iput(float *dest,
+    const float *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_double_iput(
+    rocshmem_ctx_t ctx, double *dest, const double *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_double_iput(
+    double *dest, const double *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+__host__ void rocshmem_ctx_double_iput(
+    rocshmem_ctx_t ctx, double *dest, const double *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__host__ void rocshmem_double_iput(double *dest,
+    const double *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_char_iput(
+    rocshmem_ctx_t ctx, char *dest, const char *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_char_iput(
+    char *dest, const char *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+__host__ void rocshmem_ctx_char_iput(
+    rocshmem_ctx_t ctx, char *dest, const char *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__host__ void rocshmem_char_iput(char *dest,
+    const char *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_schar_iput(
+    rocshmem_ctx_t ctx, signed char *dest, const signed char *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_schar_iput(
+    signed char *dest, const signed char *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+__host__ void rocshmem_ctx_schar_iput(
+    rocshmem_ctx_t ctx, signed char *dest, const signed char *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__host__ void rocshmem_schar_iput(signed char *dest,
+    const signed char *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_short_iput(
+    rocshmem_ctx_t ctx, short *dest, const short *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_short_iput(
+    short *dest, const short *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+__host__ void rocshmem_ctx_short_iput(
+    rocshmem_ctx_t ctx, short *dest, const short *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__host__ void rocshmem_short_iput(short *dest,
+    const short *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_int_iput(
+    rocshmem_ctx_t ctx, int *dest, const int *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_int_iput(
+    int *dest, const int *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+__host__ void rocshmem_ctx_int_iput(
+    rocshmem_ctx_t ctx, int *dest, const int *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__host__ void rocshmem_int_iput(int *dest,
+    const int *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_long_iput(
+    rocshmem_ctx_t ctx, long *dest, const long *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_long_iput(
+    long *dest, const long *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+__host__ void rocshmem_ctx_long_iput(
+    rocshmem_ctx_t ctx, long *dest, const long *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__host__ void rocshmem_long_iput(long *dest,
+    const long *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_longlong_iput(
+    rocshmem_ctx_t ctx, long long *dest, const long long *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_longlong_iput(
+    long long *dest, const long long *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+__host__ void rocshmem_ctx_longlong_iput(
+    rocshmem_ctx_t ctx, long long *dest, const long long *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__host__ void rocshmem_longlong_iput(long long *dest,
+    const long long *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_uchar_iput(
+    rocshmem_ctx_t ctx, unsigned char *dest, const unsigned char *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_uchar_iput(
+    unsigned char *dest, const unsigned char *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+__host__ void rocshmem_ctx_uchar_iput(
+    rocshmem_ctx_t ctx, unsigned char *dest, const unsigned char *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__host__ void rocshmem_uchar_iput(unsigned char *dest,
+    const unsigned char *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_ushort_iput(
+    rocshmem_ctx_t ctx, unsigned short *dest, const unsigned short *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_ushort_iput(
+    unsigned short *dest, const unsigned short *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+__host__ void rocshmem_ctx_ushort_iput(
+    rocshmem_ctx_t ctx, unsigned short *dest, const unsigned short *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__host__ void rocshmem_ushort_iput(unsigned short *dest,
+    const unsigned short *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_uint_iput(
+    rocshmem_ctx_t ctx, unsigned int *dest, const unsigned int *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_uint_iput(
+    unsigned int *dest, const unsigned int *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+__host__ void rocshmem_ctx_uint_iput(
+    rocshmem_ctx_t ctx, unsigned int *dest, const unsigned int *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__host__ void rocshmem_uint_iput(unsigned int *dest,
+    const unsigned int *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_ulong_iput(
+    rocshmem_ctx_t ctx, unsigned long *dest, const unsigned long *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_ulong_iput(
+    unsigned long *dest, const unsigned long *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+__host__ void rocshmem_ctx_ulong_iput(
+    rocshmem_ctx_t ctx, unsigned long *dest, const unsigned long *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__host__ void rocshmem_ulong_iput(unsigned long *dest,
+    const unsigned long *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_ulonglong_iput(
+    rocshmem_ctx_t ctx, unsigned long long *dest, const unsigned long long *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_ulonglong_iput(
+    unsigned long long *dest, const unsigned long long *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+__host__ void rocshmem_ctx_ulonglong_iput(
+    rocshmem_ctx_t ctx, unsigned long long *dest, const unsigned long long *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__host__ void rocshmem_ulonglong_iput(unsigned long long *dest,
+    const unsigned long long *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+
+/**
+ * @name SHMEM_IGET
+ * @brief Reads \p nelems elements from \p source on \p pe, read with a
+ * stride of \p sst elements, into \p dest on the calling PE, written with
+ * a stride of \p dst elements. The caller will block until the operation
+ * completes (it is safe to read \p dest).
+ *
+ * This function can be called from divergent control paths at per-thread
+ * granularity.
+ *
+ * @param[in] ctx    Context with which to perform this operation.
+ * @param[in] dest   Destination address. Must be an address on the symmetric
+ *                   heap.
+ * @param[in] source Source address. Must be an address on the symmetric heap.
+ * @param[in] dst    Stride between consecutive elements of \p dest, in
+ *                   elements.
+ * @param[in] sst    Stride between consecutive elements of \p source, in
+ *                   elements.
+ * @param[in] nelems Number of elements to transfer.
+ * @param[in] pe     PE of the remote process.
+ *
+ * @return void.
+ */
+__device__ ATTR_NO_INLINE void rocshmem_ctx_float_iget(
+    rocshmem_ctx_t ctx, float *dest, const float *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_float_iget(
+    float *dest, const float *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+__host__ void rocshmem_ctx_float_iget(
+    rocshmem_ctx_t ctx, float *dest, const float *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__host__ void rocshmem_float_iget(float *dest,
+    const float *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_double_iget(
+    rocshmem_ctx_t ctx, double *dest, const double *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_double_iget(
+    double *dest, const double *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+__host__ void rocshmem_ctx_double_iget(
+    rocshmem_ctx_t ctx, double *dest, const double *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__host__ void rocshmem_double_iget(double *dest,
+    const double *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_char_iget(
+    rocshmem_ctx_t ctx, char *dest, const char *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_char_iget(
+    char *dest, const char *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+__host__ void rocshmem_ctx_char_iget(
+    rocshmem_ctx_t ctx, char *dest, const char *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__host__ void rocshmem_char_iget(char *dest,
+    const char *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_schar_iget(
+    rocshmem_ctx_t ctx, signed char *dest, const signed char *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_schar_iget(
+    signed char *dest, const signed char *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+__host__ void rocshmem_ctx_schar_iget(
+    rocshmem_ctx_t ctx, signed char *dest, const signed char *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__host__ void rocshmem_schar_iget(signed char *dest,
+    const signed char *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_short_iget(
+    rocshmem_ctx_t ctx, short *dest, const short *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_short_iget(
+    short *dest, const short *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+__host__ void rocshmem_ctx_short_iget(
+    rocshmem_ctx_t ctx, short *dest, const short *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__host__ void rocshmem_short_iget(short *dest,
+    const short *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_int_iget(
+    rocshmem_ctx_t ctx, int *dest, const int *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_int_iget(
+    int *dest, const int *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+__host__ void rocshmem_ctx_int_iget(
+    rocshmem_ctx_t ctx, int *dest, const int *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__host__ void rocshmem_int_iget(int *dest,
+    const int *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_long_iget(
+    rocshmem_ctx_t ctx, long *dest, const long *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_long_iget(
+    long *dest, const long *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+__host__ void rocshmem_ctx_long_iget(
+    rocshmem_ctx_t ctx, long *dest, const long *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__host__ void rocshmem_long_iget(long *dest,
+    const long *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_longlong_iget(
+    rocshmem_ctx_t ctx, long long *dest, const long long *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_longlong_iget(
+    long long *dest, const long long *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+__host__ void rocshmem_ctx_longlong_iget(
+    rocshmem_ctx_t ctx, long long *dest, const long long *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__host__ void rocshmem_longlong_iget(long long *dest,
+    const long long *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_uchar_iget(
+    rocshmem_ctx_t ctx, unsigned char *dest, const unsigned char *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_uchar_iget(
+    unsigned char *dest, const unsigned char *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+__host__ void rocshmem_ctx_uchar_iget(
+    rocshmem_ctx_t ctx, unsigned char *dest, const unsigned char *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__host__ void rocshmem_uchar_iget(unsigned char *dest,
+    const unsigned char *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_ushort_iget(
+    rocshmem_ctx_t ctx, unsigned short *dest, const unsigned short *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_ushort_iget(
+    unsigned short *dest, const unsigned short *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+__host__ void rocshmem_ctx_ushort_iget(
+    rocshmem_ctx_t ctx, unsigned short *dest, const unsigned short *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__host__ void rocshmem_ushort_iget(unsigned short *dest,
+    const unsigned short *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_uint_iget(
+    rocshmem_ctx_t ctx, unsigned int *dest, const unsigned int *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_uint_iget(
+    unsigned int *dest, const unsigned int *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+__host__ void rocshmem_ctx_uint_iget(
+    rocshmem_ctx_t ctx, unsigned int *dest, const unsigned int *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__host__ void rocshmem_uint_iget(unsigned int *dest,
+    const unsigned int *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_ulong_iget(
+    rocshmem_ctx_t ctx, unsigned long *dest, const unsigned long *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_ulong_iget(
+    unsigned long *dest, const unsigned long *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+__host__ void rocshmem_ctx_ulong_iget(
+    rocshmem_ctx_t ctx, unsigned long *dest, const unsigned long *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__host__ void rocshmem_ulong_iget(unsigned long *dest,
+    const unsigned long *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_ulonglong_iget(
+    rocshmem_ctx_t ctx, unsigned long long *dest, const unsigned long long *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_ulonglong_iget(
+    unsigned long long *dest, const unsigned long long *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+__host__ void rocshmem_ctx_ulonglong_iget(
+    rocshmem_ctx_t ctx, unsigned long long *dest, const unsigned long long *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__host__ void rocshmem_ulonglong_iget(unsigned long long *dest,
+    const unsigned long long *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+
 /**
  * @brief Reads contiguous data of \p nelems bytes from \p source on \p pe
  * to \p dest on the calling PE. The operation is not blocking. The caller will
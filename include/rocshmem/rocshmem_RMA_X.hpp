@@ -975,6 +975,237 @@ __device__ ATTR_NO_INLINE void rocshmem_ulonglong_get_nbi_wg(
     unsigned long long *dest, const unsigned long long *source, size_t nelems, int pe);
 
 
+/**
+ * @brief Writes \p nelems elements from \p source on the calling PE, read
+ * with a stride of \p sst elements, to \p dest at \p pe, written with a
+ * stride of \p dst elements. The elements are spread across the lanes of
+ * the wave. The caller will block until the operation completes locally (it
+ * is safe to reuse \p source).
+ *
+ * This function can be called from divergent control paths at per-wave
+ * granularity. However, all threads in a wave must collectively participate
+ * in the call using the same arguments
+ *
+ * @param[in] ctx    Context with which to perform this operation.
+ * @param[in] dest   Destination address. Must be an address on the symmetric
+ *                   heap.
+ * @param[in] source Source address. Must be an address on the symmetric heap.
+ * @param[in] dst    Stride between consecutive elements of \p dest, in
+ *                   elements.
+ * @param[in] sst    Stride between consecutive elements of \p source, in
+ *                   elements.
+ * @param[in] nelems Number of elements to transfer.
+ * @param[in] pe     PE of the remote process.
+ *
+ * @return void.
+ */
+__device__ ATTR_NO_INLINE void rocshmem_ctx_float_iput_wave(
+    rocshmem_ctx_t ctx, float *dest, const float *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_float_iput_wave(
+    float *dest, const float *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_double_iput_wave(
+    rocshmem_ctx_t ctx, double *dest, const double *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_double_iput_wave(
+    double *dest, const double *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_char_iput_wave(
+    rocshmem_ctx_t ctx, char *dest, const char *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_char_iput_wave(
+    char *dest, const char *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_schar_iput_wave(
+    rocshmem_ctx_t ctx, signed char *dest, const signed char *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_schar_iput_wave(
+    signed char *dest, const signed char *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_short_iput_wave(
+    rocshmem_ctx_t ctx, short *dest, const short *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_short_iput_wave(
+    short *dest, const short *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_int_iput_wave(
+    rocshmem_ctx_t ctx, int *dest, const int *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_int_iput_wave(
+    int *dest, const int *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_long_iput_wave(
+    rocshmem_ctx_t ctx, long *dest, const long *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_long_iput_wave(
+    long *dest, const long *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_longlong_iput_wave(
+    rocshmem_ctx_t ctx, long long *dest, const long long *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_longlong_iput_wave(
+    long long *dest, const long long *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_uchar_iput_wave(
+    rocshmem_ctx_t ctx, unsigned char *dest, const unsigned char *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_uchar_iput_wave(
+    unsigned char *dest, const unsigned char *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_ushort_iput_wave(
+    rocshmem_ctx_t ctx, unsigned short *dest, const unsigned short *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_ushort_iput_wave(
+    unsigned short *dest, const unsigned short *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_uint_iput_wave(
+    rocshmem_ctx_t ctx, unsigned int *dest, const unsigned int *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_uint_iput_wave(
+    unsigned int *dest, const unsigned int *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_ulong_iput_wave(
+    rocshmem_ctx_t ctx, unsigned long *dest, const unsigned long *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_ulong_iput_wave(
+    unsigned long *dest, const unsigned long *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_ulonglong_iput_wave(
+    rocshmem_ctx_t ctx, unsigned long long *dest, const unsigned long long *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_ulonglong_iput_wave(
+    unsigned long long *dest, const unsigned long long *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+
+/**
+ * @brief Reads \p nelems elements from \p source on \p pe, read with a
+ * stride of \p sst elements, into \p dest on the calling PE, written with
+ * a stride of \p dst elements. The elements are spread across the lanes of
+ * the wave. The caller will block until the operation completes.
+ *
+ * This function can be called from divergent control paths at per-wave
+ * granularity. However, all threads in a wave must collectively participate
+ * in the call using the same arguments
+ *
+ * @param[in] ctx    Context with which to perform this operation.
+ * @param[in] dest   Destination address. Must be an address on the symmetric
+ *                   heap.
+ * @param[in] source Source address. Must be an address on the symmetric heap.
+ * @param[in] dst    Stride between consecutive elements of \p dest, in
+ *                   elements.
+ * @param[in] sst    Stride between consecutive elements of \p source, in
+ *                   elements.
+ * @param[in] nelems Number of elements to transfer.
+ * @param[in] pe     PE of the remote process.
+ *
+ * @return void.
+ */
+__device__ ATTR_NO_INLINE void rocshmem_ctx_float_iget_wave(
+    rocshmem_ctx_t ctx, float *dest, const float *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_float_iget_wave(
+    float *dest, const float *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_double_iget_wave(
+    rocshmem_ctx_t ctx, double *dest, const double *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_double_iget_wave(
+    double *dest, const double *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_char_iget_wave(
+    rocshmem_ctx_t ctx, char *dest, const char *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_char_iget_wave(
+    char *dest, const char *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_schar_iget_wave(
+    rocshmem_ctx_t ctx, signed char *dest, const signed char *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_schar_iget_wave(
+    signed char *dest, const signed char *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_short_iget_wave(
+    rocshmem_ctx_t ctx, short *dest, const short *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_short_iget_wave(
+    short *dest, const short *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_int_iget_wave(
+    rocshmem_ctx_t ctx, int *dest, const int *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_int_iget_wave(
+    int *dest, const int *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_long_iget_wave(
+    rocshmem_ctx_t ctx, long *dest, const long *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_long_iget_wave(
+    long *dest, const long *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_longlong_iget_wave(
+    rocshmem_ctx_t ctx, long long *dest, const long long *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_longlong_iget_wave(
+    long long *dest, const long long *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_uchar_iget_wave(
+    rocshmem_ctx_t ctx, unsigned char *dest, const unsigned char *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_uchar_iget_wave(
+    unsigned char *dest, const unsigned char *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_ushort_iget_wave(
+    rocshmem_ctx_t ctx, unsigned short *dest, const unsigned short *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_ushort_iget_wave(
+    unsigned short *dest, const unsigned short *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_uint_iget_wave(
+    rocshmem_ctx_t ctx, unsigned int *dest, const unsigned int *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_uint_iget_wave(
+    unsigned int *dest, const unsigned int *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_ulong_iget_wave(
+    rocshmem_ctx_t ctx, unsigned long *dest, const unsigned long *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_ulong_iget_wave(
+    unsigned long *dest, const unsigned long *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+__device__ ATTR_NO_INLINE void rocshmem_ctx_ulonglong_iget_wave(
+    rocshmem_ctx_t ctx, unsigned long long *dest, const unsigned long long *source,
+    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);
+__device__ ATTR_NO_INLINE void rocshmem_ulonglong_iget_wave(
+    unsigned long long *dest, const unsigned long long *source, ptrdiff_t dst, ptrdiff_t sst,
+    size_t nelems, int pe);
+
+
 /**
  * @brief Reads contiguous data of \p nelems bytes from \p source on \p pe
  * to \p dest on the calling PE. The operation is not blocking. The caller
@@ -78,13 +78,45 @@ enum rocshmem_thread_ops {
  */
 enum rocshmem_team_configs {
   ROCSHMEM_TEAM_DEFAULT_CONFIGS,
-  ROCSHMEM_TEAM_NUM_CONTEXTS
+  ROCSHMEM_TEAM_NUM_CONTEXTS,
+  ROCSHMEM_TEAM_REDUCE_WRK_SIZE = 1 << 1
 };
 
 typedef struct {
   int num_contexts;
+  /**
+   * Elements of the largest reduction type the team's reduction work
+   * array holds. Larger work arrays let big reductions run in fewer
+   * passes. Values below ROCSHMEM_REDUCE_MIN_WRKDATA_SIZE are raised to it.
+   */
+  size_t reduce_wrk_size;
 } rocshmem_team_config_t;
 
+/**
+ * @brief Number of power-of-two size classes reported in heap statistics.
+ */
+constexpr int ROCSHMEM_HEAP_STATS_NUM_SIZE_CLASSES = 64;
+
+/**
+ * @brief Symmetric heap statistics of the calling PE.
+ *
+ * Size class k counts blocks of 2^k bytes.
+ */
+typedef struct {
+  size_t used_bytes;
+  size_t free_bytes;
+  size_t high_water_bytes;
+  size_t largest_free_block;
+  size_t num_segments;
+  size_t num_allocs;
+  size_t num_frees;
+  size_t num_failed_allocs;
+  double allocs_per_second;
+  double frees_per_second;
+  size_t allocated_blocks[ROCSHMEM_HEAP_STATS_NUM_SIZE_CLASSES];
+  size_t free_blocks[ROCSHMEM_HEAP_STATS_NUM_SIZE_CLASSES];
+} rocshmem_heap_stats_t;
+
 constexpr size_t ROCSHMEM_REDUCE_MIN_WRKDATA_SIZE = 1024;
 constexpr size_t ROCSHMEM_ATA_MAX_WRKDATA_SIZE = (4 * 1024 * 1024);
 constexpr size_t ROCSHMEM_BARRIER_SYNC_SIZE = 256;
@@ -100,6 +132,10 @@ const int ROCSHMEM_CTX_NOSTORE = 1;
 const int ROCSHMEM_CTX_SERIALIZED = 2;
 const int ROCSHMEM_CTX_WG_PRIVATE = 4;
 const int ROCSHMEM_CTX_SHARED = 8;
+// Host contexts only: stage small puts per target PE and ship each
+// buffer as one RMA when it fills or at fence/quiet. Ignored together
+// with ROCSHMEM_CTX_SHARED
+const int ROCSHMEM_CTX_AGGREGATE = 16;
 
 /**
  * @brief GPU side OpenSHMEM context created from each work-groups'
@@ -125,6 +161,53 @@ extern rocshmem_team_t ROCSHMEM_TEAM_WORLD;
 
 const rocshmem_team_t ROCSHMEM_TEAM_INVALID = nullptr;
 
+/**
+ * @brief Handle of a non-blocking host collective
+ */
+typedef struct rocshmem_request_opaque *rocshmem_request_t;
+
+const rocshmem_request_t ROCSHMEM_REQUEST_NULL = nullptr;
+
+/**
+ * @brief Host function run on behalf of a device rocshmem_host_callback
+ *
+ * Receives the inline arguments of the device call and the user data given
+ * at registration.
+ */
+typedef void (*rocshmem_host_callback_t)(const uint64_t *args, int nargs,
+                                         void *user_data);
+
+/**
+ * @brief Largest number of inline arguments of a host callback
+ */
+constexpr int ROCSHMEM_HOST_CALLBACK_MAX_ARGS = 4;
+
+// Host callback registration flags: run the callback on the proxy thread
+// which serves the device queues (keep it short), or hand it off to the
+// callback worker pool so long work does not stall the queues
+const int ROCSHMEM_HOST_CALLBACK_PROXY = 0;
+const int ROCSHMEM_HOST_CALLBACK_HANDOFF = 1;
+
+// Operation codes of a host batch descriptor
+enum rocshmem_batch_op_code {
+  ROCSHMEM_BATCH_PUT = 0,
+  ROCSHMEM_BATCH_GET = 1,
+};
+
+/**
+ * @brief One transfer of a host rocshmem_batch call
+ *
+ * For ROCSHMEM_BATCH_PUT \p dest is the symmetric address on \p pe; for
+ * ROCSHMEM_BATCH_GET \p source is.
+ */
+typedef struct {
+  int op;
+  void *dest;
+  const void *source;
+  size_t nbytes;
+  int pe;
+} rocshmem_batch_op_t;
+
 }  // namespace rocshmem
 
 #endif  // LIBRARY_INCLUDE_ROCSHMEM_COMMON_HPP
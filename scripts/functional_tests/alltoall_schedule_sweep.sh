@@ -0,0 +1,62 @@
+# Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+
+#!/bin/bash
+
+# Compares the peer orders of the IPC alltoall and fcollect across message
+# sizes. The tester sweeps every power-of-two size up to the maximum and
+# reports latency and bandwidth; each run forces one order through
+# ROCSHMEM_ALLTOALL_SCHEDULE (auto lets the library choose).
+
+if [ $# -lt 3 ] ; then
+    echo "This script must be run with at least 3 arguments."
+    echo 'Usage: ${0} argument1 argument2 argument3 [argument4] [argument5]'
+    echo "  argument1 : path to the tester driver"
+    echo "  argument2 : number of PEs"
+    echo "  argument3 : directory to put the output logs"
+    echo "  argument4 : largest message size in bytes (default 1048576)"
+    echo "  argument5 : threads per workgroup (default 256)"
+    exit 1
+fi
+
+tester=$1
+np=$2
+logdir=$3
+max_size=${4:-1048576}
+threads=${5:-256}
+
+sweep_return_status=0
+
+for schedule in linear pairwise wave auto ; do
+    for test in "alltoall 23" "fcollect 22" ; do
+        set -- $test
+        log=$logdir/${1}_${schedule}_n${np}_z${threads}.log
+        echo "${1} ${schedule}"
+        ROCSHMEM_ALLTOALL_SCHEDULE=$schedule ROCSHMEM_MAX_NUM_CONTEXTS=1 \
+            mpirun -np $np $tester -w 1 -z $threads -s $max_size -a $2 > $log
+        if [ $? -ne 0 ] ; then
+            echo "Failed ${1} ${schedule}" >&2
+            sweep_return_status=1
+        fi
+        cat $log
+    done
+done
+
+exit $sweep_return_status
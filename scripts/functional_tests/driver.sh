@@ -247,6 +247,21 @@ case $2 in
         echo "signalfetchwave"
         mpirun -np 2 $1 -w 1 -z 32 -a 60 > $3/signalfetchwave_n2_w2_z32.log
         check signalfetchwave_n2_w2_z32
+        echo "shmemptr"
+        mpirun -np 2 $1 -w 1 -z 64 -a 25 > $3/shmemptr_n2_w1_z64.log
+        check shmemptr_n2_w1_z64
+        echo "gridreduce"
+        ROCSHMEM_MAX_NUM_CONTEXTS=8 mpirun -np 2 $1 -w 8 -z 256 -s 1048576 -a 63 > $3/gridreduce_n2_w8_z256_1M.log
+        check gridreduce_n2_w8_z256_1M
+        echo "barrier_dissemination"
+        ROCSHMEM_BARRIER_KIND=dissemination ROCSHMEM_MAX_NUM_CONTEXTS=8 mpirun -np 2 $1 -w 8 -a 17 > $3/barrier_dissemination_n2_w8.log
+        check barrier_dissemination_n2_w8
+        echo "sync_dissemination"
+        ROCSHMEM_BARRIER_KIND=dissemination ROCSHMEM_MAX_NUM_CONTEXTS=8 mpirun -np 2 $1 -w 8 -a 19 > $3/sync_dissemination_n2_w8.log
+        check sync_dissemination_n2_w8
+        echo "barrier_tree"
+        ROCSHMEM_BARRIER_KIND=tree ROCSHMEM_MAX_NUM_CONTEXTS=8 mpirun -np 2 $1 -w 8 -a 17 > $3/barrier_tree_n2_w8.log
+        check barrier_tree_n2_w8
         ;;
 
     ###########################################################################
@@ -630,6 +645,18 @@ case $2 in
     *"signalfetchwave")
         mpirun -np 2 $1 -w 1 -z 32 -a 60
         ;;
+    *"shmemptr")
+        mpirun -np 2 $1 -w 1 -z 64 -a 25
+        ;;
+    *"hostcallback")
+        ROCSHMEM_MAX_NUM_CONTEXTS=2 mpirun -np 2 $1 -w 2 -z 64 -a 62
+        ;;
+    *"gridreduce")
+        ROCSHMEM_MAX_NUM_CONTEXTS=8 mpirun -np 2 $1 -w 8 -z 256 -s 1048576 -a 63
+        ;;
+    *"dissemination")
+        ROCSHMEM_BARRIER_KIND=dissemination ROCSHMEM_MAX_NUM_CONTEXTS=8 mpirun -np 2 $1 -w 8 -a 17
+        ;;
     *)
         echo "UNKNOWN TEST TYPE: $2"
         exit -1
@@ -245,6 +245,26 @@ __device__ __forceinline__ void store_asm(uint8_t* val, uint8_t* dst,
   }
 }
 
+typedef int dwordx4_t __attribute__((ext_vector_type(4)));
+
+/*
+ * Stores 16 bytes to a 16-byte aligned dst with the non-temporal hints of
+ * store_asm, so large copies do not evict the sender's working set.
+ */
+__device__ __forceinline__ void store_dwordx4_asm(dwordx4_t val,
+                                                  uint8_t* dst) {
+#if defined(__gfx906__)
+#endif
+#if defined(__gfx908__)
+#endif
+#if defined(__gfx90a__)
+  asm volatile("flat_store_dwordx4 %0 %1 glc slc" : : "v"(dst), "v"(val));
+#endif
+#if defined(__gfx940__) || defined(__gfx941__) || defined(__gfx942__)
+  asm volatile("flat_store_dwordx4 %0 %1 sc0 sc1 nt" : : "v"(dst), "v"(val));
+#endif
+}
+
 __device__ __forceinline__ uint64_t __read_clock() {
   uint64_t clock{};
 #if defined(__gfx906__)
@@ -85,10 +85,13 @@ void Backend::track_ctx(Context* ctx) {
    * since destroying CTX_PRIVATE is the user's
    * responsibility.
    */
+  const std::lock_guard<std::mutex> lock(list_of_ctxs_mutex);
   list_of_ctxs.push_back(ctx);
 }
 
 void Backend::untrack_ctx(Context* ctx) {
+  const std::lock_guard<std::mutex> lock(list_of_ctxs_mutex);
+
   /* Get an iterator to this ctx in the vector */
   std::vector<Context*>::iterator it =
       std::find(list_of_ctxs.begin(), list_of_ctxs.end(), ctx);
@@ -107,6 +110,14 @@ void Backend::destroy_remaining_ctxs() {
 
 Backend::~Backend() { CHECK_HIP(hipFree(print_lock)); }
 
+bool Backend::grow_heap([[maybe_unused]] size_t size) { return false; }
+
+int Backend::register_host_callback(
+    [[maybe_unused]] rocshmem_host_callback_t fn,
+    [[maybe_unused]] void* user_data, [[maybe_unused]] int flags) {
+  return -1;
+}
+
 void Backend::dump_stats() {
   printf("PE %d\n", my_pe);
 
@@ -128,6 +139,11 @@ void Backend::dump_stats() {
   printf("WAVE_Gets (Blocking/Nbi) %llu/%llu\n",
          device_stats.getStat(NUM_GET_WAVE),
          device_stats.getStat(NUM_GET_NBI_WAVE));
+  printf("Strided (Iput/Iget) %llu/%llu\n", device_stats.getStat(NUM_IPUT),
+         device_stats.getStat(NUM_IGET));
+  printf("WAVE_Strided (Iput/Iget) %llu/%llu\n",
+         device_stats.getStat(NUM_IPUT_WAVE),
+         device_stats.getStat(NUM_IGET_WAVE));
   printf("Fences %llu\n", device_stats.getStat(NUM_FENCE));
   printf("Quiets %llu\n", device_stats.getStat(NUM_QUIET));
   printf("ToAll %llu\n", device_stats.getStat(NUM_TO_ALL));
@@ -155,6 +171,7 @@ void Backend::dump_stats() {
   printf("Tests %llu\n", device_stats.getStat(NUM_TEST));
   printf("SHMEM_PTR %llu\n", device_stats.getStat(NUM_SHMEM_PTR));
   printf("SyncAll %llu\n", device_stats.getStat(NUM_SYNC_ALL));
+  printf("Host Callbacks %llu\n", device_stats.getStat(NUM_HOST_CALLBACK));
 
   const auto& host_stats{globalHostStats};
   printf("HOST STATS\n");
@@ -164,6 +181,9 @@ void Backend::dump_stats() {
   printf("Gets (Blocking/G/Nbi) (%llu/%llu/%llu)\n",
          host_stats.getStat(NUM_HOST_GET), host_stats.getStat(NUM_HOST_G),
          host_stats.getStat(NUM_HOST_GET_NBI));
+  printf("Strided (Iput/Iget) (%llu/%llu)\n", host_stats.getStat(NUM_HOST_IPUT),
+         host_stats.getStat(NUM_HOST_IGET));
+  printf("Batches %llu\n", host_stats.getStat(NUM_HOST_BATCH));
   printf("Fences %llu\n", host_stats.getStat(NUM_HOST_FENCE));
   printf("Quiets %llu\n", host_stats.getStat(NUM_HOST_QUIET));
   printf("ToAll %llu\n", host_stats.getStat(NUM_HOST_TO_ALL));
@@ -191,6 +211,28 @@ void Backend::dump_stats() {
   printf("Tests %llu\n", host_stats.getStat(NUM_HOST_TEST));
   printf("SHMEM_PTR %llu\n", host_stats.getStat(NUM_HOST_SHMEM_PTR));
   printf("SyncAll %llu\n", host_stats.getStat(NUM_HOST_SYNC_ALL));
+  printf("Alltoall %llu\n", host_stats.getStat(NUM_HOST_ALLTOALL));
+  printf("Alltoallv %llu\n", host_stats.getStat(NUM_HOST_ALLTOALLV));
+  printf("Fcollect %llu\n", host_stats.getStat(NUM_HOST_FCOLLECT));
+
+  rocshmem_heap_stats_t heap_stats;
+  heap.get_stats(&heap_stats);
+  printf("HEAP STATS\n");
+  printf("Bytes (Used/Free/HighWater) %zu/%zu/%zu\n", heap_stats.used_bytes,
+         heap_stats.free_bytes, heap_stats.high_water_bytes);
+  printf("Largest Free Block %zu\n", heap_stats.largest_free_block);
+  printf("Segments %zu\n", heap_stats.num_segments);
+  printf("Allocs (Succeeded/Failed) %zu/%zu\n", heap_stats.num_allocs,
+         heap_stats.num_failed_allocs);
+  printf("Frees %zu\n", heap_stats.num_frees);
+  printf("Rates per second (Alloc/Free) %.1f/%.1f\n",
+         heap_stats.allocs_per_second, heap_stats.frees_per_second);
+  for (int k{0}; k < ROCSHMEM_HEAP_STATS_NUM_SIZE_CLASSES; k++) {
+    if (heap_stats.allocated_blocks[k] || heap_stats.free_blocks[k]) {
+      printf("Blocks of 2^%d bytes (Allocated/Free) %zu/%zu\n", k,
+             heap_stats.allocated_blocks[k], heap_stats.free_blocks[k]);
+    }
+  }
 
   dump_backend_stats();
 }
@@ -198,6 +240,7 @@ void Backend::dump_stats() {
 void Backend::reset_stats() {
   globalStats.resetStats();
   globalHostStats.resetStats();
+  heap.reset_stats();
 
   reset_backend_stats();
 }
@@ -33,6 +33,7 @@
 
 #include <mpi.h>
 
+#include <mutex>  // NOLINT(build/c++11)
 #include <vector>
 
 #include "rocshmem_config.h"  // NOLINT(build/include_subdir)
@@ -86,6 +87,8 @@ class Backend {
    * @param[in] num_pes Number of PEs in this team.
    * @param[in] my_pe_in_new_team Index of this PE in the new team.
    * @param[in] team_comm MPI communicator for this team.
+   * @param[in] config Configuration requested for the team, may be null.
+   * @param[in] config_mask Fields of config to use.
    *
    * @param[out] new_team pointer to the new team.
    */
@@ -93,6 +96,8 @@ class Backend {
                                TeamInfo* team_info_wrt_parent,
                                TeamInfo* team_info_wrt_world, int num_pes,
                                int my_pe_in_new_team, MPI_Comm team_comm,
+                               const rocshmem_team_config_t* config,
+                               long config_mask,  // NOLINT(runtime/int)
                                rocshmem_team_t* new_team) = 0;
 
   /**
@@ -186,6 +191,33 @@ class Backend {
    */
   virtual void ctx_destroy(Context* ctx) = 0;
 
+  /**
+   * @brief Adds a symmetric heap segment which can hold a request.
+   *
+   * The segment is made reachable through every transport used by
+   * the backend before this method returns.
+   *
+   * @param[in] size Number of bytes of the request which did not fit.
+   *
+   * @return True if the heap grew, false if the backend cannot grow it.
+   *
+   * @note Collective across all processing elements.
+   */
+  virtual bool grow_heap(size_t size);
+
+  /**
+   * @brief Registers a host function which device threads can trigger.
+   *
+   * @param[in] fn Host function to run.
+   * @param[in] user_data Passed unchanged to every invocation of fn.
+   * @param[in] flags ROCSHMEM_HOST_CALLBACK_PROXY or
+   * ROCSHMEM_HOST_CALLBACK_HANDOFF.
+   *
+   * @return Callback id, or -1 if the backend has no host proxy to run it.
+   */
+  virtual int register_host_callback(rocshmem_host_callback_t fn,
+                                     void* user_data, int flags);
+
   /**
    * @brief High level device stats that do not depend on backend type.
    */
@@ -295,6 +327,11 @@ class Backend {
    * @brief List of ctxs created by the user.
    */
   std::vector<Context*> list_of_ctxs{};
+
+  /**
+   * @brief Serializes host threads creating and destroying ctxs.
+   */
+  std::mutex list_of_ctxs_mutex{};
 };
 
 /**
@@ -135,6 +135,9 @@ class Context {
 
   __device__ void* shmem_ptr(const void* dest, int pe);
 
+  __device__ void host_callback(int id, const uint64_t* args, int nargs,
+                                uint64_t* sig_addr, uint64_t signal);
+
   __device__ void barrier_all();
 
   __device__ void sync_all();
@@ -206,6 +209,14 @@ class Context {
   template <typename T>
   __device__ void get_nbi(T* dest, const T* source, size_t nelems, int pe);
 
+  template <typename T>
+  __device__ void iput(T* dest, const T* source, ptrdiff_t dst,
+                       ptrdiff_t sst, size_t nelems, int pe);
+
+  template <typename T>
+  __device__ void iget(T* dest, const T* source, ptrdiff_t dst,
+                       ptrdiff_t sst, size_t nelems, int pe);
+
   template <typename T>
   __device__ void alltoall(rocshmem_team_t team, T* dest, const T* source,
                            int nelems);
@@ -223,6 +234,22 @@ class Context {
                             int pe_start, int log_pe_stride, int pe_size,
                             long* p_sync);  // NOLINT(runtime/int)
 
+  template <typename T, ROCSHMEM_OP Op>
+  __device__ int reduce_grid(rocshmem_team_t team, T* dest, const T* source,
+                             int nreduce);
+
+  template <typename T>
+  __device__ void broadcast_grid(rocshmem_team_t team, T* dest,
+                                 const T* source, int nelems, int pe_root);
+
+  template <typename T>
+  __device__ void alltoall_grid(rocshmem_team_t team, T* dest,
+                                const T* source, int nelems);
+
+  template <typename T>
+  __device__ void fcollect_grid(rocshmem_team_t team, T* dest,
+                                const T* source, int nelems);
+
   __device__ void putmem_wg(void* dest, const void* source, size_t nelems,
                             int pe);
 
@@ -271,6 +298,14 @@ class Context {
   template <typename T>
   __device__ void get_nbi_wave(T* dest, const T* source, size_t nelems, int pe);
 
+  template <typename T>
+  __device__ void iput_wave(T* dest, const T* source, ptrdiff_t dst,
+                            ptrdiff_t sst, size_t nelems, int pe);
+
+  template <typename T>
+  __device__ void iget_wave(T* dest, const T* source, ptrdiff_t dst,
+                            ptrdiff_t sst, size_t nelems, int pe);
+
 #define CONTEXT_PUTMEM_SIGNAL_DEC(SUFFIX)                                              \
   __device__ void putmem_signal##SUFFIX(void *dest, const void *source, size_t nelems, \
                                         uint64_t *sig_addr, uint64_t signal, int sig_op, int pe);
@@ -319,6 +354,14 @@ class Context {
   template <typename T>
   __host__ void get_nbi(T* dest, const T* source, size_t nelems, int pe);
 
+  template <typename T>
+  __host__ void iput(T* dest, const T* source, ptrdiff_t dst, ptrdiff_t sst,
+                     size_t nelems, int pe);
+
+  template <typename T>
+  __host__ void iget(T* dest, const T* source, ptrdiff_t dst, ptrdiff_t sst,
+                     size_t nelems, int pe);
+
   __host__ void putmem(void* dest, const void* source, size_t nelems, int pe);
 
   __host__ void getmem(void* dest, const void* source, size_t nelems, int pe);
@@ -328,6 +371,8 @@ class Context {
 
   __host__ void getmem_nbi(void* dest, const void* source, size_t size, int pe);
 
+  __host__ void batch(const rocshmem_batch_op_t* ops, size_t nops);
+
   template <typename T>
   __host__ void amo_add(void* dst, T value, int pe);
 
@@ -372,6 +417,12 @@ class Context {
 
   __host__ void sync_all();
 
+  __host__ void barrier_all_nbi(rocshmem_request_t* request);
+
+  __host__ int test_request(rocshmem_request_t* request);
+
+  __host__ void wait_request(rocshmem_request_t* request);
+
   template <typename T>
   __host__ void broadcast(T* dest, const T* source, int nelems, int pe_root,
                           int pe_start, int log_pe_stride, int pe_size,
@@ -389,6 +440,29 @@ class Context {
   template <typename T, ROCSHMEM_OP Op>
   __host__ int reduce(rocshmem_team_t team, T* dest, const T* source, int nreduce);
 
+  template <typename T>
+  __host__ void broadcast_nbi(rocshmem_team_t team, T* dest, const T* source,
+                              int nelems, int pe_root,
+                              rocshmem_request_t* request);
+
+  template <typename T, ROCSHMEM_OP Op>
+  __host__ int reduce_nbi(rocshmem_team_t team, T* dest, const T* source,
+                          int nreduce, rocshmem_request_t* request);
+
+  template <typename T>
+  __host__ void alltoall(rocshmem_team_t team, T* dest, const T* source,
+                         int nelems);
+
+  template <typename T>
+  __host__ void alltoallv(rocshmem_team_t team, T* dest,
+                          const int* dest_counts, const int* dest_displs,
+                          const T* source, const int* source_counts,
+                          const int* source_displs);
+
+  template <typename T>
+  __host__ void fcollect(rocshmem_team_t team, T* dest, const T* source,
+                         int nelems);
+
   template <typename T>
   __host__ void wait_until(T *ivars, int cmp, T val);
 
@@ -142,6 +142,13 @@ __device__ void* Context::shmem_ptr(const void* dest, int pe) {
   DISPATCH_RET_PTR(shmem_ptr(dest, pe));
 }
 
+__device__ void Context::host_callback(int id, const uint64_t* args, int nargs,
+                                       uint64_t* sig_addr, uint64_t signal) {
+  ctxStats.incStat(NUM_HOST_CALLBACK);
+
+  DISPATCH(host_callback(id, args, nargs, sig_addr, signal));
+}
+
 __device__ void Context::barrier_all() {
   ctxStats.incStat(NUM_BARRIER_ALL);
 
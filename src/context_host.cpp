@@ -79,6 +79,16 @@ __host__ void Context::getmem_nbi(void* dest, const void* source, size_t nelems,
   HOST_DISPATCH(getmem_nbi(dest, source, nelems, pe));
 }
 
+__host__ void Context::batch(const rocshmem_batch_op_t* ops, size_t nops) {
+  if (nops == 0) {
+    return;
+  }
+
+  ctxHostStats.incStat(NUM_HOST_BATCH);
+
+  HOST_DISPATCH(batch(ops, nops));
+}
+
 __host__ void Context::fence() {
   ctxHostStats.incStat(NUM_HOST_FENCE);
 
@@ -103,4 +113,18 @@ __host__ void Context::barrier_all() {
   HOST_DISPATCH(barrier_all());
 }
 
+__host__ void Context::barrier_all_nbi(rocshmem_request_t *request) {
+  ctxHostStats.incStat(NUM_HOST_BARRIER_ALL);
+
+  HOST_DISPATCH(barrier_all_nbi(request));
+}
+
+__host__ int Context::test_request(rocshmem_request_t *request) {
+  HOST_DISPATCH_RET(test_request(request));
+}
+
+__host__ void Context::wait_request(rocshmem_request_t *request) {
+  HOST_DISPATCH(wait_request(request));
+}
+
 }  // namespace rocshmem
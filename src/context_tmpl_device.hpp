@@ -139,6 +139,30 @@ __device__ void Context::get_nbi(T *dest, const T *source, size_t nelems,
   DISPATCH(get_nbi(dest, source, nelems, pe));
 }
 
+template <typename T>
+__device__ void Context::iput(T *dest, const T *source, ptrdiff_t dst,
+                              ptrdiff_t sst, size_t nelems, int pe) {
+  if (nelems == 0) {
+    return;
+  }
+
+  ctxStats.incStat(NUM_IPUT);
+
+  DISPATCH(iput(dest, source, dst, sst, nelems, pe));
+}
+
+template <typename T>
+__device__ void Context::iget(T *dest, const T *source, ptrdiff_t dst,
+                              ptrdiff_t sst, size_t nelems, int pe) {
+  if (nelems == 0) {
+    return;
+  }
+
+  ctxStats.incStat(NUM_IGET);
+
+  DISPATCH(iget(dest, source, dst, sst, nelems, pe));
+}
+
 template <typename T>
 __device__ void Context::alltoall(rocshmem_team_t team, T *dest,
                                   const T *source, int nelems) {
@@ -198,6 +222,67 @@ __device__ void Context::broadcast(T *dest, const T *source, int nelems,
                         pe_size, p_sync));
 }
 
+/*
+ * The grid variants are entered by every workgroup of the grid; the
+ * collective is counted once, by the first one.
+ */
+template <typename T, ROCSHMEM_OP Op>
+__device__ int Context::reduce_grid(rocshmem_team_t team, T *dest,
+                                    const T *source, int nreduce) {
+  if (nreduce == 0) {
+    return ROCSHMEM_SUCCESS;
+  }
+
+  if (get_flat_grid_id() == 0 && is_thread_zero_in_block()) {
+    ctxStats.incStat(NUM_TO_ALL);
+  }
+
+  DISPATCH_RET(reduce_grid<PAIR(T, Op)>(team, dest, source, nreduce));
+}
+
+template <typename T>
+__device__ void Context::broadcast_grid(rocshmem_team_t team, T *dest,
+                                        const T *source, int nelems,
+                                        int pe_root) {
+  if (nelems == 0) {
+    return;
+  }
+
+  if (get_flat_grid_id() == 0 && is_thread_zero_in_block()) {
+    ctxStats.incStat(NUM_BROADCAST);
+  }
+
+  DISPATCH(broadcast_grid<T>(team, dest, source, nelems, pe_root));
+}
+
+template <typename T>
+__device__ void Context::alltoall_grid(rocshmem_team_t team, T *dest,
+                                       const T *source, int nelems) {
+  if (nelems == 0) {
+    return;
+  }
+
+  if (get_flat_grid_id() == 0 && is_thread_zero_in_block()) {
+    ctxStats.incStat(NUM_ALLTOALL);
+  }
+
+  DISPATCH(alltoall_grid<T>(team, dest, source, nelems));
+}
+
+template <typename T>
+__device__ void Context::fcollect_grid(rocshmem_team_t team, T *dest,
+                                       const T *source, int nelems) {
+  if (nelems == 0) {
+    return;
+  }
+
+  if (get_flat_grid_id() == 0 && is_thread_zero_in_block()) {
+    ctxStats.incStat(NUM_FCOLLECT);
+  }
+
+  DISPATCH(fcollect_grid<T>(team, dest, source, nelems));
+}
+
 template <typename T>
 __device__ __forceinline__ void Context::wait_until(T *ivars, int cmp,
                                                     T val) {
@@ -472,6 +557,30 @@ __device__ void Context::get_nbi_wave(T *dest, const T *source, size_t nelems,
   DISPATCH(get_nbi_wave(dest, source, nelems, pe));
 }
 
+template <typename T>
+__device__ void Context::iput_wave(T *dest, const T *source, ptrdiff_t dst,
+                                   ptrdiff_t sst, size_t nelems, int pe) {
+  if (nelems == 0) {
+    return;
+  }
+
+  ctxStats.incStat(NUM_IPUT_WAVE);
+
+  DISPATCH(iput_wave(dest, source, dst, sst, nelems, pe));
+}
+
+template <typename T>
+__device__ void Context::iget_wave(T *dest, const T *source, ptrdiff_t dst,
+                                   ptrdiff_t sst, size_t nelems, int pe) {
+  if (nelems == 0) {
+    return;
+  }
+
+  ctxStats.incStat(NUM_IGET_WAVE);
+
+  DISPATCH(iget_wave(dest, source, dst, sst, nelems, pe));
+}
+
 template <typename T>
 __device__ T Context::amo_fetch_add(void *dst, T value, int pe) {
   ctxStats.incStat(NUM_ATOMIC_FADD);
@@ -94,6 +94,30 @@ __host__ void Context::get_nbi(T *dest, const T *source, size_t nelems,
   HOST_DISPATCH(get_nbi(dest, source, nelems, pe));
 }
 
+template <typename T>
+__host__ void Context::iput(T *dest, const T *source, ptrdiff_t dst,
+                            ptrdiff_t sst, size_t nelems, int pe) {
+  if (nelems == 0) {
+    return;
+  }
+
+  ctxHostStats.incStat(NUM_HOST_IPUT);
+
+  HOST_DISPATCH(iput(dest, source, dst, sst, nelems, pe));
+}
+
+template <typename T>
+__host__ void Context::iget(T *dest, const T *source, ptrdiff_t dst,
+                            ptrdiff_t sst, size_t nelems, int pe) {
+  if (nelems == 0) {
+    return;
+  }
+
+  ctxHostStats.incStat(NUM_HOST_IGET);
+
+  HOST_DISPATCH(iget(dest, source, dst, sst, nelems, pe));
+}
+
 template <typename T>
 __host__ T Context::amo_fetch_add(void *dst, T value, int pe) {
   ctxHostStats.incStat(NUM_HOST_ATOMIC_FADD);
@@ -233,6 +257,72 @@ __host__ int Context::reduce(rocshmem_team_t team, T *dest, const T *source,
   HOST_DISPATCH_RET(reduce<PAIR(T, Op)>(team, dest, source, nreduce));
 }
 
+template <typename T>
+__host__ void Context::broadcast_nbi(rocshmem_team_t team, T *dest,
+                                     const T *source, int nelems, int pe_root,
+                                     rocshmem_request_t *request) {
+  if (nelems == 0) {
+    *request = ROCSHMEM_REQUEST_NULL;
+    return;
+  }
+
+  ctxHostStats.incStat(NUM_HOST_BROADCAST);
+
+  HOST_DISPATCH(broadcast_nbi<T>(team, dest, source, nelems, pe_root,
+                                 request));
+}
+
+template <typename T, ROCSHMEM_OP Op>
+__host__ int Context::reduce_nbi(rocshmem_team_t team, T *dest,
+                                 const T *source, int nreduce,
+                                 rocshmem_request_t *request) {
+  if (nreduce == 0) {
+    *request = ROCSHMEM_REQUEST_NULL;
+    return ROCSHMEM_SUCCESS;
+  }
+
+  ctxHostStats.incStat(NUM_HOST_TO_ALL);
+
+  HOST_DISPATCH_RET(reduce_nbi<PAIR(T, Op)>(team, dest, source, nreduce,
+                                            request));
+}
+
+template <typename T>
+__host__ void Context::alltoall(rocshmem_team_t team, T *dest,
+                                const T *source, int nelems) {
+  if (nelems == 0) {
+    return;
+  }
+
+  ctxHostStats.incStat(NUM_HOST_ALLTOALL);
+
+  HOST_DISPATCH(alltoall<T>(team, dest, source, nelems));
+}
+
+template <typename T>
+__host__ void Context::alltoallv(rocshmem_team_t team, T *dest,
+                                 const int *dest_counts,
+                                 const int *dest_displs, const T *source,
+                                 const int *source_counts,
+                                 const int *source_displs) {
+  ctxHostStats.incStat(NUM_HOST_ALLTOALLV);
+
+  HOST_DISPATCH(alltoallv<T>(team, dest, dest_counts, dest_displs, source,
+                             source_counts, source_displs));
+}
+
+template <typename T>
+__host__ void Context::fcollect(rocshmem_team_t team, T *dest,
+                                const T *source, int nelems) {
+  if (nelems == 0) {
+    return;
+  }
+
+  ctxHostStats.incStat(NUM_HOST_FCOLLECT);
+
+  HOST_DISPATCH(fcollect<T>(team, dest, source, nelems));
+}
+
 template <typename T>
 __host__ void Context::wait_until(T *ivars, int cmp, T val) {
   ctxHostStats.incStat(NUM_HOST_WAIT_UNTIL);
@@ -203,6 +203,9 @@ void GPUIBBackend::create_new_team([[maybe_unused]] Team *parent_team,
                                    TeamInfo *team_info_wrt_parent,
                                    TeamInfo *team_info_wrt_world, int num_pes,
                                    int my_pe_in_new_team, MPI_Comm team_comm,
+                                   [[maybe_unused]]
+                                   const rocshmem_team_config_t *config,
+                                   [[maybe_unused]] long config_mask,  // NOLINT
                                    rocshmem_team_t *new_team) {
   /**
    * Read the bit mask and find out a common index into
@@ -256,13 +259,14 @@ void GPUIBBackend::dump_backend_stats() {
 void GPUIBBackend::reset_backend_stats() { networkImpl.reset_backend_stats(); }
 
 void GPUIBBackend::initialize_ipc() {
-  ipcImpl.ipcHostInit(my_pe, heap.get_heap_bases(), thread_comm);
+  ipcImpl.ipcHostInit(my_pe, heap.get_heap_bases(), heap.get_base_size(),
+                      thread_comm);
 }
 
 void GPUIBBackend::initialize_network() { networkImpl.networkHostSetup(this); }
 
 void GPUIBBackend::setup_default_host_ctx() {
-  default_host_ctx_ = new GPUIBHostContext(this, 0);
+  default_host_ctx_ = new GPUIBHostContext(this, ROCSHMEM_CTX_SHARED);
   ROCSHMEM_HOST_CTX_DEFAULT.ctx_opaque = default_host_ctx_;
 }
 
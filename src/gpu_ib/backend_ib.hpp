@@ -72,6 +72,8 @@ class GPUIBBackend : public Backend {
   void create_new_team(Team *parent_team, TeamInfo *team_info_wrt_parent,
                        TeamInfo *team_info_wrt_world, int num_pes,
                        int my_pe_in_new_team, MPI_Comm team_comm,
+                       const rocshmem_team_config_t *config,
+                       long config_mask,  // NOLINT(runtime/int)
                        rocshmem_team_t *new_team) override;
 
   /**
@@ -156,6 +156,14 @@ __device__ void *GPUIBContext::shmem_ptr(const void *dest, int pe) {
   return ret;
 }
 
+__device__ void GPUIBContext::host_callback(int id, const uint64_t *args,
+                                            int nargs, uint64_t *sig_addr,
+                                            uint64_t signal) {
+  // No host proxy serves this backend; registration returns -1 instead.
+  GPU_DPRINTF("Host callbacks are not supported by gpu_ib.\n");
+  assert(false);
+}
+
 __device__ void GPUIBContext::threadfence_system() {
   int thread_id = get_flat_block_id();
 
@@ -24,6 +24,7 @@
 #define LIBRARY_SRC_GPU_IB_CONTEXT_IB_DEVICE_HPP_
 
 #include "../context.hpp"
+#include "../sync/allreduce_schedule.hpp"
 #include "memory_builder_policy.hpp"
 #include "network_policy.hpp"
 
@@ -65,6 +66,9 @@ class GPUIBContext : public Context {
 
   __device__ void *shmem_ptr(const void *dest, int pe);
 
+  __device__ void host_callback(int id, const uint64_t *args, int nargs,
+                                uint64_t *sig_addr, uint64_t signal);
+
   __device__ void barrier_all();
 
   __device__ void sync_all();
@@ -134,6 +138,14 @@ class GPUIBContext : public Context {
   template <typename T>
   __device__ void get_nbi(T *dest, const T *source, size_t nelems, int pe);
 
+  template <typename T>
+  __device__ void iput(T *dest, const T *source, ptrdiff_t dst, ptrdiff_t sst,
+                       size_t nelems, int pe);
+
+  template <typename T>
+  __device__ void iget(T *dest, const T *source, ptrdiff_t dst, ptrdiff_t sst,
+                       size_t nelems, int pe);
+
   template <typename T>
   __device__ void broadcast(rocshmem_team_t team, T *dest, const T *source,
                             int nelems, int pe_root);
@@ -183,6 +195,22 @@ class GPUIBContext : public Context {
   __device__ void fcollect_gcen2(rocshmem_team_t team, T *dest,
                                  const T *source, int nelems);
 
+  template <typename T, ROCSHMEM_OP Op>
+  __device__ int reduce_grid(rocshmem_team_t team, T *dest, const T *source,
+                             int nreduce);
+
+  template <typename T>
+  __device__ void broadcast_grid(rocshmem_team_t team, T *dest,
+                                 const T *source, int nelems, int pe_root);
+
+  template <typename T>
+  __device__ void alltoall_grid(rocshmem_team_t team, T *dest,
+                                const T *source, int nelems);
+
+  template <typename T>
+  __device__ void fcollect_grid(rocshmem_team_t team, T *dest,
+                                const T *source, int nelems);
+
   __device__ void putmem_wg(void *dest, const void *source, size_t nelems,
                             int pe);
 
@@ -231,6 +259,14 @@ class GPUIBContext : public Context {
   template <typename T>
   __device__ void get_nbi_wave(T *dest, const T *source, size_t nelems, int pe);
 
+  template <typename T>
+  __device__ void iput_wave(T *dest, const T *source, ptrdiff_t dst,
+                            ptrdiff_t sst, size_t nelems, int pe);
+
+  template <typename T>
+  __device__ void iget_wave(T *dest, const T *source, ptrdiff_t dst,
+                            ptrdiff_t sst, size_t nelems, int pe);
+
  private:
   template <typename T, ROCSHMEM_OP Op>
   __device__ void internal_direct_allreduce(
@@ -246,6 +282,12 @@ class GPUIBContext : public Context {
                                           int n_seg, int seg_size,
                                           int chunk_size);
 
+  template <typename T, ROCSHMEM_OP Op>
+  __device__ void internal_scheduled_allreduce(
+      T *dst, const T *src, int nelems, int PE_start, int logPE_stride,
+      int PE_size, T *pWrk, long *pSync,  // NOLINT(runtime/int)
+      AllreduceAlgorithm algo);
+
   template <typename T>
   __device__ void internal_put_broadcast(T *dst, const T *src, int nelems,
                                          int pe_root, int PE_start,
@@ -260,8 +302,12 @@ class GPUIBContext : public Context {
   __device__ void internal_direct_barrier(int pe, int PE_start, int stride,
                                           int n_pes, int64_t *pSync);
 
-  __device__ void internal_atomic_barrier(int pe, int PE_start, int stride,
-                                          int n_pes, int64_t *pSync);
+  __device__ void internal_tree_barrier(int pe, int PE_start, int stride,
+                                        int n_pes, int64_t *pSync);
+
+  __device__ void internal_dissemination_barrier(int pe, int PE_start,
+                                                 int stride, int n_pes,
+                                                 int64_t *pSync);
 
   __device__ void internal_sync(int pe, int PE_start, int stride, int PE_size,
                                 int64_t *pSync);
@@ -24,6 +24,7 @@
 #include "../context_incl.hpp"
 #include "context_ib_tmpl_device.hpp"
 #include "../util.hpp"
+#include "../sync/barrier_schedule.hpp"
 
 namespace rocshmem {
 
@@ -54,23 +55,60 @@ __device__ void GPUIBContext::internal_direct_barrier(int pe, int PE_start,
   }
 }
 
-__device__ void GPUIBContext::internal_atomic_barrier(int pe, int PE_start,
-                                                      int stride, int n_pes,
-                                                      int64_t *pSync) {
+__device__ void GPUIBContext::internal_tree_barrier(int pe, int PE_start,
+                                                    int stride, int n_pes,
+                                                    int64_t *pSync) {
   int64_t flag_val = 1;
-  if (pe == PE_start) {
-    wait_until(&pSync[0], ROCSHMEM_CMP_EQ, (int64_t)(n_pes - 1));
-    pSync[0] = ROCSHMEM_SYNC_VALUE;
-    threadfence_system();
-    for (size_t i = 1, j = PE_start + stride; i < n_pes; ++i, j += stride) {
-      put_nbi(&pSync[0], &flag_val, 1, j);
-    }
-  } else {
-    amo_add<int64_t>(&pSync[0], flag_val, PE_start);
-    wait_until(&pSync[0], ROCSHMEM_CMP_EQ, flag_val);
-    pSync[0] = ROCSHMEM_SYNC_VALUE;
+  int rank = (pe - PE_start) / stride;
+  int num_children = tree_num_children(rank, BARRIER_TREE_RADIX, n_pes);
+
+  // Wait until the whole subtree has arrived
+  for (int i = 0; i < num_children; i++) {
+    wait_until(&pSync[BARRIER_TREE_ARRIVAL_SLOT + i], ROCSHMEM_CMP_EQ,
+               flag_val);
+    pSync[BARRIER_TREE_ARRIVAL_SLOT + i] = ROCSHMEM_SYNC_VALUE;
+  }
+  threadfence_system();
+
+  if (rank != 0) {
+    int parent = PE_start + tree_parent(rank, BARRIER_TREE_RADIX) * stride;
+    int slot = BARRIER_TREE_ARRIVAL_SLOT +
+               tree_child_index(rank, BARRIER_TREE_RADIX);
+    put_nbi(&pSync[slot], &flag_val, 1, parent);
+    wait_until(&pSync[BARRIER_TREE_RELEASE_SLOT], ROCSHMEM_CMP_EQ, flag_val);
+    pSync[BARRIER_TREE_RELEASE_SLOT] = ROCSHMEM_SYNC_VALUE;
     threadfence_system();
   }
+
+  // Release the children
+  int child = tree_first_child(rank, BARRIER_TREE_RADIX);
+  for (int i = 0; i < num_children; i++, child++) {
+    put_nbi(&pSync[BARRIER_TREE_RELEASE_SLOT], &flag_val, 1,
+            PE_start + child * stride);
+  }
+}
+
+__device__ void GPUIBContext::internal_dissemination_barrier(int pe,
+                                                             int PE_start,
+                                                             int stride,
+                                                             int n_pes,
+                                                             int64_t *pSync) {
+  int rank = (pe - PE_start) / stride;
+  int rounds = dissemination_rounds(n_pes);
+
+  /*
+   * The round flags count signals instead of being set and reset: a
+   * neighbour which already left this barrier may signal the same round
+   * of the next one before we have consumed this one. The consuming
+   * decrement is fetching so it has landed before the slot is polled again.
+   */
+  for (int round = 0; round < rounds; round++) {
+    int to = PE_start + dissemination_to(rank, round, n_pes) * stride;
+    amo_add<int64_t>(&pSync[round], 1, to);
+    wait_until(&pSync[round], ROCSHMEM_CMP_GE, (int64_t)1);
+    amo_fetch_add<int64_t>(&pSync[round], -1, pe);
+  }
+  threadfence_system();
 }
 
 // Uses PE values that are relative to world
@@ -78,10 +116,18 @@ __device__ void GPUIBContext::internal_sync(int pe, int PE_start, int stride,
                                             int PE_size, int64_t *pSync) {
   __syncthreads();
   if (is_thread_zero_in_block()) {
-    if (PE_size < 64) {
-      internal_direct_barrier(pe, PE_start, stride, PE_size, pSync);
-    } else {
-      internal_atomic_barrier(pe, PE_start, stride, PE_size, pSync);
+    switch (barrier_kind(PE_size)) {
+      case BarrierKind::DIRECT:
+        internal_direct_barrier(pe, PE_start, stride, PE_size, pSync);
+        break;
+      case BarrierKind::TREE:
+        internal_tree_barrier(pe, PE_start, stride, PE_size, pSync);
+        break;
+      case BarrierKind::DISSEMINATION:
+        internal_dissemination_barrier(pe, PE_start, stride, PE_size, pSync);
+        break;
+      case BarrierKind::AUTO:
+        break;
     }
   }
   __threadfence();
@@ -33,13 +33,13 @@
 namespace rocshmem {
 
 __host__ GPUIBHostContext::GPUIBHostContext(Backend *backend,
-                                            [[maybe_unused]] int64_t options)
+                                            int64_t options)
     : Context(backend, true) {
   GPUIBBackend *b{static_cast<GPUIBBackend *>(backend)};
 
   host_interface = b->host_interface;
 
-  context_window_info = host_interface->acquire_window_context();
+  context_window_info = host_interface->acquire_window_context(options);
 }
 
 __host__ GPUIBHostContext::~GPUIBHostContext() {
@@ -56,6 +56,11 @@ __host__ void GPUIBHostContext::getmem_nbi(void *dest, const void *source,
   host_interface->getmem_nbi(dest, source, nelems, pe, context_window_info);
 }
 
+__host__ void GPUIBHostContext::batch(const rocshmem_batch_op_t *ops,
+                                      size_t nops) {
+  host_interface->batch(ops, nops, context_window_info);
+}
+
 __host__ void GPUIBHostContext::putmem(void *dest, const void *source,
                                        size_t nelems, int pe) {
   host_interface->putmem(dest, source, nelems, pe, context_window_info);
@@ -82,4 +87,16 @@ __host__ void GPUIBHostContext::barrier_all() {
   host_interface->barrier_all(context_window_info);
 }
 
+__host__ void GPUIBHostContext::barrier_all_nbi(rocshmem_request_t *request) {
+  host_interface->barrier_all_nbi(context_window_info, request);
+}
+
+__host__ int GPUIBHostContext::test_request(rocshmem_request_t *request) {
+  return HostInterface::test_request(request);
+}
+
+__host__ void GPUIBHostContext::wait_request(rocshmem_request_t *request) {
+  HostInterface::wait_request(request);
+}
+
 }  // namespace rocshmem
@@ -165,6 +165,80 @@ __device__ void GPUIBContext::internal_direct_allreduce(
   __syncthreads();
 }
 
+/*
+ * Recursive doubling and Rabenseifner allreduce, driven by the step
+ * schedule of allreduce_schedule.hpp shared with the IPC conduit.
+ */
+template <typename T, ROCSHMEM_OP Op>
+__device__ void GPUIBContext::internal_scheduled_allreduce(
+    T *dst, const T *src, int nelems, int PE_start, int logPE_stride,
+    int PE_size, T *pWrk, long *pSync,  // NOLINT(runtime/int)
+    AllreduceAlgorithm algo) {
+  int rank = (my_pe - PE_start) >> logPE_stride;
+  int num_steps = allreduce_num_steps(algo, PE_size);
+  int pass_elems = allreduce_pass_elems(algo, PE_size,
+                                        ROCSHMEM_REDUCE_MIN_WRKDATA_SIZE);
+  int wrk_half = ROCSHMEM_REDUCE_MIN_WRKDATA_SIZE / 2;
+
+  int wg_size = get_flat_block_size();
+  int wg_id = get_flat_block_id();
+
+  for (int i = wg_id; i < nelems; i += wg_size) {
+    dst[i] = src[i];
+  }
+  __syncthreads();
+
+  for (int base = 0, pass = 0; base < nelems; base += pass_elems, pass++) {
+    int count = min(pass_elems, nelems - base);
+    int parity = pass & 1;
+    T *wrk = &pWrk[parity * wrk_half];
+
+    for (int step = 0; step < num_steps; step++) {
+      AllreduceStep s = allreduce_step(algo, rank, PE_size, count, step);
+      if (s.peer < 0) {
+        continue;
+      }
+      int peer = PE_start + (s.peer << logPE_stride);
+      long *flag = &pSync[parity * num_steps + step];  // NOLINT(runtime/int)
+
+      if (s.sends) {
+        T *target = s.reduce ? &wrk[s.wrk_offset]
+                             : &dst[base + s.send_offset];
+        putmem_nbi_wg(target, &dst[base + s.send_offset],
+                      s.send_count * sizeof(T), peer);
+
+        if (is_thread_zero_in_block()) {
+          /*
+           * Recursive doubling combines into the range it just sent, so
+           * the put has to complete locally before the reduction.
+           */
+          if (algo == AllreduceAlgorithm::RECURSIVE_DOUBLING) {
+            quiet();
+          } else {
+            fence();
+          }
+          p(flag, 1L, peer);
+        }
+      }
+
+      if (s.recvs) {
+        if (is_thread_zero_in_block()) {
+          wait_until(flag, ROCSHMEM_CMP_EQ, 1L);
+          *flag = ROCSHMEM_SYNC_VALUE;
+          __threadfence();
+        }
+        __syncthreads();
+        if (s.reduce) {
+          compute_reduce<T, Op>(&wrk[s.wrk_offset],
+                                &dst[base + s.recv_offset], s.recv_count,
+                                wg_id, wg_size);
+        }
+      }
+      __syncthreads();
+    }
+  }
+}
+
 template <typename T, ROCSHMEM_OP Op>
 __device__ void GPUIBContext::to_all(rocshmem_team_t team, T *dest,
                                      const T *source, int nreduce) {
@@ -203,12 +277,16 @@ __device__ void GPUIBContext::to_all(T *dest, const T *source, int nreduce,
       max(nreduce / 2 + 1, ROCSHMEM_REDUCE_MIN_WRKDATA_SIZE);
   size_t provided_pSync = ROCSHMEM_REDUCE_SYNC_SIZE;
 
-  // TODO(bpotter):
-  // We basically do a direct reduce if pWrk is big enough, else we
-  // give up. In the future we will want to design algorithms to work
-  // with nreduce/2 + 1 space, which would cover every case per the
-  // standard.
-  if (provided_pWrk >= direct_pWrk && provided_pSync >= direct_pSync) {
+  AllreduceAlgorithm algo = allreduce_select(
+      PE_size, nreduce, sizeof(T), ROCSHMEM_REDUCE_MIN_WRKDATA_SIZE,
+      ROCSHMEM_REDUCE_SYNC_SIZE);
+
+  if (algo == AllreduceAlgorithm::RECURSIVE_DOUBLING ||
+      algo == AllreduceAlgorithm::RABENSEIFNER) {
+    internal_scheduled_allreduce<T, Op>(dest, source, nreduce, PE_start,
+                                        logPE_stride, PE_size, pWrk, pSync,
+                                        algo);
+  } else if (provided_pWrk >= direct_pWrk && provided_pSync >= direct_pSync) {
     internal_direct_allreduce<T, Op>(dest, source, nreduce, PE_start,
                                      logPE_stride, PE_size, pWrk, pSync);
   } else {
@@ -292,6 +370,28 @@ __device__ void GPUIBContext::get_nbi(T *dest, const T *source, size_t nelems,
   getmem_nbi(dest, source, sizeof(T) * nelems, pe);
 }
 
+/*
+ * The queue pairs have no strided work request, so every element is its
+ * own non-blocking transfer and a single quiet completes the whole batch.
+ */
+template <typename T>
+__device__ void GPUIBContext::iput(T *dest, const T *source, ptrdiff_t dst,
+                                   ptrdiff_t sst, size_t nelems, int pe) {
+  for (size_t i = 0; i < nelems; i++) {
+    putmem_nbi(dest + i * dst, source + i * sst, sizeof(T), pe);
+  }
+  quiet();
+}
+
+template <typename T>
+__device__ void GPUIBContext::iget(T *dest, const T *source, ptrdiff_t dst,
+                                   ptrdiff_t sst, size_t nelems, int pe) {
+  for (size_t i = 0; i < nelems; i++) {
+    getmem_nbi(dest + i * dst, source + i * sst, sizeof(T), pe);
+  }
+  quiet();
+}
+
 template <typename T>
 __device__ T GPUIBContext::amo_fetch_add(void *dst, T value, int pe) {
   uint64_t L_offset = reinterpret_cast<char *>(dst) - base_heap[my_pe];
@@ -1092,6 +1192,52 @@ __device__ void GPUIBContext::get_nbi_wave(T *dest, const T *source,
   getmem_nbi_wave(dest, source, nelems * sizeof(T), pe);
 }
 
+template <typename T>
+__device__ void GPUIBContext::iput_wave(T *dest, const T *source,
+                                        ptrdiff_t dst, ptrdiff_t sst,
+                                        size_t nelems, int pe) {
+  if (is_thread_zero_in_wave()) {
+    iput(dest, source, dst, sst, nelems, pe);
+  }
+}
+
+template <typename T>
+__device__ void GPUIBContext::iget_wave(T *dest, const T *source,
+                                        ptrdiff_t dst, ptrdiff_t sst,
+                                        size_t nelems, int pe) {
+  if (is_thread_zero_in_wave()) {
+    iget(dest, source, dst, sst, nelems, pe);
+  }
+}
+
+// Grid collectives are only implemented by the IPC conduit
+template <typename T, ROCSHMEM_OP Op>
+__device__ int GPUIBContext::reduce_grid(rocshmem_team_t team, T *dest,
+                                         const T *source, int nreduce) {
+  GPU_DPRINTF("Grid collectives are not supported by gpu_ib.\n");
+  assert(false);
+  return ROCSHMEM_ERROR;
+}
+
+template <typename T>
+__device__ void GPUIBContext::broadcast_grid(rocshmem_team_t team, T *dest,
+                                             const T *source, int nelems,
+                                             int pe_root) {
+  assert(false);
+}
+
+template <typename T>
+__device__ void GPUIBContext::alltoall_grid(rocshmem_team_t team, T *dest,
+                                            const T *source, int nelems) {
+  assert(false);
+}
+
+template <typename T>
+__device__ void GPUIBContext::fcollect_grid(rocshmem_team_t team, T *dest,
+                                            const T *source, int nelems) {
+  assert(false);
+}
+
 }  // namespace rocshmem
 
 #endif  // LIBRARY_SRC_GPU_IB_CONTEXT_IB_TMPL_DEVICE_HPP_
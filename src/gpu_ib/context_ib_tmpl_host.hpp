@@ -62,6 +62,20 @@ __host__ void GPUIBHostContext::get_nbi(T *dest, const T *source, size_t nelems,
   host_interface->get_nbi<T>(dest, source, nelems, pe, context_window_info);
 }
 
+template <typename T>
+__host__ void GPUIBHostContext::iput(T *dest, const T *source, ptrdiff_t dst,
+                                     ptrdiff_t sst, size_t nelems, int pe) {
+  host_interface->iput<T>(dest, source, dst, sst, nelems, pe,
+                          context_window_info);
+}
+
+template <typename T>
+__host__ void GPUIBHostContext::iget(T *dest, const T *source, ptrdiff_t dst,
+                                     ptrdiff_t sst, size_t nelems, int pe) {
+  host_interface->iget<T>(dest, source, dst, sst, nelems, pe,
+                          context_window_info);
+}
+
 template <typename T>
 __host__ void GPUIBHostContext::amo_add(void *dst, T value, int pe) {
   host_interface->amo_add(dst, value, pe, context_window_info);
@@ -114,6 +128,48 @@ __host__ void GPUIBHostContext::to_all(rocshmem_team_t team, T *dest,
   host_interface->to_all<T, Op>(team, dest, source, nreduce);
 }
 
+template <typename T>
+__host__ void GPUIBHostContext::broadcast_nbi(rocshmem_team_t team, T *dest,
+                                              const T *source, int nelems,
+                                              int pe_root,
+                                              rocshmem_request_t *request) {
+  host_interface->broadcast_nbi<T>(team, dest, source, nelems, pe_root,
+                                   request);
+}
+
+template <typename T, ROCSHMEM_OP Op>
+__host__ int GPUIBHostContext::reduce_nbi(rocshmem_team_t team, T *dest,
+                                          const T *source, int nreduce,
+                                          rocshmem_request_t *request) {
+  return host_interface->reduce_nbi<T, Op>(team, dest, source, nreduce,
+                                            request);
+}
+
+template <typename T>
+__host__ void GPUIBHostContext::alltoall(rocshmem_team_t team, T *dest,
+                                         const T *source, int nelems) {
+  host_interface->alltoall<T>(team, dest, source, nelems,
+                              context_window_info);
+}
+
+template <typename T>
+__host__ void GPUIBHostContext::alltoallv(rocshmem_team_t team, T *dest,
+                                          const int *dest_counts,
+                                          const int *dest_displs,
+                                          const T *source,
+                                          const int *source_counts,
+                                          const int *source_displs) {
+  host_interface->alltoallv<T>(team, dest, dest_counts, dest_displs, source,
+                               source_counts, source_displs);
+}
+
+template <typename T>
+__host__ void GPUIBHostContext::fcollect(rocshmem_team_t team, T *dest,
+                                         const T *source, int nelems) {
+  host_interface->fcollect<T>(team, dest, source, nelems,
+                              context_window_info);
+}
+
 template <typename T>
 __host__ void GPUIBHostContext::wait_until(T *ivars, int cmp, T val) {
   host_interface->wait_until<T>(ivars, cmp, val, context_window_info);
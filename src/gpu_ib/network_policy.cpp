@@ -317,7 +317,7 @@ __host__ void NetworkOnImpl::networkHostSetup(GPUIBBackend *B) {
   exchange_hdp_info(B->hdp_policy, B->thread_comm);
 
   const auto &heap_bases{B->heap.get_heap_bases()};
-  heap_memory_rkey(heap_bases[my_pe], B->heap.get_size(), B->thread_comm,
+  heap_memory_rkey(heap_bases[my_pe], B->heap.get_base_size(), B->thread_comm,
                    B->heap.is_managed());
   // The earliest we can allow the main thread to launch a kernel to
   // avoid potential deadlock
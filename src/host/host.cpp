@@ -24,6 +24,10 @@
 
 #include <mpi.h>
 
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
 #include "rocshmem_config.h"  // NOLINT(build/include_subdir)
 #include "host_helpers.hpp"
 #include "../memory/window_info.hpp"
@@ -33,53 +37,70 @@ namespace rocshmem {
 
 __host__ HostContextWindowInfo::HostContextWindowInfo(MPI_Comm comm_world,
                                                       SymmetricHeap* heap) {
-  window_info_ =
-      new WindowInfo(comm_world, heap->get_local_heap_base(), heap->get_size());
+  MPI_Comm_dup(comm_world, &comm_);
+  window_info_ = heap->create_window_info(comm_);
 }
 
 __host__ HostContextWindowInfo::~HostContextWindowInfo() {
   delete window_info_;
+  MPI_Comm_free(&comm_);
 }
 
-WindowInfo* HostInterface::acquire_window_context() {
-  auto index{find_avail_pool_entry()};
+__host__ void HostContextWindowInfo::enable_put_aggregation(
+    size_t buffer_size, size_t max_put_size) {
+  if (!put_aggregator_) {
+    put_aggregator_ =
+        std::make_unique<PutAggregator>(buffer_size, max_put_size);
+  }
+  window_info_->set_put_aggregator(put_aggregator_.get());
+}
 
-  HostContextWindowInfo* acquired_win_info = host_window_context_pool_[index];
+__host__ void HostContextWindowInfo::disable_put_aggregation() {
+  if (put_aggregator_) {
+    put_aggregator_->ship_all(window_info_);
+  }
+  window_info_->set_put_aggregator(nullptr);
+}
 
-  acquired_win_info->mark_unavail();
+WindowInfo* HostInterface::acquire_window_context(int64_t options) {
+  auto index{avail_pool_entries_->pop()};
 
-  return acquired_win_info->get();
-}
+  /* Entry should have been available; consider this as an error. */
+  assert(index >= 0);
 
-__host__ void HostInterface::release_window_context(WindowInfo* window_info) {
-  auto index{find_win_info_in_pool(window_info)};
+  HostContextWindowInfo* acquired_win_info = host_window_context_pool_[index];
 
-  host_window_context_pool_[index]->mark_avail();
-}
+  /* Only shared contexts pay for locking the dirty PE set */
+  bool shared{(options & ROCSHMEM_CTX_SHARED) != 0};
+  acquired_win_info->get()->get_dirty_pes()->set_shared(shared);
 
-int HostInterface::find_avail_pool_entry() {
-  for (int i{0}; i < max_num_ctxs_; i++) {
-    if (host_window_context_pool_[i]->is_avail()) {
-      return i;
-    }
+  /*
+   * The staging buffers are not synchronized, so a shared context never
+   * aggregates; its puts go straight to the window.
+   */
+  if ((options & ROCSHMEM_CTX_AGGREGATE) && !shared) {
+    acquired_win_info->enable_put_aggregation(aggregate_buffer_size_,
+                                              aggregate_max_put_size_);
   }
-  /* Entry should have been available; consider this as an error. */
-  assert(false);
-  return -1;
+
+  return acquired_win_info->get();
 }
 
-int HostInterface::find_win_info_in_pool(WindowInfo* window_info) {
-  for (int i{0}; i < max_num_ctxs_; i++) {
-    if (host_window_context_pool_[i]->is_avail()) {
-      continue;
-    }
-    if (window_info == host_window_context_pool_[i]->get()) {
-      return i;
-    }
+__host__ void HostInterface::attach_segment(SymmetricHeap* heap,
+                                            int segment) {
+  for (int ctx_i = 0; ctx_i < max_num_ctxs_; ctx_i++) {
+    heap->attach_segment(host_window_context_pool_[ctx_i]->get(), segment);
   }
+}
+
+__host__ void HostInterface::release_window_context(WindowInfo* window_info) {
+  auto it{pool_index_.find(window_info)};
+
   /* Entry should have been present; consider this as an error. */
-  assert(false);
-  return -1;
+  assert(it != pool_index_.end());
+
+  host_window_context_pool_[it->second]->disable_put_aggregation();
+  avail_pool_entries_->push(it->second);
 }
 
 __host__ HostInterface::HostInterface(HdpPolicy* hdp_policy,
@@ -107,6 +128,27 @@ __host__ HostInterface::HostInterface(HdpPolicy* hdp_policy,
     max_num_ctxs_ = atoi(value);
   }
 
+  /*
+   * Fall back to polling through MPI for MPI libraries that cannot cope
+   * with the host reading the window memory directly
+   */
+  if ((value = getenv("ROCSHMEM_HOST_WAIT_USE_MPI"))) {
+    wait_local_load_ = !atoi(value);
+  }
+
+  if ((value = getenv("ROCSHMEM_CTX_AGGREGATE_BUFFER_SIZE"))) {
+    aggregate_buffer_size_ = strtoul(value, nullptr, 0);
+  }
+  if ((value = getenv("ROCSHMEM_CTX_AGGREGATE_MAX_PUT_SIZE"))) {
+    aggregate_max_put_size_ = strtoul(value, nullptr, 0);
+  }
+  aggregate_max_put_size_ =
+      std::min(aggregate_max_put_size_, aggregate_buffer_size_);
+
+  if ((value = getenv("ROCSHMEM_HOST_COLL_RMA_THRESHOLD"))) {
+    coll_rma_threshold_ = strtoul(value, nullptr, 0);
+  }
+
   size_t pool_size = max_num_ctxs_ * sizeof(HostContextWindowInfo*);
   host_window_context_pool_ =
       reinterpret_cast<HostContextWindowInfo**>(malloc(pool_size));
@@ -114,7 +156,9 @@ __host__ HostInterface::HostInterface(HdpPolicy* hdp_policy,
   for (int ctx_i = 0; ctx_i < max_num_ctxs_; ctx_i++) {
     host_window_context_pool_[ctx_i] =
         new HostContextWindowInfo(host_comm_world_, heap);
+    pool_index_[host_window_context_pool_[ctx_i]->get()] = ctx_i;
   }
+  avail_pool_entries_ = std::make_unique<IndexFreeList>(max_num_ctxs_);
 
 #if !defined(USE_COHERENT_HEAP) && !defined(USE_SINGLE_NODE)
   // The single node implementation needs a different path since
@@ -162,29 +206,134 @@ __host__ HostInterface::~HostInterface() {
 __host__ void HostInterface::putmem_nbi(void* dest, const void* source,
                                         size_t nelems, int pe,
                                         WindowInfo* window_info) {
+  if (stage_put(dest, source, nelems, pe, window_info)) {
+    return;
+  }
+
   initiate_put(dest, source, nelems, pe, window_info);
 }
 
 __host__ void HostInterface::getmem_nbi(void* dest, const void* source,
                                         size_t nelems, int pe,
                                         WindowInfo* window_info) {
+  ship_staged_puts(pe, window_info);
+
   initiate_get(dest, source, nelems, pe, window_info);
 }
 
+__host__ void HostInterface::batch(const rocshmem_batch_op_t* ops, size_t nops,
+                                   WindowInfo* window_info) {
+  /* Gets in the batch must observe puts staged before it */
+  ship_all_staged_puts(window_info);
+
+  auto remote_addr = [](const rocshmem_batch_op_t& op) {
+    return reinterpret_cast<const char*>(op.op == ROCSHMEM_BATCH_PUT
+                                             ? op.dest : op.source);
+  };
+  auto local_addr = [](const rocshmem_batch_op_t& op) {
+    return reinterpret_cast<const char*>(op.op == ROCSHMEM_BATCH_PUT
+                                             ? op.source : op.dest);
+  };
+
+  /*
+   * Group the batch by target PE and direction, in remote address order,
+   * so adjacent transfers can be merged into a single MPI call. Transfers
+   * to the same remote address keep their batch order.
+   */
+  std::vector<size_t> order(nops);
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+    if (ops[a].pe != ops[b].pe) {
+      return ops[a].pe < ops[b].pe;
+    }
+    if (ops[a].op != ops[b].op) {
+      return ops[a].op < ops[b].op;
+    }
+    return remote_addr(ops[a]) < remote_addr(ops[b]);
+  });
+
+  /*
+   * The GPU may have written the sources of the puts; one HDP flush
+   * covers the whole batch.
+   */
+  hdp_policy_->hdp_flush();
+
+  bool fetched{false};
+  size_t i{0};
+  while (i < nops) {
+    const rocshmem_batch_op_t& first{ops[order[i]]};
+    const char* remote{remote_addr(first)};
+    const char* local{local_addr(first)};
+    size_t nbytes{first.nbytes};
+
+    /*
+     * Absorb the following transfers that are contiguous on both sides
+     * and stay in the segment of the first one
+     */
+    const char* remote_end{window_info->get_segment_end(remote)};
+    size_t next{i + 1};
+    for (; next < nops; next++) {
+      const rocshmem_batch_op_t& op{ops[order[next]]};
+      if (op.pe != first.pe || op.op != first.op ||
+          remote_addr(op) != remote + nbytes ||
+          local_addr(op) != local + nbytes ||
+          op.nbytes > static_cast<size_t>(remote_end - remote) - nbytes) {
+        break;
+      }
+      nbytes += op.nbytes;
+    }
+    i = next;
+
+    if (nbytes == 0) {
+      continue;
+    }
+
+    assert(remote + nbytes <= remote_end);
+    MPI_Win win{window_info->get_win(remote)};
+    MPI_Aint offset{window_info->get_offset(remote, first.pe)};
+
+    if (first.op == ROCSHMEM_BATCH_PUT) {
+      MPI_Put(local, nbytes, MPI_CHAR, first.pe, offset, nbytes, MPI_CHAR,
+              win);
+      window_info->get_dirty_pes()->mark_written(first.pe);
+    } else {
+      MPI_Get(const_cast<char*>(local), nbytes, MPI_CHAR, first.pe, offset,
+              nbytes, MPI_CHAR, win);
+      fetched = true;
+    }
+  }
+
+  /* One local completion for every target instead of one per transfer */
+  window_info->for_each_win([](MPI_Win win) {
+    MPI_Win_flush_local_all(win);
+  });
+
+  if (fetched) {
+    hdp_policy_->hdp_flush();
+  }
+}
+
 __host__ void HostInterface::putmem(void* dest, const void* source,
                                     size_t nelems, int pe,
                                     WindowInfo* window_info) {
+  /* The source is copied, so a staged put is already locally complete */
+  if (stage_put(dest, source, nelems, pe, window_info)) {
+    return;
+  }
+
   initiate_put(dest, source, nelems, pe, window_info);
 
-  MPI_Win_flush_local(pe, window_info->get_win());
+  MPI_Win_flush_local(pe, window_info->get_win(dest));
 }
 
 __host__ void HostInterface::getmem(void* dest, const void* source,
                                     size_t nelems, int pe,
                                     WindowInfo* window_info) {
+  ship_staged_puts(pe, window_info);
+
   initiate_get(dest, source, nelems, pe, window_info);
 
-  MPI_Win_flush_local(pe, window_info->get_win());
+  MPI_Win_flush_local(pe, window_info->get_win(source));
 
   /*
    * Flush local HDP to ensure that the NIC's write
@@ -194,7 +343,9 @@ __host__ void HostInterface::getmem(void* dest, const void* source,
 }
 
 __host__ void HostInterface::fence(WindowInfo* window_info) {
-  complete_all(window_info->get_win());
+  ship_all_staged_puts(window_info);
+
+  complete_all(window_info);
 
   /*
    * Flush my HDP and the HDPs of remote GPUs.
@@ -206,23 +357,25 @@ __host__ void HostInterface::fence(WindowInfo* window_info) {
    * after those before the flush.
    */
   hdp_policy_->hdp_flush();
-  flush_remote_hdps();
+  flush_remote_hdps(window_info);
 
   return;
 }
 
 __host__ void HostInterface::quiet(WindowInfo* window_info) {
-  complete_all(window_info->get_win());
+  ship_all_staged_puts(window_info);
+
+  complete_all(window_info);
 
   /* Same explanation as in fence */
   hdp_policy_->hdp_flush();
-  flush_remote_hdps();
+  flush_remote_hdps(window_info);
 
   return;
 }
 
 __host__ void HostInterface::sync_all(WindowInfo* window_info) {
-  MPI_Win_sync(window_info->get_win());
+  window_info->for_each_win([](MPI_Win win) { MPI_Win_sync(win); });
 
   hdp_policy_->hdp_flush();
   /*
@@ -231,13 +384,15 @@ __host__ void HostInterface::sync_all(WindowInfo* window_info) {
    * participating.
    */
 
-  MPI_Barrier(host_comm_world_);
+  MPI_Barrier(window_info->get_comm());
 
   return;
 }
 
 __host__ void HostInterface::barrier_all(WindowInfo* window_info) {
-  complete_all(window_info->get_win());
+  ship_all_staged_puts(window_info);
+
+  complete_all(window_info);
 
   /*
    * Flush my HDP cache so remote NICs will
@@ -245,7 +400,46 @@ __host__ void HostInterface::barrier_all(WindowInfo* window_info) {
    */
   hdp_policy_->hdp_flush();
 
-  MPI_Barrier(host_comm_world_);
+  MPI_Barrier(window_info->get_comm());
+}
+
+__host__ void HostInterface::barrier_all_nbi(WindowInfo* window_info,
+                                             rocshmem_request_t* request) {
+  ship_all_staged_puts(window_info);
+
+  complete_all(window_info);
+
+  hdp_policy_->hdp_flush();
+
+  *request = new rocshmem_request_opaque;
+  MPI_Ibarrier(window_info->get_comm(), &(*request)->mpi_request);
+}
+
+__host__ int HostInterface::test_request(rocshmem_request_t* request) {
+  if (*request == ROCSHMEM_REQUEST_NULL) {
+    return 1;
+  }
+
+  int flag{0};
+  MPI_Test(&(*request)->mpi_request, &flag, MPI_STATUS_IGNORE);
+  if (!flag) {
+    return 0;
+  }
+
+  delete *request;
+  *request = ROCSHMEM_REQUEST_NULL;
+  return 1;
+}
+
+__host__ void HostInterface::wait_request(rocshmem_request_t* request) {
+  if (*request == ROCSHMEM_REQUEST_NULL) {
+    return;
+  }
+
+  MPI_Wait(&(*request)->mpi_request, MPI_STATUS_IGNORE);
+
+  delete *request;
+  *request = ROCSHMEM_REQUEST_NULL;
 }
 
 __host__ void HostInterface::barrier_for_sync() {
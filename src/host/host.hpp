@@ -35,14 +35,27 @@
 #include <mpi.h>
 
 #include <map>
+#include <memory>
+#include <unordered_map>
 
 #include "rocshmem/rocshmem.hpp"
 #include "../hdp_policy.hpp"
 #include "../memory/symmetric_heap.hpp"
 #include "../memory/window_info.hpp"
+#include "index_free_list.hpp"
+#include "put_aggregator.hpp"
 
 namespace rocshmem {
 
+class Team;
+
+/**
+ * @brief Backing state of a rocshmem_request_t
+ */
+struct rocshmem_request_opaque {
+  MPI_Request mpi_request{MPI_REQUEST_NULL};
+};
+
 class HostContextWindowInfo {
  public:
   /**
@@ -53,8 +66,11 @@ class HostContextWindowInfo {
   /**
    * @brief Constructor with initialized members
    *
-   * @param[in] team pointer used to track team info
-   * @param[in] team_info information about participating PEs
+   * Collective over comm_world: duplicates it and creates the window of
+   * the context on the duplicate.
+   *
+   * @param[in] comm_world communicator spanning all PEs
+   * @param[in] heap symmetric heap exposed through the window
    */
   HostContextWindowInfo(MPI_Comm comm_world, SymmetricHeap* heap);
 
@@ -71,32 +87,36 @@ class HostContextWindowInfo {
   WindowInfo* get() { return window_info_; }
 
   /**
-   * @brief Mark the window info as avaialable (not allocated)
-   */
-  void mark_avail() { avail_ = true; }
-
-  /**
-   * @brief Mark the window info as unavaialble (allocated)
+   * @brief Stage small puts through this window until the next release
+   *
+   * @param[in] buffer_size capacity in bytes of each staging buffer
+   * @param[in] max_put_size largest put which is staged
    */
-  void mark_unavail() { avail_ = false; }
+  void enable_put_aggregation(size_t buffer_size, size_t max_put_size);
 
   /**
-   * @brief Check if the window info has been allocated
+   * @brief Ship any staged puts and stop staging puts through this window
    */
-  bool is_avail() { return avail_; }
+  void disable_put_aggregation();
 
  private:
   /**
-   * @brief Flag to state whether or not this window is available to be assigned
-   * to a Host Context
+   * @brief Communicator owned by this window, so that threads driving
+   * different contexts do not share MPI communicator state
    */
-  bool avail_{true};
+  MPI_Comm comm_{MPI_COMM_NULL};
 
   /**
    * @brief Pointer to the WindowInfo object that manages the MPI Window for
    * this context
    */
   WindowInfo* window_info_{nullptr};
+
+  /**
+   * @brief Staging buffers used while the window belongs to a context
+   * created with ROCSHMEM_CTX_AGGREGATE
+   */
+  std::unique_ptr<PutAggregator> put_aggregator_{nullptr};
 };
 
 class HostInterface {
@@ -122,15 +142,25 @@ class HostInterface {
   /**
    * @brief Get a window context from the pool
    *
+   * @param[in] options context creation options (ROCSHMEM_CTX_*)
+   *
    * @return Pointer to the WindowInfo in the allocated one from the pool
    */
-  WindowInfo* acquire_window_context();
+  WindowInfo* acquire_window_context(int64_t options = 0);
 
   /**
    * @brief Return a window context back to the pool
    */
   void release_window_context(WindowInfo* window_info);
 
+  /**
+   * @brief Attach a segment added to the heap to every window in the pool
+   *
+   * @param[in] heap symmetric heap the windows were created over
+   * @param[in] segment index of the new segment
+   */
+  __host__ void attach_segment(SymmetricHeap* heap, int segment);
+
   /**************************************************************************
    ***************************** HOST FUNCTIONS *****************************
    *************************************************************************/
@@ -156,6 +186,14 @@ class HostInterface {
   __host__ void get_nbi(T* dest, const T* source, size_t nelems, int pe,
                         WindowInfo* window_info);
 
+  template <typename T>
+  __host__ void iput(T* dest, const T* source, ptrdiff_t dst, ptrdiff_t sst,
+                     size_t nelems, int pe, WindowInfo* window_info);
+
+  template <typename T>
+  __host__ void iget(T* dest, const T* source, ptrdiff_t dst, ptrdiff_t sst,
+                     size_t nelems, int pe, WindowInfo* window_info);
+
   __host__ void putmem(void* dest, const void* source, size_t nelems, int pe,
                        WindowInfo* window_info);
 
@@ -168,6 +206,9 @@ class HostInterface {
   __host__ void getmem_nbi(void* dest, const void* source, size_t size, int pe,
                            WindowInfo* window_info);
 
+  __host__ void batch(const rocshmem_batch_op_t* ops, size_t nops,
+                      WindowInfo* window_info);
+
   template <typename T>
   __host__ void amo_add(void* dst, T value, int pe, WindowInfo* window_info);
 
@@ -192,6 +233,25 @@ class HostInterface {
 
   __host__ void sync_all(WindowInfo* window_info);
 
+  __host__ void barrier_all_nbi(WindowInfo* window_info,
+                                rocshmem_request_t* request);
+
+  /**
+   * @brief Completes a non-blocking collective if it has finished.
+   *
+   * @param[in, out] request Handle; released and nulled on completion.
+   *
+   * @return 1 if the collective has completed, 0 otherwise
+   */
+  __host__ static int test_request(rocshmem_request_t* request);
+
+  /**
+   * @brief Blocks until a non-blocking collective completes.
+   *
+   * @param[in, out] request Handle; released and nulled on return.
+   */
+  __host__ static void wait_request(rocshmem_request_t* request);
+
   template <typename T>
   __host__ void broadcast(T* dest, const T* source, int nelems, int pe_root,
                           int pe_start, int log_pe_stride, int pe_size,
@@ -209,6 +269,29 @@ class HostInterface {
   template <typename T, ROCSHMEM_OP Op>
   __host__ int reduce(rocshmem_team_t team, T* dest, const T* source, int nreduce);
 
+  template <typename T>
+  __host__ void broadcast_nbi(rocshmem_team_t team, T* dest, const T* source,
+                              int nelems, int pe_root,
+                              rocshmem_request_t* request);
+
+  template <typename T, ROCSHMEM_OP Op>
+  __host__ int reduce_nbi(rocshmem_team_t team, T* dest, const T* source,
+                          int nreduce, rocshmem_request_t* request);
+
+  template <typename T>
+  __host__ void alltoall(rocshmem_team_t team, T* dest, const T* source,
+                         int nelems, WindowInfo* window_info);
+
+  template <typename T>
+  __host__ void alltoallv(rocshmem_team_t team, T* dest,
+                          const int* dest_counts, const int* dest_displs,
+                          const T* source, const int* source_counts,
+                          const int* source_displs);
+
+  template <typename T>
+  __host__ void fcollect(rocshmem_team_t team, T* dest, const T* source,
+                         int nelems, WindowInfo* window_info);
+
   template <typename T>
   __host__ void wait_until(T *ivars, int cmp, T val,
                            WindowInfo* window_info);
@@ -254,16 +337,26 @@ class HostInterface {
   /**************************************************************************
    **************************** INTERNAL METHODS ****************************
    *************************************************************************/
-  __host__ void flush_remote_hdps() {
+  /**
+   * @brief Flushes the HDPs of the PEs targeted through a window since the
+   * last completion point and starts a new epoch
+   *
+   * @param[in] window_info window whose dirty PEs are flushed
+   */
+  __host__ void flush_remote_hdps(WindowInfo* window_info) {
+    std::vector<int> dirty_pes{window_info->get_dirty_pes()->take()};
 #ifndef USE_COHERENT_HEAP
     unsigned flush_val{HdpPolicy::HDP_FLUSH_VAL};
-    for (size_t i{0}; i < num_pes_; i++) {
-      if (i == my_pe_) {
-        continue;
+    for (int pe : dirty_pes) {
+      if (pe != my_pe_) {
+        MPI_Put(&flush_val, 1, MPI_UNSIGNED, pe, 0, 1, MPI_UNSIGNED, hdp_win);
+      }
+    }
+    for (int pe : dirty_pes) {
+      if (pe != my_pe_) {
+        MPI_Win_flush(pe, hdp_win);
       }
-      MPI_Put(&flush_val, 1, MPI_UNSIGNED, i, 0, 1, MPI_UNSIGNED, hdp_win);
     }
-    MPI_Win_flush_all(hdp_win);
 #endif // USE_COHERENT_HEAP
   }
 
@@ -281,10 +374,14 @@ class HostInterface {
   __host__ void initiate_get(void* dest, const void* source, size_t nelems,
                              int pe, WindowInfo* window_info);
 
-  __host__ void complete_all(MPI_Win win);
+  __host__ bool stage_put(void* dest, const void* source, size_t nelems,
+                          int pe, WindowInfo* window_info);
 
-  __host__ MPI_Aint compute_offset(const void* dest, void* win_start,
-                                   void* win_end);
+  __host__ void ship_staged_puts(int pe, WindowInfo* window_info);
+
+  __host__ void ship_all_staged_puts(WindowInfo* window_info);
+
+  __host__ void complete_all(WindowInfo* window_info);
 
   __host__ MPI_Comm get_mpi_comm(int pe_start, int log_pe_stride, int pe_size);
 
@@ -293,20 +390,63 @@ class HostInterface {
   template <typename T>
   __host__ MPI_Datatype get_mpi_type();
 
+  template <typename T>
+  __host__ MPI_Datatype get_strided_type(size_t nelems, ptrdiff_t stride);
+
   template <typename T>
   __host__ int compare(int cmp, T input_val, T target_val);
 
   template <typename T>
-  __host__ int test_and_compare(MPI_Aint offset, MPI_Datatype mpi_type,
-                                int cmp, T val, MPI_Win win);
+  __host__ const T* fetch_ivars(T* ivars, size_t nelems, T* buffer,
+                                bool refresh, WindowInfo* window_info);
+
+  template <typename T>
+  __host__ T load_ivar(T* ivar, bool refresh, WindowInfo* window_info);
+
+  template <typename T, typename DONE_T>
+  __host__ size_t wait_until_scan(T* ivars, size_t nelems, const int* status,
+                                  int cmp, T val, const T* vals, uint8_t* hits,
+                                  WindowInfo* window_info, DONE_T done);
+
+  template <typename T>
+  __host__ void wait_until_all_internal(T* ivars, size_t nelems,
+                                        const int* status, int cmp, T val,
+                                        const T* vals,
+                                        WindowInfo* window_info);
+
+  template <typename T>
+  __host__ size_t wait_until_any_internal(T* ivars, size_t nelems,
+                                          const int* status, int cmp, T val,
+                                          const T* vals,
+                                          WindowInfo* window_info);
+
+  template <typename T>
+  __host__ size_t wait_until_some_internal(T* ivars, size_t nelems,
+                                           size_t* indices, const int* status,
+                                           int cmp, T val, const T* vals,
+                                           WindowInfo* window_info);
 
   template <typename T, ROCSHMEM_OP Op>
   __host__ void to_all_internal(MPI_Comm mpi_comm, T* dest, const T* source,
-                                int nreduce);
+                                int nreduce,
+                                rocshmem_request_t* request = nullptr);
 
   template <typename T>
   __host__ void broadcast_internal(MPI_Comm mpi_comm, T* dest, const T* source,
-                                   int nelems, int pe_root);
+                                   int nelems, int pe_root,
+                                   rocshmem_request_t* request = nullptr);
+
+  /**
+   * @brief Exchanges blocks of a team collective with window puts
+   *
+   * Every PE puts nelems elements from source + (fcollect ? 0 : j * nelems)
+   * to dest + my_pe * nelems on each team member j, then completes the puts
+   * and synchronizes the team.
+   */
+  template <typename T>
+  __host__ void exchange_blocks_rma(Team* team_obj, T* dest, const T* source,
+                                    int nelems, bool fcollect,
+                                    WindowInfo* window_info);
 
   /**************************************************************************
    **************************** INTERNAL MEMBERS ****************************
@@ -338,6 +478,30 @@ class HostInterface {
   MPI_Win hdp_win;
 #endif  // USE_COHERENT_HEAP
 
+  /**
+   * @brief Read this PE's ivars in place while waiting instead of
+   * fetching them through MPI
+   */
+  bool wait_local_load_{true};
+
+  /**
+   * @brief Capacity in bytes of each per-PE staging buffer of contexts
+   * created with ROCSHMEM_CTX_AGGREGATE
+   */
+  size_t aggregate_buffer_size_{64 * 1024};
+
+  /**
+   * @brief Largest put staged by contexts created with
+   * ROCSHMEM_CTX_AGGREGATE
+   */
+  size_t aggregate_max_put_size_{256};
+
+  /**
+   * @brief Largest per-PE block in bytes that host alltoall and fcollect
+   * exchange with window puts instead of an MPI collective
+   */
+  size_t coll_rma_threshold_{1024};
+
   /**
    * @brief Max number of contexts for the application
    */
@@ -348,9 +512,18 @@ class HostInterface {
    */
   HostContextWindowInfo** host_window_context_pool_{nullptr};
 
-  int find_win_info_in_pool(WindowInfo* window_info);
+  /**
+   * @brief Indices of the pool entries not held by a context
+   */
+  std::unique_ptr<IndexFreeList> avail_pool_entries_{nullptr};
 
-  int find_avail_pool_entry();
+  /**
+   * @brief Pool index of each pool entry's WindowInfo
+   *
+   * Filled in by the constructor and read-only afterwards, so lookups from
+   * concurrent threads need no synchronization.
+   */
+  std::unordered_map<WindowInfo*, int> pool_index_;
 
   /*
    * @brief Used by comm_map map for active sets.
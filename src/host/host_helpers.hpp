@@ -28,36 +28,20 @@
 
 namespace rocshmem {
 
-__host__ inline MPI_Aint HostInterface::compute_offset(
-    const void* dest, void* win_start, [[maybe_unused]] void* win_end) {
-  assert((reinterpret_cast<char*>(const_cast<void*>(dest)) >=
-          reinterpret_cast<char*>(win_start)) &&
-         (reinterpret_cast<char*>(const_cast<void*>(dest)) <
-          reinterpret_cast<char*>(win_end)));
-
-  MPI_Aint dest_disp{};
-  MPI_Aint start_disp{};
-
-  MPI_Get_address(dest, &dest_disp);
-  MPI_Get_address(win_start, &start_disp);
-
-  return MPI_Aint_diff(dest_disp, start_disp);
-}
-
-__host__ inline void HostInterface::complete_all(MPI_Win win) {
-  MPI_Win_flush_all(win); /* RMA operations */
-  MPI_Win_sync(win);      /* memory stores */
+__host__ inline void HostInterface::complete_all(WindowInfo* window_info) {
+  window_info->for_each_win([](MPI_Win win) {
+    MPI_Win_flush_all(win); /* RMA operations */
+    MPI_Win_sync(win);      /* memory stores */
+  });
 }
 
 __host__ inline void HostInterface::initiate_put(void* dest, const void* source,
                                                  size_t nelems, int pe,
                                                  WindowInfo* window_info) {
-  MPI_Win win{window_info->get_win()};
-  void* win_start{window_info->get_start()};
-  void* win_end{window_info->get_end()};
+  MPI_Win win{window_info->get_win(dest)};
 
-  /* Calculate offset of remote dest from base address of window */
-  MPI_Aint offset{compute_offset(dest, win_start, win_end)};
+  /* Calculate displacement of remote dest in the window */
+  MPI_Aint offset{window_info->get_offset(dest, pe)};
 
   /*
    * Current semantics of our API restrict the buffers
@@ -71,22 +55,64 @@ __host__ inline void HostInterface::initiate_put(void* dest, const void* source,
 
   /* Offload remote write operation to MPI */
   MPI_Put(source, nelems, MPI_CHAR, pe, offset, nelems, MPI_CHAR, win);
+
+  /* Remember the target so fence and quiet flush only its HDP */
+  window_info->get_dirty_pes()->mark_written(pe);
 }
 
 __host__ inline void HostInterface::initiate_get(void* dest, const void* source,
                                                  size_t nelems, int pe,
                                                  WindowInfo* window_info) {
-  MPI_Win win{window_info->get_win()};
-  void* win_start{window_info->get_start()};
-  void* win_end{window_info->get_end()};
+  MPI_Win win{window_info->get_win(source)};
 
-  /* Calculate offset of remote source from base address of window */
-  MPI_Aint offset = compute_offset(source, win_start, win_end);
+  /* Calculate displacement of remote source in the window */
+  MPI_Aint offset{window_info->get_offset(source, pe)};
 
   /* Offload remote fetch operation to MPI */
   MPI_Get(dest, nelems, MPI_CHAR, pe, offset, nelems, MPI_CHAR, win);
 }
 
+__host__ inline bool HostInterface::stage_put(void* dest, const void* source,
+                                              size_t nelems, int pe,
+                                              WindowInfo* window_info) {
+  PutAggregator* aggregator{window_info->get_put_aggregator()};
+  /* Records are shipped through the window of the initial segment */
+  if (!aggregator || !window_info->in_base(dest)) {
+    return false;
+  }
+  if (!aggregator->accepts(nelems)) {
+    /* Puts staged earlier must not land after this one */
+    aggregator->ship(pe, window_info);
+    return false;
+  }
+
+  /*
+   * A source on the symmetric heap may have been written by the GPU,
+   * so flush the HDP before the CPU copies it into the staging buffer.
+   */
+  if (window_info->contains(source)) {
+    hdp_policy_->hdp_flush();
+  }
+
+  MPI_Aint offset{window_info->get_offset(dest, pe)};
+  aggregator->stage(pe, offset, source, nelems, window_info);
+  return true;
+}
+
+__host__ inline void HostInterface::ship_staged_puts(int pe,
+                                                     WindowInfo* window_info) {
+  if (PutAggregator* aggregator{window_info->get_put_aggregator()}) {
+    aggregator->ship(pe, window_info);
+  }
+}
+
+__host__ inline void HostInterface::ship_all_staged_puts(
+    WindowInfo* window_info) {
+  if (PutAggregator* aggregator{window_info->get_put_aggregator()}) {
+    aggregator->ship_all(window_info);
+  }
+}
+
 }  // namespace rocshmem
 
 #endif  // LIBRARY_SRC_HOST_HOST_HELPERS_HPP_
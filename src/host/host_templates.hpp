@@ -22,10 +22,13 @@
 #ifndef LIBRARY_SRC_HOST_HOST_TEMPLATES_HPP_
 #define LIBRARY_SRC_HOST_HOST_TEMPLATES_HPP_
 
+#include <algorithm>
 #include <utility>
+#include <vector>
 
 #include "rocshmem_config.h"  // NOLINT(build/include_subdir)
 #include "host_helpers.hpp"
+#include "host_wait.hpp"
 #include "../memory/window_info.hpp"
 #include "../team.hpp"
 
@@ -66,7 +69,7 @@ __host__ T HostInterface::g(const T* source, int pe, WindowInfo* window_info) {
    */
   getmem_nbi(&ret, source, sizeof(T), pe, window_info);
 
-  MPI_Win_flush_local(pe, window_info->get_win());
+  MPI_Win_flush_local(pe, window_info->get_win(source));
 
   return ret;
 }
@@ -85,6 +88,61 @@ __host__ void HostInterface::get_nbi(T* dest, const T* source, size_t nelems,
   getmem_nbi(dest, source, sizeof(T) * nelems, pe, window_info);
 }
 
+template <typename T>
+__host__ void HostInterface::iput(T* dest, const T* source, ptrdiff_t dst,
+                                  ptrdiff_t sst, size_t nelems, int pe,
+                                  WindowInfo* window_info) {
+  DPRINTF("Function: host_iput\n");
+
+  /* Puts staged earlier must not land after this one */
+  ship_staged_puts(pe, window_info);
+
+  MPI_Win win{window_info->get_win(dest)};
+  MPI_Aint offset{window_info->get_offset(dest, pe)};
+
+  /*
+   * Both sides are described by vector datatypes so the whole strided
+   * transfer is a single MPI_Put instead of one put per element.
+   */
+  MPI_Datatype origin_type{get_strided_type<T>(nelems, sst)};
+  MPI_Datatype target_type{get_strided_type<T>(nelems, dst)};
+
+  hdp_policy_->hdp_flush();
+
+  MPI_Put(source, 1, origin_type, pe, offset, 1, target_type, win);
+
+  window_info->get_dirty_pes()->mark_written(pe);
+
+  MPI_Type_free(&target_type);
+  MPI_Type_free(&origin_type);
+
+  MPI_Win_flush_local(pe, win);
+}
+
+template <typename T>
+__host__ void HostInterface::iget(T* dest, const T* source, ptrdiff_t dst,
+                                  ptrdiff_t sst, size_t nelems, int pe,
+                                  WindowInfo* window_info) {
+  DPRINTF("Function: host_iget\n");
+
+  ship_staged_puts(pe, window_info);
+
+  MPI_Win win{window_info->get_win(source)};
+  MPI_Aint offset{window_info->get_offset(source, pe)};
+
+  MPI_Datatype origin_type{get_strided_type<T>(nelems, dst)};
+  MPI_Datatype target_type{get_strided_type<T>(nelems, sst)};
+
+  MPI_Get(dest, 1, origin_type, pe, offset, 1, target_type, win);
+
+  MPI_Type_free(&target_type);
+  MPI_Type_free(&origin_type);
+
+  MPI_Win_flush_local(pe, win);
+
+  hdp_policy_->hdp_flush();
+}
+
 __host__ MPI_Comm HostInterface::get_mpi_comm(int pe_start, int log_pe_stride,
                                               int pe_size) {
   MPI_Comm active_set_comm{};
@@ -151,7 +209,8 @@ __host__ MPI_Comm HostInterface::get_mpi_comm(int pe_start, int log_pe_stride,
 template <typename T>
 __host__ void HostInterface::broadcast_internal(MPI_Comm mpi_comm, T* dest,
                                                 const T* source, int nelems,
-                                                int pe_root) {
+                                                int pe_root,
+                                                rocshmem_request_t* request) {
   DPRINTF("Function: host_broadcast_internal\n");
 
   /*
@@ -175,7 +234,13 @@ __host__ void HostInterface::broadcast_internal(MPI_Comm mpi_comm, T* dest,
   /*
    * Offload the broadcast to MPI
    */
-  MPI_Bcast(buffer, nelems * sizeof(T), MPI_CHAR, pe_root, mpi_comm);
+  if (request) {
+    *request = new rocshmem_request_opaque;
+    MPI_Ibcast(buffer, nelems * sizeof(T), MPI_CHAR, pe_root, mpi_comm,
+               &(*request)->mpi_request);
+  } else {
+    MPI_Bcast(buffer, nelems * sizeof(T), MPI_CHAR, pe_root, mpi_comm);
+  }
 
   return;
 }
@@ -216,6 +281,19 @@ __host__ void HostInterface::broadcast(rocshmem_team_t team, T* dest,
   return;
 }
 
+template <typename T>
+__host__ void HostInterface::broadcast_nbi(rocshmem_team_t team, T* dest,
+                                           const T* source, int nelems,
+                                           int pe_root,
+                                           rocshmem_request_t* request) {
+  DPRINTF("Function: Team-based host_broadcast_nbi\n");
+
+  Team* team_obj{get_internal_team(team)};
+  MPI_Comm mpi_comm{team_obj->mpi_comm};
+
+  broadcast_internal<T>(mpi_comm, dest, source, nelems, pe_root, request);
+}
+
 __host__ inline MPI_Op HostInterface::get_mpi_op(ROCSHMEM_OP Op) {
   switch (Op) {
     case ROCSHMEM_SUM:
@@ -264,6 +342,15 @@ GET_MPI_TYPE(char, MPI_CHAR)
 GET_MPI_TYPE(signed char, MPI_SIGNED_CHAR)
 GET_MPI_TYPE(unsigned char, MPI_UNSIGNED_CHAR)
 
+template <typename T>
+__host__ MPI_Datatype HostInterface::get_strided_type(size_t nelems,
+                                                      ptrdiff_t stride) {
+  MPI_Datatype strided_type{};
+  MPI_Type_vector(nelems, 1, stride, get_mpi_type<T>(), &strided_type);
+  MPI_Type_commit(&strided_type);
+  return strided_type;
+}
+
 template <typename T>
 __host__ void HostInterface::amo_add(void* dst, T value, int pe,
                                      WindowInfo* window_info) {
@@ -285,19 +372,24 @@ __host__ void HostInterface::amo_cas(void* dst, T value, T cond, int pe,
 template <typename T>
 __host__ T HostInterface::amo_fetch_add(void* dst, T value, int pe,
                                         WindowInfo* window_info) {
-  /* Calculate offset of remote dest from base address of window */
-  MPI_Aint offset{
-      compute_offset(dst, window_info->get_start(), window_info->get_end())};
+  /* Staged puts to the PE are ordered before the atomic */
+  ship_staged_puts(pe, window_info);
+
+  /* Calculate displacement of remote dest in the window */
+  MPI_Aint offset{window_info->get_offset(dst, pe)};
 
   /*
    * Flush the HDP of the remote PE so that the NIC does not
-   * read stale values
+   * read stale values. Atomics to the same PE within an epoch
+   * share the flush unless the PE was written in between.
    */
-  flush_remote_hdp(pe);
+  if (window_info->get_dirty_pes()->mark_amo(pe)) {
+    flush_remote_hdp(pe);
+  }
 
   /* Offload remote fetch and op operation to MPI */
   T ret{};
-  MPI_Win win{window_info->get_win()};
+  MPI_Win win{window_info->get_win(dst)};
   MPI_Datatype mpi_type{get_mpi_type<T>()};
   MPI_Fetch_and_op(&value, &ret, mpi_type, pe, offset, MPI_SUM, win);
 
@@ -309,19 +401,24 @@ __host__ T HostInterface::amo_fetch_add(void* dst, T value, int pe,
 template <typename T>
 __host__ T HostInterface::amo_fetch_cas(void* dst, T value, T cond, int pe,
                                         WindowInfo* window_info) {
-  /* Calculate offset of remote dest from base address of window */
-  MPI_Aint offset{
-      compute_offset(dst, window_info->get_start(), window_info->get_end())};
+  /* Staged puts to the PE are ordered before the atomic */
+  ship_staged_puts(pe, window_info);
+
+  /* Calculate displacement of remote dest in the window */
+  MPI_Aint offset{window_info->get_offset(dst, pe)};
 
   /*
    * Flush the HDP of the remote PE so that the NIC does not
-   * read stale values
+   * read stale values. Atomics to the same PE within an epoch
+   * share the flush unless the PE was written in between.
    */
-  flush_remote_hdp(pe);
+  if (window_info->get_dirty_pes()->mark_amo(pe)) {
+    flush_remote_hdp(pe);
+  }
 
   /* Offload remote compare and swap operation to MPI */
   T ret{};
-  MPI_Win win{window_info->get_win()};
+  MPI_Win win{window_info->get_win(dst)};
   MPI_Datatype mpi_type{get_mpi_type<T>()};
   MPI_Compare_and_swap(&value, &cond, &ret, mpi_type, pe, offset, win);
 
@@ -332,7 +429,8 @@ __host__ T HostInterface::amo_fetch_cas(void* dst, T value, T cond, int pe,
 
 template <typename T, ROCSHMEM_OP Op>
 __host__ void HostInterface::to_all_internal(MPI_Comm mpi_comm, T* dest,
-                                             const T* source, int nreduce) {
+                                             const T* source, int nreduce,
+                                             rocshmem_request_t* request) {
   DPRINTF("Function: host_to_all_internal\n");
 
   MPI_Op mpi_op{get_mpi_op(Op)};
@@ -350,8 +448,15 @@ __host__ void HostInterface::to_all_internal(MPI_Comm mpi_comm, T* dest,
   /*
    * Offload the allreduce to MPI
    */
-  MPI_Allreduce((dest == source) ? MPI_IN_PLACE : send_buf, recv_buf, nreduce,
-                mpi_type, mpi_op, mpi_comm);
+  if (request) {
+    *request = new rocshmem_request_opaque;
+    MPI_Iallreduce((dest == source) ? MPI_IN_PLACE : send_buf, recv_buf,
+                   nreduce, mpi_type, mpi_op, mpi_comm,
+                   &(*request)->mpi_request);
+  } else {
+    MPI_Allreduce((dest == source) ? MPI_IN_PLACE : send_buf, recv_buf,
+                  nreduce, mpi_type, mpi_op, mpi_comm);
+  }
 
   return;
 }
@@ -391,6 +496,109 @@ __host__ int HostInterface::reduce(rocshmem_team_t team, T* dest,
   return ROCSHMEM_SUCCESS;
 }
 
+template <typename T, ROCSHMEM_OP Op>
+__host__ int HostInterface::reduce_nbi(rocshmem_team_t team, T* dest,
+                                        const T* source, int nreduce,
+                                        rocshmem_request_t* request) {
+  DPRINTF("Function: Team-based host_reduce_nbi\n");
+
+  Team* team_obj{get_internal_team(team)};
+  MPI_Comm mpi_comm{team_obj->mpi_comm};
+
+  to_all_internal<T, Op>(mpi_comm, dest, source, nreduce, request);
+
+  return ROCSHMEM_SUCCESS;
+}
+
+template <typename T>
+__host__ void HostInterface::exchange_blocks_rma(Team* team_obj, T* dest,
+                                                 const T* source, int nelems,
+                                                 bool fcollect,
+                                                 WindowInfo* window_info) {
+  int team_size{team_obj->num_pes};
+  int my_team_pe{team_obj->my_pe};
+  size_t block_bytes{nelems * sizeof(T)};
+
+  /*
+   * Flush my HDP so that the NIC does not read stale values
+   */
+  hdp_policy_->hdp_flush();
+
+  /*
+   * Start with the next PE so that all PEs do not target the same PE first
+   */
+  for (int i{1}; i <= team_size; i++) {
+    int team_pe{(my_team_pe + i) % team_size};
+    const T* block{fcollect ? source : source + team_pe * nelems};
+    putmem_nbi(dest + my_team_pe * nelems, block, block_bytes,
+               team_obj->get_pe_in_world(team_pe), window_info);
+  }
+
+  quiet(window_info);
+
+  MPI_Barrier(team_obj->mpi_comm);
+}
+
+template <typename T>
+__host__ void HostInterface::alltoall(rocshmem_team_t team, T* dest,
+                                      const T* source, int nelems,
+                                      WindowInfo* window_info) {
+  DPRINTF("Function: Team-based host_alltoall\n");
+
+  Team* team_obj{get_internal_team(team)};
+
+  if (nelems * sizeof(T) <= coll_rma_threshold_) {
+    exchange_blocks_rma(team_obj, dest, source, nelems, false, window_info);
+    return;
+  }
+
+  hdp_policy_->hdp_flush();
+
+  MPI_Alltoall(source, nelems * sizeof(T), MPI_CHAR, dest, nelems * sizeof(T),
+               MPI_CHAR, team_obj->mpi_comm);
+}
+
+template <typename T>
+__host__ void HostInterface::alltoallv(rocshmem_team_t team, T* dest,
+                                       const int* dest_counts,
+                                       const int* dest_displs,
+                                       const T* source,
+                                       const int* source_counts,
+                                       const int* source_displs) {
+  DPRINTF("Function: Team-based host_alltoallv\n");
+
+  Team* team_obj{get_internal_team(team)};
+
+  /*
+   * No RMA path: a PE does not know where its block lands in the
+   * destination of its peers without an extra exchange of displacements
+   */
+  hdp_policy_->hdp_flush();
+
+  MPI_Datatype mpi_type{get_mpi_type<T>()};
+  MPI_Alltoallv(source, source_counts, source_displs, mpi_type, dest,
+                dest_counts, dest_displs, mpi_type, team_obj->mpi_comm);
+}
+
+template <typename T>
+__host__ void HostInterface::fcollect(rocshmem_team_t team, T* dest,
+                                      const T* source, int nelems,
+                                      WindowInfo* window_info) {
+  DPRINTF("Function: Team-based host_fcollect\n");
+
+  Team* team_obj{get_internal_team(team)};
+
+  if (nelems * sizeof(T) <= coll_rma_threshold_) {
+    exchange_blocks_rma(team_obj, dest, source, nelems, true, window_info);
+    return;
+  }
+
+  hdp_policy_->hdp_flush();
+
+  MPI_Allgather(source, nelems * sizeof(T), MPI_CHAR, dest, nelems * sizeof(T),
+                MPI_CHAR, team_obj->mpi_comm);
+}
+
 template <typename T>
 __host__ inline int HostInterface::compare(int cmp, T input_val,
                                            T target_val) {
@@ -424,25 +632,69 @@ __host__ inline int HostInterface::compare(int cmp, T input_val,
 }
 
 template <typename T>
-__host__ inline int HostInterface::test_and_compare(MPI_Aint offset,
-                                                    MPI_Datatype mpi_type,
-                                                    int cmp, T val,
-                                                    MPI_Win win) {
-  T fetched_val{};
-
+__host__ const T* HostInterface::fetch_ivars(T* ivars, size_t nelems,
+                                             T* buffer, bool refresh,
+                                             WindowInfo* window_info) {
   /*
    * Flush the HDP so that the CPU doesn't read stale values
    */
-  hdp_policy_->hdp_flush();
-
-  MPI_Fetch_and_op(nullptr,  // because no operation happening here
-                   &fetched_val, mpi_type, my_pe_, offset, MPI_NO_OP, win);
-  MPI_Win_flush_local(my_pe_, win);
+  if (refresh || !wait_local_load_) {
+    hdp_policy_->hdp_flush();
+  }
 
   /*
-   * Compare based on the operation
+   * The ivars are in this PE's own symmetric heap, so they can be read in
+   * place. The caller orders the loads.
    */
-  return compare(cmp, fetched_val, val);
+  if (wait_local_load_) {
+    return ivars;
+  }
+
+  MPI_Aint offset{window_info->get_offset(ivars, my_pe_)};
+
+  MPI_Datatype mpi_type{get_mpi_type<T>()};
+  MPI_Win win{window_info->get_win(ivars)};
+
+  MPI_Get_accumulate(nullptr, 0, mpi_type, buffer, nelems, mpi_type, my_pe_,
+                     offset, nelems, mpi_type, MPI_NO_OP, win);
+  MPI_Win_flush_local(my_pe_, win);
+
+  return buffer;
+}
+
+template <typename T>
+__host__ T HostInterface::load_ivar(T* ivar, bool refresh,
+                                    WindowInfo* window_info) {
+  T fetched_val{};
+  const T* src{fetch_ivars(ivar, 1, &fetched_val, refresh, window_info)};
+
+  T loaded_val;
+  __atomic_load(src, &loaded_val, __ATOMIC_ACQUIRE);
+  return loaded_val;
+}
+
+template <typename T, typename DONE_T>
+__host__ size_t HostInterface::wait_until_scan(T* ivars, size_t nelems,
+                                               const int* status, int cmp,
+                                               T val, const T* vals,
+                                               uint8_t* hits,
+                                               WindowInfo* window_info,
+                                               DONE_T done) {
+  std::vector<T> buffer(wait_local_load_ ? 0 : nelems);
+  HostWaitBackoff backoff;
+  bool refresh{true};
+
+  while (true) {
+    const T* values{
+        fetch_ivars(ivars, nelems, buffer.data(), refresh, window_info)};
+
+    size_t count{scan_ivars(values, nelems, status, cmp, val, vals, hits)};
+    if (done(count)) {
+      return count;
+    }
+
+    refresh = backoff.next();
+  }
 }
 
 template <typename T>
@@ -451,52 +703,77 @@ __host__ void HostInterface::wait_until(T *ivars, int cmp, T val,
   DPRINTF("Function: host_wait_until\n");
 
   /*
-   * Find the offset of this memory in the window
+   * Read the ivars atomically until it satisfies the condition
    */
-  MPI_Aint offset{
-      compute_offset(ivars, window_info->get_start(), window_info->get_end())};
-
-  MPI_Datatype mpi_type{get_mpi_type<T>()};
-  MPI_Win win{window_info->get_win()};
+  HostWaitBackoff backoff;
+  bool refresh{true};
 
-  /*
-   * Continuously read the ivars atomically until it satisfies the condition
-   */
-  while (1) {
-    int cond_satisfied{test_and_compare(offset, mpi_type, cmp, val, win)};
+  while (!compare(cmp, load_ivar(ivars, refresh, window_info), val)) {
+    refresh = backoff.next();
+  }
+}
 
-    if (cond_satisfied) {
-      break;
-    }
+template <typename T>
+__host__ size_t HostInterface::wait_until_any_internal(T* ivars, size_t nelems,
+                                                       const int *status,
+                                                       int cmp, T val,
+                                                       const T* vals,
+                                                       WindowInfo* window_info) {
+  // zero nelems or invalid (empty) status array error condition
+  if (!nelems || !num_included(nelems, status)) {
+    return SIZE_MAX;
   }
+
+  std::vector<uint8_t> hits(nelems);
+  wait_until_scan(ivars, nelems, status, cmp, val, vals, hits.data(),
+                  window_info, [](size_t count) { return count != 0; });
+
+  return std::find(hits.begin(), hits.end(), 1) - hits.begin();
 }
 
-__host__ size_t status_entry(size_t nelems,
-                             const int *status,
-                             bool* done_flags) {
-  size_t i{0};
-  size_t pos{SIZE_MAX};
-  while (i < nelems) {
-    if (status[i]) {
-      done_flags[i] = 1;
-    } else {
-      pos = min(i, pos);
-    }
-    i++;
+template <typename T>
+__host__ void HostInterface::wait_until_all_internal(T* ivars, size_t nelems,
+                                                     const int *status,
+                                                     int cmp, T val,
+                                                     const T* vals,
+                                                     WindowInfo* window_info) {
+  size_t num_waiting{num_included(nelems, status)};
+
+  // zero nelems or invalid (empty) status array error condition
+  if (!num_waiting) {
+    return;
   }
-  return pos;
+
+  std::vector<uint8_t> hits(nelems);
+  wait_until_scan(
+      ivars, nelems, status, cmp, val, vals, hits.data(), window_info,
+      [num_waiting](size_t count) { return count == num_waiting; });
 }
 
-__host__ size_t status_entry(size_t nelems,
-                             const int *status) {
-  size_t i{0};
-  while (i < nelems) {
-    if (status[i] == 0) {
-      return i;
+template <typename T>
+__host__ size_t HostInterface::wait_until_some_internal(T* ivars, size_t nelems,
+                                                        size_t* indices,
+                                                        const int *status,
+                                                        int cmp, T val,
+                                                        const T* vals,
+                                                        WindowInfo* window_info) {
+  // zero nelems or invalid (empty) status array error condition
+  if (!nelems || !num_included(nelems, status)) {
+    return 0;
+  }
+
+  std::vector<uint8_t> hits(nelems);
+  size_t ncompleted{
+      wait_until_scan(ivars, nelems, status, cmp, val, vals, hits.data(),
+                      window_info, [](size_t count) { return count != 0; })};
+
+  size_t j{0};
+  for (size_t i{0}; i < nelems; i++) {
+    if (hits[i]) {
+      indices[j++] = i;
     }
-    i++;
   }
-  return i;
+  return ncompleted;
 }
 
 template <typename T>
@@ -506,29 +783,8 @@ __host__ size_t HostInterface::wait_until_any(T* ivars, size_t nelems,
                                               WindowInfo* window_info) {
   DPRINTF("Function: host_wait_until_any\n");
 
-  // zero nelems error condition
-  if (!nelems) {
-    return SIZE_MAX;
-  }
-
-  size_t pos{status_entry(nelems, status)};
-
-  // invalid (empty) status array error condition
-  if (pos == nelems) {
-    return SIZE_MAX;
-  }
-
-  while (true) {
-    for (size_t i{pos}; i < nelems; i++) {
-      // skip entries marked with non-zero status
-      if (status[i]) {
-        continue;
-      }
-      if (test(ivars + i, cmp, val, window_info)) {
-        return i;
-      }
-    }
-  }
+  return wait_until_any_internal(ivars, nelems, status, cmp, val,
+                                 static_cast<const T*>(nullptr), window_info);
 }
 
 template <typename T>
@@ -538,25 +794,8 @@ __host__ void HostInterface::wait_until_all(T* ivars, size_t nelems,
                                             WindowInfo* window_info) {
   DPRINTF("Function: host_wait_until_all\n");
 
-  // zero nelems error condition
-  if (!nelems) {
-    return;
-  }
-
-  size_t pos{status_entry(nelems, status)};
-
-  // invalid (empty) status array error condition
-  if (pos == nelems) {
-    return;
-  }
-
-  for (size_t i{pos}; i < nelems; i++) {
-    if (status[i]) {
-      continue;
-    }
-    while (!test(ivars + i, cmp, val, window_info)) {
-    }
-  }
+  wait_until_all_internal(ivars, nelems, status, cmp, val,
+                          static_cast<const T*>(nullptr), window_info);
 }
 
 template <typename T>
@@ -567,34 +806,8 @@ __host__ size_t HostInterface::wait_until_some(T* ivars, size_t nelems,
                                              WindowInfo* window_info) {
   DPRINTF("Function: host_wait_until_some\n");
 
-  // zero nelems error condition
-  if (!nelems) {
-    return 0;
-  }
-
-  size_t pos{status_entry(nelems, status)};
-
-  // invalid (empty) status array error condition
-  if (pos == nelems) {
-    return 0;
-  }
-
-  bool done {false};
-  size_t ncompleted {0};
-  while (!done) {
-    for (size_t i{pos}; i < nelems; i++) {
-      // skip entries marked with non-zero status
-      if (status[i]) {
-        continue;
-      }
-      if (test(ivars + i, cmp, val, window_info)) {
-        done = true;
-        indices[ncompleted] = i;
-        ncompleted++;
-      }
-    }
-  }
-  return ncompleted;
+  return wait_until_some_internal(ivars, nelems, indices, status, cmp, val,
+                                  static_cast<const T*>(nullptr), window_info);
 }
 
 template <typename T>
@@ -603,6 +816,9 @@ __host__ void HostInterface::wait_until_all_vector(T* ivars, size_t nelems,
                                                    int cmp, T* vals,
                                                    WindowInfo* window_info) {
   DPRINTF("Function: host_wait_until_all_vector\n");
+
+  wait_until_all_internal(ivars, nelems, status, cmp, T{},
+                          static_cast<const T*>(vals), window_info);
 }
 
 template <typename T>
@@ -611,7 +827,9 @@ __host__ size_t HostInterface::wait_until_any_vector(T* ivars, size_t nelems,
                                                      int cmp, T* vals,
                                                      WindowInfo* window_info) {
   DPRINTF("Function: host_wait_until_any_vector\n");
-  return 0;
+
+  return wait_until_any_internal(ivars, nelems, status, cmp, T{},
+                                 static_cast<const T*>(vals), window_info);
 }
 
 template <typename T>
@@ -621,7 +839,9 @@ __host__ size_t HostInterface::wait_until_some_vector(T* ivars, size_t nelems,
                                                     int cmp, T* vals,
                                                     WindowInfo* window_info) {
   DPRINTF("Function: host_wait_until_some_vector\n");
-  return 0;
+
+  return wait_until_some_internal(ivars, nelems, indices, status, cmp, T{},
+                                  static_cast<const T*>(vals), window_info);
 }
 
 template <typename T>
@@ -629,15 +849,7 @@ __host__ int HostInterface::test(T* ivars, int cmp, T val,
                                  WindowInfo* window_info) {
   DPRINTF("Function: host_test\n");
 
-  /*
-   * Find the offset of this memory in the window
-   */
-  MPI_Aint offset{
-      compute_offset(ivars, window_info->get_start(), window_info->get_end())};
-
-  MPI_Datatype mpi_type{get_mpi_type<T>()};
-
-  return test_and_compare(offset, mpi_type, cmp, val, window_info->get_win());
+  return compare(cmp, load_ivar(ivars, true, window_info), val);
 }
 
 }  // namespace rocshmem
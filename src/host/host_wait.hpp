@@ -0,0 +1,211 @@
+/******************************************************************************
+ * Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+
+#ifndef LIBRARY_SRC_HOST_HOST_WAIT_HPP_
+#define LIBRARY_SRC_HOST_HOST_WAIT_HPP_
+
+/**
+ * @file host_wait.hpp
+ *
+ * @brief Polling helpers for the host-facing wait_until family
+ *
+ * Host threads waiting on symmetric memory read the local heap directly
+ * instead of going through MPI on every probe. The helpers here pace the
+ * probes and evaluate the wait condition over whole arrays at once.
+ */
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <thread>
+
+#include "rocshmem/rocshmem_common.hpp"
+
+namespace rocshmem {
+
+/**
+ * @brief Backoff policy for host threads polling symmetric memory
+ *
+ * The first probes spin back-to-back, the next ones issue a CPU pause
+ * between probes and the remaining ones yield the processor. A condition
+ * that is satisfied quickly is seen with minimal latency while a long
+ * wait stops burning a core.
+ */
+class HostWaitBackoff {
+ public:
+  /**
+   * @brief Waits before the next probe
+   *
+   * @return true if coherence should be refreshed before the next probe
+   */
+  __host__ bool next() {
+    if (iteration_ >= SPIN_ITERATIONS + PAUSE_ITERATIONS) {
+      std::this_thread::yield();
+    } else if (iteration_ >= SPIN_ITERATIONS) {
+      cpu_relax();
+    }
+    iteration_++;
+    return (iteration_ % REFRESH_INTERVAL) == 0;
+  }
+
+ private:
+  __host__ static void cpu_relax() {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield" ::: "memory");
+#endif
+  }
+
+  /**
+   * @brief Number of back-to-back probes
+   */
+  static constexpr uint64_t SPIN_ITERATIONS{64};
+
+  /**
+   * @brief Number of probes separated by a CPU pause
+   */
+  static constexpr uint64_t PAUSE_ITERATIONS{4096};
+
+  /**
+   * @brief Number of probes between coherence refreshes
+   */
+  static constexpr uint64_t REFRESH_INTERVAL{64};
+
+  uint64_t iteration_{0};
+};
+
+/**
+ * @brief Evaluates a comparison over an array of ivars
+ *
+ * The ivars are written concurrently by other PEs, so each is read with
+ * a relaxed atomic load; the caller orders the scan with an acquire fence
+ * once it is satisfied. The loops are free of early exits and
+ * data-dependent branches.
+ *
+ * @param[in] values to compare
+ * @param[in] nelems number of values
+ * @param[in] status entries with a non-zero status are excluded (optional)
+ * @param[in] val comparison operand used when vals is null
+ * @param[in] vals per-element comparison operands (optional)
+ * @param[out] hits set to 1 for each included element that compares true
+ * @param[in] cmp comparison functor
+ *
+ * @return number of hits
+ */
+template <typename T, typename CMP_T>
+__host__ inline size_t scan_ivars(const T* values, size_t nelems,
+                                  const int* status, T val, const T* vals,
+                                  uint8_t* hits, CMP_T cmp) {
+  size_t count{0};
+
+  auto scan = [&](auto target, auto included) {
+    for (size_t i{0}; i < nelems; i++) {
+      T value{__atomic_load_n(&values[i], __ATOMIC_RELAXED)};
+      uint8_t hit = cmp(value, target(i)) & included(i);
+      hits[i] = hit;
+      count += hit;
+    }
+  };
+
+  auto scalar = [val](size_t) { return val; };
+  auto vector = [vals](size_t i) { return vals[i]; };
+  auto all = [](size_t) { return true; };
+  auto unmasked = [status](size_t i) { return status[i] == 0; };
+
+  if (vals) {
+    status ? scan(vector, unmasked) : scan(vector, all);
+  } else {
+    status ? scan(scalar, unmasked) : scan(scalar, all);
+  }
+  return count;
+}
+
+/**
+ * @brief Evaluates a ROCSHMEM_CMP_* comparison over an array of ivars
+ *
+ * The values are read with plain loads followed by an acquire fence, so
+ * reads after a satisfied scan observe everything published before the
+ * ivars were updated.
+ *
+ * @return number of included elements that satisfy the comparison
+ */
+template <typename T>
+__host__ inline size_t scan_ivars(const T* values, size_t nelems,
+                                  const int* status, int cmp, T val,
+                                  const T* vals, uint8_t* hits) {
+  size_t count{0};
+
+  switch (cmp) {
+    case ROCSHMEM_CMP_EQ:
+      count = scan_ivars(values, nelems, status, val, vals, hits,
+                         std::equal_to<T>{});
+      break;
+    case ROCSHMEM_CMP_NE:
+      count = scan_ivars(values, nelems, status, val, vals, hits,
+                         std::not_equal_to<T>{});
+      break;
+    case ROCSHMEM_CMP_GT:
+      count = scan_ivars(values, nelems, status, val, vals, hits,
+                         std::greater<T>{});
+      break;
+    case ROCSHMEM_CMP_GE:
+      count = scan_ivars(values, nelems, status, val, vals, hits,
+                         std::greater_equal<T>{});
+      break;
+    case ROCSHMEM_CMP_LT:
+      count = scan_ivars(values, nelems, status, val, vals, hits,
+                         std::less<T>{});
+      break;
+    case ROCSHMEM_CMP_LE:
+      count = scan_ivars(values, nelems, status, val, vals, hits,
+                         std::less_equal<T>{});
+      break;
+    default:
+      assert(cmp >= ROCSHMEM_CMP_EQ && cmp <= ROCSHMEM_CMP_LE);
+      break;
+  }
+
+  std::atomic_thread_fence(std::memory_order_acquire);
+  return count;
+}
+
+/**
+ * @brief Counts the entries that take part in a wait
+ *
+ * @return number of zero entries in status, or nelems if status is null
+ */
+__host__ inline size_t num_included(size_t nelems, const int* status) {
+  if (!status) {
+    return nelems;
+  }
+  size_t count{0};
+  for (size_t i{0}; i < nelems; i++) {
+    count += (status[i] == 0);
+  }
+  return count;
+}
+
+}  // namespace rocshmem
+
+#endif  // LIBRARY_SRC_HOST_HOST_WAIT_HPP_
@@ -0,0 +1,135 @@
+/******************************************************************************
+ * Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+
+#ifndef LIBRARY_SRC_HOST_INDEX_FREE_LIST_HPP_
+#define LIBRARY_SRC_HOST_INDEX_FREE_LIST_HPP_
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+
+/**
+ * @file index_free_list.hpp
+ *
+ * @brief Contains a lock-free stack of free slot indices
+ */
+
+namespace rocshmem {
+
+class IndexFreeList {
+ public:
+  /**
+   * @brief Primary constructor
+   *
+   * All indices in [0, capacity) start out free and are handed out in
+   * ascending order.
+   *
+   * @param[in] capacity number of slots
+   */
+  explicit IndexFreeList(int capacity)
+      : capacity_{capacity}, next_{new std::atomic<uint32_t>[capacity]} {
+    for (int i{0}; i < capacity; i++) {
+      next_[i].store(i + 1 < capacity ? i + 1 : END, std::memory_order_relaxed);
+    }
+    head_.store(pack(0, capacity ? 0 : END), std::memory_order_release);
+  }
+
+  /**
+   * @brief Takes a free index
+   *
+   * Safe to call concurrently with pop and push from any thread.
+   *
+   * @return a free index or -1 if every slot is taken
+   */
+  int pop() {
+    uint64_t old_head{head_.load(std::memory_order_acquire)};
+    while (true) {
+      uint32_t index{index_of(old_head)};
+      if (index == END) {
+        return -1;
+      }
+      /*
+       * The tag changes on every update of the head, so a stale next
+       * read here makes the exchange fail rather than corrupt the list.
+       */
+      uint32_t next{next_[index].load(std::memory_order_relaxed)};
+      uint64_t new_head{pack(tag_of(old_head) + 1, next)};
+      if (head_.compare_exchange_weak(old_head, new_head,
+                                      std::memory_order_acq_rel,
+                                      std::memory_order_acquire)) {
+        return index;
+      }
+    }
+  }
+
+  /**
+   * @brief Returns an index taken with pop
+   *
+   * @param[in] index slot to free
+   */
+  void push(int index) {
+    assert(index >= 0 && index < capacity_);
+    uint64_t old_head{head_.load(std::memory_order_relaxed)};
+    do {
+      next_[index].store(index_of(old_head), std::memory_order_relaxed);
+    } while (!head_.compare_exchange_weak(
+        old_head, pack(tag_of(old_head) + 1, index), std::memory_order_release,
+        std::memory_order_relaxed));
+  }
+
+  /**
+   * @return number of slots
+   */
+  int capacity() const { return capacity_; }
+
+ private:
+  static constexpr uint32_t END{UINT32_MAX};
+
+  static uint64_t pack(uint32_t tag, uint32_t index) {
+    return (uint64_t{tag} << 32) | index;
+  }
+
+  static uint32_t tag_of(uint64_t head) { return head >> 32; }
+
+  static uint32_t index_of(uint64_t head) { return head & UINT32_MAX; }
+
+  /**
+   * @brief Number of slots
+   */
+  int capacity_{0};
+
+  /**
+   * @brief Next free index after each free index
+   */
+  std::unique_ptr<std::atomic<uint32_t>[]> next_;
+
+  /**
+   * @brief Update tag in the upper half and first free index in the
+   * lower half
+   */
+  std::atomic<uint64_t> head_{0};
+};
+
+}  // namespace rocshmem
+
+#endif  // LIBRARY_SRC_HOST_INDEX_FREE_LIST_HPP_
@@ -0,0 +1,149 @@
+/******************************************************************************
+ * Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+
+#include "put_aggregator.hpp"
+
+#include <cassert>
+#include <cstring>
+#include <iterator>
+
+namespace rocshmem {
+
+PutAggregator::PutAggregator(size_t buffer_size, size_t max_put_size)
+    : buffer_size_{buffer_size}, max_put_size_{max_put_size} {
+  assert(max_put_size_ <= buffer_size_);
+}
+
+void PutAggregator::stage(int pe, MPI_Aint offset, const void* source,
+                          size_t nelems, WindowInfo* window_info) {
+  assert(accepts(nelems));
+
+  Staging& staging{staging_[pe]};
+  if (!staging.pending) {
+    staging.pending = true;
+    pending_.push_back(pe);
+  }
+
+  if (try_stage(&staging, offset, source, nelems)) {
+    return;
+  }
+
+  ship(pe, window_info);
+
+  [[maybe_unused]] bool staged{try_stage(&staging, offset, source, nelems)};
+  assert(staged);
+}
+
+bool PutAggregator::try_stage(Staging* staging, MPI_Aint offset,
+                              const void* source, size_t nelems) {
+  auto& records{staging->records};
+  auto& lengths{staging->lengths};
+  auto& displacements{staging->displacements};
+
+  /*
+   * The records of one MPI_Put must not overlap, so a record which only
+   * partially overlaps a staged one forces the buffer out.
+   */
+  auto next{records.lower_bound(offset)};
+  if (next != records.end()) {
+    if (next->first == offset &&
+        static_cast<size_t>(lengths[next->second]) == nelems) {
+      memcpy(staging->data.data() + staging->positions[next->second], source,
+             nelems);
+      return true;
+    }
+    if (next->first < offset + static_cast<MPI_Aint>(nelems)) {
+      return false;
+    }
+  }
+  if (next != records.begin()) {
+    auto prev{std::prev(next)};
+    if (prev->first + lengths[prev->second] > offset) {
+      return false;
+    }
+  }
+
+  if (staging->data.size() + nelems > buffer_size_) {
+    return false;
+  }
+
+  if (!displacements.empty() &&
+      displacements.back() + lengths.back() == offset) {
+    lengths.back() += nelems;
+  } else {
+    records.emplace(offset, displacements.size());
+    displacements.push_back(offset);
+    lengths.push_back(nelems);
+    staging->positions.push_back(staging->data.size());
+  }
+
+  const char* bytes{reinterpret_cast<const char*>(source)};
+  staging->data.insert(staging->data.end(), bytes, bytes + nelems);
+  return true;
+}
+
+void PutAggregator::ship(int pe, WindowInfo* window_info) {
+  auto it{staging_.find(pe)};
+  if (it == staging_.end() || it->second.displacements.empty()) {
+    return;
+  }
+  Staging& staging{it->second};
+
+  MPI_Win win{window_info->get_win()};
+  int num_records = staging.displacements.size();
+  int num_bytes = staging.data.size();
+
+  if (num_records == 1) {
+    MPI_Put(staging.data.data(), num_bytes, MPI_CHAR, pe,
+            staging.displacements[0], num_bytes, MPI_CHAR, win);
+  } else {
+    MPI_Datatype target_type;
+    MPI_Type_create_hindexed(num_records, staging.lengths.data(),
+                             staging.displacements.data(), MPI_CHAR,
+                             &target_type);
+    MPI_Type_commit(&target_type);
+    MPI_Put(staging.data.data(), num_bytes, MPI_CHAR, pe, 0, 1, target_type,
+            win);
+    MPI_Type_free(&target_type);
+  }
+
+  /* The staging buffer is reused as soon as this returns */
+  MPI_Win_flush_local(pe, win);
+
+  window_info->get_dirty_pes()->mark_written(pe);
+
+  staging.data.clear();
+  staging.displacements.clear();
+  staging.lengths.clear();
+  staging.positions.clear();
+  staging.records.clear();
+}
+
+void PutAggregator::ship_all(WindowInfo* window_info) {
+  for (int pe : pending_) {
+    ship(pe, window_info);
+    staging_[pe].pending = false;
+  }
+  pending_.clear();
+}
+
+}  // namespace rocshmem
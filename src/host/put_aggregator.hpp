@@ -0,0 +1,169 @@
+/******************************************************************************
+ * Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+
+#ifndef LIBRARY_SRC_HOST_PUT_AGGREGATOR_HPP_
+#define LIBRARY_SRC_HOST_PUT_AGGREGATOR_HPP_
+
+#include <mpi.h>
+
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+#include "../memory/window_info.hpp"
+
+/**
+ * @file put_aggregator.hpp
+ *
+ * @brief Contains the staging buffers used by host contexts created with
+ * ROCSHMEM_CTX_AGGREGATE
+ *
+ * Small puts are copied into a staging buffer per target PE together with
+ * their window offsets. A buffer is shipped as a single MPI_Put whose target
+ * datatype scatters the records into place, so the target applies the
+ * records without any involvement of its host threads.
+ */
+
+namespace rocshmem {
+
+class PutAggregator {
+ public:
+  /**
+   * @brief Primary constructor
+   *
+   * @param[in] buffer_size capacity in bytes of each staging buffer
+   * @param[in] max_put_size largest put which is staged
+   */
+  PutAggregator(size_t buffer_size, size_t max_put_size);
+
+  /**
+   * @brief Check if a put is small enough to be staged
+   *
+   * @param[in] nelems size of the put in bytes
+   */
+  bool accepts(size_t nelems) const {
+    return nelems && nelems <= max_put_size_;
+  }
+
+  /**
+   * @brief Stage a put to a PE, shipping the PE's buffer first if the put
+   * does not fit or overlaps a staged record
+   *
+   * @param[in] pe target PE
+   * @param[in] offset destination offset in the window
+   * @param[in] source data to put
+   * @param[in] nelems size of the put in bytes
+   * @param[in] window_info window of the host context
+   */
+  void stage(int pe, MPI_Aint offset, const void* source, size_t nelems,
+             WindowInfo* window_info);
+
+  /**
+   * @brief Ship the staged puts to a PE
+   *
+   * The staging buffer can be reused on return; remote completion still
+   * requires a flush of the window.
+   *
+   * @param[in] pe target PE
+   * @param[in] window_info window of the host context
+   */
+  void ship(int pe, WindowInfo* window_info);
+
+  /**
+   * @brief Ship the staged puts to every PE
+   *
+   * @param[in] window_info window of the host context
+   */
+  void ship_all(WindowInfo* window_info);
+
+ private:
+  /**
+   * @brief Staged puts to one PE
+   */
+  struct Staging {
+    /**
+     * @brief Payload of the records, back to back
+     */
+    std::vector<char> data{};
+
+    /**
+     * @brief Window offset of each record
+     */
+    std::vector<MPI_Aint> displacements{};
+
+    /**
+     * @brief Size in bytes of each record
+     */
+    std::vector<int> lengths{};
+
+    /**
+     * @brief Position of each record's payload in data
+     */
+    std::vector<size_t> positions{};
+
+    /**
+     * @brief Window offset to record index, used to find overlaps
+     */
+    std::map<MPI_Aint, size_t> records{};
+
+    /**
+     * @brief Set while the PE is listed in pending_
+     */
+    bool pending{false};
+  };
+
+  /**
+   * @brief Add a record to a staging buffer
+   *
+   * A record which rewrites a staged record in place replaces its payload;
+   * a record which extends the last staged record is merged into it.
+   *
+   * @return false if the record does not fit or partially overlaps a
+   * staged record
+   */
+  bool try_stage(Staging* staging, MPI_Aint offset, const void* source,
+                 size_t nelems);
+
+  /**
+   * @brief Capacity in bytes of each staging buffer
+   */
+  size_t buffer_size_{0};
+
+  /**
+   * @brief Largest put which is staged
+   */
+  size_t max_put_size_{0};
+
+  /**
+   * @brief Staging buffers by target PE
+   */
+  std::unordered_map<int, Staging> staging_{};
+
+  /**
+   * @brief PEs which may have staged puts, each listed at most once
+   */
+  std::vector<int> pending_{};
+};
+
+}  // namespace rocshmem
+
+#endif  // LIBRARY_SRC_HOST_PUT_AGGREGATOR_HPP_
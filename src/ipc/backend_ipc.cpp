@@ -23,6 +23,8 @@
 #include "backend_ipc.hpp"
 #include "ipc_team.hpp"
 
+#include <vector>
+
 namespace rocshmem {
 
 #define NET_CHECK(cmd)                                       \
@@ -62,6 +64,38 @@ IPCBackend::IPCBackend(MPI_Comm comm)
     sstream >> maximum_num_contexts_;
   }
 
+  if (auto bcast_chunk_size_str = getenv("ROCSHMEM_BCAST_CHUNK_SIZE")) {
+    std::stringstream sstream(bcast_chunk_size_str);
+    sstream >> bcast_chunk_size;
+  }
+
+  if (auto alltoall_schedule_str = getenv("ROCSHMEM_ALLTOALL_SCHEDULE")) {
+    std::string schedule{alltoall_schedule_str};
+    if (schedule == "linear") {
+      alltoall_schedule = AlltoallSchedule::LINEAR;
+    } else if (schedule == "pairwise") {
+      alltoall_schedule = AlltoallSchedule::PAIRWISE;
+    } else if (schedule == "wave") {
+      alltoall_schedule = AlltoallSchedule::PAIRWISE_WAVE;
+    }
+  }
+
+  if (auto barrier_kind_str = getenv("ROCSHMEM_BARRIER_KIND")) {
+    std::string kind{barrier_kind_str};
+    if (kind == "direct") {
+      forced_barrier_kind = BarrierKind::DIRECT;
+    } else if (kind == "tree") {
+      forced_barrier_kind = BarrierKind::TREE;
+    } else if (kind == "dissemination") {
+      forced_barrier_kind = BarrierKind::DISSEMINATION;
+    }
+  }
+
+  if (auto reduce_wrk_size_str = getenv("ROCSHMEM_REDUCE_WRK_SIZE")) {
+    std::stringstream sstream(reduce_wrk_size_str);
+    sstream >> reduce_wrk_size;
+  }
+
   init_mpi_once(comm);
 
   initIPC();
@@ -80,7 +114,8 @@ IPCBackend::IPCBackend(MPI_Comm comm)
   host_interface =
       new HostInterface(hdp_proxy_.get(), thread_comm, &heap);
 
-  default_host_ctx = std::make_unique<IPCHostContext>(this, 0);
+  default_host_ctx =
+      std::make_unique<IPCHostContext>(this, ROCSHMEM_CTX_SHARED);
 
   ROCSHMEM_HOST_CTX_DEFAULT.ctx_opaque = default_host_ctx.get();
 
@@ -88,8 +123,6 @@ IPCBackend::IPCBackend(MPI_Comm comm)
 
   allocate_atomic_region(&bp->atomic_ret, MAX_NUM_BLOCKS);
 
-  setup_team_world();
-
   init_wrk_sync_buffer();
 
   rocshmem_collective_init();
@@ -98,6 +131,9 @@ IPCBackend::IPCBackend(MPI_Comm comm)
 
   teams_init();
 
+  /* TEAM_WORLD takes pool slot 0, so the pools must be carved first */
+  setup_team_world();
+
   TeamInfo *tinfo = team_tracker.get_team_world()->tinfo_wrt_world;
 
   default_context_proxy_ = IPCDefaultContextProxyT(this, tinfo);
@@ -127,8 +163,9 @@ IPCBackend::~IPCBackend() {
    * and team world
    */
   teams_destroy();
-  cleanup_wrk_sync_buffer();
   auto *team_world{team_tracker.get_team_world()};
+  cleanup_team_wrk(static_cast<IPCTeam *>(team_world));
+  cleanup_wrk_sync_buffer();
   team_world->~Team();
   CHECK_HIP(hipFree(team_world));
 
@@ -155,6 +192,7 @@ __device__ bool IPCBackend::create_ctx(int64_t options, rocshmem_ctx_t *ctx) {
   ctx->ctx_opaque = ctx_;
 
   ctx_->tinfo = reinterpret_cast<TeamInfo *>(ctx->team_opaque);
+  ctx_->ctx_create();
   return true;
 }
 
@@ -179,6 +217,7 @@ void IPCBackend::setup_team_world() {
   CHECK_HIP(hipMalloc(&team_world, sizeof(IPCTeam)));
   new (team_world) IPCTeam(this, team_info_wrt_parent, team_info_wrt_world,
                              num_pes, my_pe, thread_comm, 0);
+  setup_team_wrk(team_world, reduce_wrk_size, thread_comm);
   team_tracker.set_team_world(team_world);
 
   /**
@@ -208,6 +247,8 @@ void IPCBackend::init_mpi_once(MPI_Comm comm) {
 void IPCBackend::team_destroy(rocshmem_team_t team) {
   IPCTeam *team_obj = get_internal_ipc_team(team);
 
+  cleanup_team_wrk(team_obj);
+
   /* Mark the pool as available */
   int bit = team_obj->pool_index_;
   int byte_i = bit / CHAR_BIT;
@@ -221,6 +262,8 @@ void IPCBackend::create_new_team([[maybe_unused]] Team *parent_team,
                                 TeamInfo *team_info_wrt_parent,
                                 TeamInfo *team_info_wrt_world, int num_pes,
                                 int my_pe_in_new_team, MPI_Comm team_comm,
+                                const rocshmem_team_config_t *config,
+                                long config_mask,  // NOLINT(runtime/int)
                                 rocshmem_team_t *new_team) {
   /**
    * Read the bit mask and find out a common index into
@@ -252,6 +295,13 @@ void IPCBackend::create_new_team([[maybe_unused]] Team *parent_team,
       IPCTeam(this, team_info_wrt_parent, team_info_wrt_world, num_pes,
                 my_pe_in_new_team, team_comm, common_index);
 
+  size_t wrk_size{ROCSHMEM_REDUCE_MIN_WRKDATA_SIZE};
+  if (config_mask & ROCSHMEM_TEAM_REDUCE_WRK_SIZE) {
+    wrk_size = config->reduce_wrk_size;
+  }
+  setup_team_wrk(reinterpret_cast<IPCTeam *>(new_team_obj), wrk_size,
+                 team_comm);
+
   *new_team = get_external_team(new_team_obj);
 }
 
@@ -281,10 +331,22 @@ void IPCBackend::dump_backend_stats() {
 void IPCBackend::initIPC() {
   const auto &heap_bases{heap.get_heap_bases()};
 
-  ipcImpl.ipcHostInit(my_pe, heap_bases,
+  ipcImpl.ipcHostInit(my_pe, heap_bases, heap.get_base_size(),
                       thread_comm);
 }
 
+bool IPCBackend::grow_heap(size_t size) {
+  int segment{heap.grow(size)};
+  if (segment < 0) {
+    return false;
+  }
+  auto *segment_table{heap.get_segment_table()};
+  ipcImpl.ipcHostAddSegment(segment_table->get_local_base(segment),
+                            segment_table->get_size(segment));
+  host_interface->attach_segment(&heap, segment);
+  return true;
+}
+
 void IPCBackend::global_exit(int status) {
   assert(false);
 }
@@ -316,11 +378,11 @@ void IPCBackend::init_wrk_sync_buffer() {
 
   /**
    * Size of work arrays for the teams
-   * Accommodate largest possible data type for pWrk
+   * Accommodate largest possible data type for pWrk. Teams which need a
+   * larger one get their own buffer in setup_team_wrk.
   */
   Wrk_Sync_buffer_size_ += sizeof(double) * max_num_teams *
-                           (ROCSHMEM_REDUCE_MIN_WRKDATA_SIZE +
-                            ROCSHMEM_ATA_MAX_WRKDATA_SIZE);
+                           ROCSHMEM_REDUCE_MIN_WRKDATA_SIZE;
 
   /**
    * Size of fence array
@@ -397,6 +459,75 @@ void IPCBackend::setup_fence_buffer() {
   temp_Wrk_Sync_buff_ptr_ += sizeof(int) * num_pes;
 }
 
+void IPCBackend::setup_team_wrk(IPCTeam *team, size_t wrk_size,
+                                MPI_Comm team_comm) {
+  unsigned long long requested{wrk_size};  // NOLINT(runtime/int)
+  unsigned long long agreed{};  // NOLINT(runtime/int)
+  NET_CHECK(MPI_Allreduce(&requested, &agreed, 1, MPI_UNSIGNED_LONG_LONG,
+                          MPI_MAX, team_comm));
+  if (agreed <= ROCSHMEM_REDUCE_MIN_WRKDATA_SIZE) {
+    return;
+  }
+
+  char *wrk{nullptr};
+  fine_grained_allocator_.allocate(reinterpret_cast<void **>(&wrk),
+                                   agreed * sizeof(double));
+  assert(wrk);
+
+  char **bases{nullptr};
+  fine_grained_allocator_.allocate(reinterpret_cast<void **>(&bases),
+                                   num_pes * sizeof(char *));
+  assert(bases);
+  for (int i = 0; i < num_pes; i++) {
+    bases[i] = nullptr;
+  }
+
+  /*
+   * Exchange the IPC handles of the buffers along with the PE in
+   * TEAM_WORLD they belong to.
+   */
+  struct WrkHandle {
+    int pe;
+    hipIpcMemHandle_t handle;
+  };
+  int team_size{};
+  NET_CHECK(MPI_Comm_size(team_comm, &team_size));
+  std::vector<WrkHandle> handles(team_size);
+  WrkHandle mine{my_pe, {}};
+  CHECK_HIP(hipIpcGetMemHandle(&mine.handle, wrk));
+  NET_CHECK(MPI_Allgather(&mine, sizeof(WrkHandle), MPI_CHAR, handles.data(),
+                          sizeof(WrkHandle), MPI_CHAR, team_comm));
+
+  for (const auto &peer : handles) {
+    if (peer.pe == my_pe) {
+      bases[peer.pe] = wrk;
+    } else {
+      CHECK_HIP(hipIpcOpenMemHandle(
+          reinterpret_cast<void **>(&bases[peer.pe]), peer.handle,
+          hipIpcMemLazyEnablePeerAccess));
+    }
+  }
+
+  team->pWrk = wrk;
+  team->pWrk_size = agreed;
+  team->pWrk_bases = bases;
+  team->owns_pWrk = true;
+}
+
+void IPCBackend::cleanup_team_wrk(IPCTeam *team) {
+  if (!team->owns_pWrk) {
+    return;
+  }
+  for (int i = 0; i < num_pes; i++) {
+    if (i != my_pe && team->pWrk_bases[i]) {
+      CHECK_HIP(hipIpcCloseMemHandle(team->pWrk_bases[i]));
+    }
+  }
+  fine_grained_allocator_.deallocate(team->pWrk);
+  fine_grained_allocator_.deallocate(team->pWrk_bases);
+  team->owns_pWrk = false;
+}
+
 void IPCBackend::rocshmem_collective_init() {
   /*
    * Allocate heap space for barrier_sync
@@ -447,11 +578,6 @@ void IPCBackend::teams_init() {
   temp_Wrk_Sync_buff_ptr_ += sizeof(double) * ROCSHMEM_REDUCE_MIN_WRKDATA_SIZE
                             * max_num_teams;
 
-
-  pAta_pool = reinterpret_cast<void *>(temp_Wrk_Sync_buff_ptr_);
-  temp_Wrk_Sync_buff_ptr_ += sizeof(double) * ROCSHMEM_ATA_MAX_WRKDATA_SIZE
-                            * max_num_teams;
-
   /**
    * Initialize the sync arrays in the pool with default values.
    */
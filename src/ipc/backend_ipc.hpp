@@ -31,6 +31,9 @@
 #include "../context_incl.hpp"
 #include "ipc_context_proxy.hpp"
 #include "../ipc_policy.hpp"
+#include "../sync/alltoall_schedule.hpp"
+#include "../sync/barrier_schedule.hpp"
+#include "../sync/broadcast_schedule.hpp"
 
 namespace rocshmem {
 
@@ -66,6 +69,11 @@ class IPCBackend : public Backend {
    */
   void ctx_destroy(Context *ctx) override;
 
+  /**
+   * @copydoc Backend::grow_heap
+   */
+  bool grow_heap(size_t size) override;
+
    /**
    * @brief initialize MPI.
    *
@@ -103,6 +111,8 @@ class IPCBackend : public Backend {
   void create_new_team(Team *parent_team, TeamInfo *team_info_wrt_parent,
                        TeamInfo *team_info_wrt_world, int num_pes,
                        int my_pe_in_new_team, MPI_Comm team_comm,
+                       const rocshmem_team_config_t *config,
+                       long config_mask,  // NOLINT(runtime/int)
                        rocshmem_team_t *new_team) override;
 
   /**
@@ -115,7 +125,7 @@ class IPCBackend : public Backend {
    *
    * @return Vector containing the addresses of the work/sync bases
    */
-  char** get_wrk_sync_bases() { return Wrk_Sync_buffer_bases_; }
+  char** get_wrk_sync_bases() const { return Wrk_Sync_buffer_bases_; }
 
   /**
    * @brief Handle to device memory fields.
@@ -158,16 +168,31 @@ class IPCBackend : public Backend {
    */
   void *pWrk_pool{nullptr};
 
-  /**
-   * @brief Handle for raw memory for alltoall
-   */
-  void *pAta_pool{nullptr};
-
   /**
    * @brief Handle for raw memory for fence/quiet
   */
   int *fence_pool{nullptr};
 
+  /**
+   * @brief Bytes per chunk of the pipelined broadcast
+   */
+  size_t bcast_chunk_size{BROADCAST_DEFAULT_CHUNK_SIZE};
+
+  /**
+   * @brief Peer order of alltoall and fcollect
+   */
+  AlltoallSchedule alltoall_schedule{AlltoallSchedule::AUTO};
+
+  /**
+   * @brief Team barrier requested through ROCSHMEM_BARRIER_KIND
+   */
+  BarrierKind forced_barrier_kind{BarrierKind::AUTO};
+
+  /**
+   * @brief Elements of the TEAM_WORLD reduction work array
+   */
+  size_t reduce_wrk_size{ROCSHMEM_REDUCE_MIN_WRKDATA_SIZE};
+
  protected:
    /**
    * @copydoc Backend::dump_backend_stats()
@@ -220,6 +245,29 @@ class IPCBackend : public Backend {
    */
   void setup_fence_buffer();
 
+  /**
+   * @brief Gives a team a reduction work array of at least wrk_size
+   * elements.
+   *
+   * The size is agreed on by taking the maximum over the team. Sizes up
+   * to ROCSHMEM_REDUCE_MIN_WRKDATA_SIZE keep the team's slot in the pool;
+   * larger ones allocate a buffer for the team and open the buffers of
+   * the other members through IPC handles. Must be called by all PEs in
+   * the team.
+   *
+   * @param[in] team Team to set up.
+   * @param[in] wrk_size Elements requested by this PE.
+   * @param[in] team_comm MPI communicator of the team.
+   */
+  void setup_team_wrk(IPCTeam *team, size_t wrk_size, MPI_Comm team_comm);
+
+  /**
+   * @brief Releases a work array allocated by setup_team_wrk
+   *
+   * @param[in] team Team whose work array to release.
+   */
+  void cleanup_team_wrk(IPCTeam *team);
+
  private:
   /**
    * @brief Proxy for the default context
@@ -40,6 +40,7 @@ __host__ IPCContext::IPCContext(Backend *b)
     : Context(b, false) {
   IPCBackend *backend{static_cast<IPCBackend *>(b)};
   ipcImpl_.ipc_bases = b->ipcImpl.ipc_bases;
+  ipcImpl_.ipc_segments = b->ipcImpl.ipc_segments;
   ipcImpl_.shm_size = b->ipcImpl.shm_size;
 
   auto *bp{backend->ipc_backend_proxy.get()};
@@ -48,6 +49,10 @@ __host__ IPCContext::IPCContext(Backend *b)
   g_ret = bp->g_ret;
   atomic_base_ptr = bp->atomic_ret->atomic_base_ptr;
   fence_pool = backend->fence_pool;
+  bcast_chunk_size = backend->bcast_chunk_size;
+  alltoall_schedule = backend->alltoall_schedule;
+  forced_barrier_kind = backend->forced_barrier_kind;
+  track_dirty_pes_ = DirtyPeMask::fits(num_pes);
   Wrk_Sync_buffer_bases_ = backend->get_wrk_sync_bases();
 
   orders_.store = detail::atomic::rocshmem_memory_order::memory_order_seq_cst;
@@ -58,6 +63,7 @@ __device__ void IPCContext::threadfence_system() {
 }
 
 __device__ void IPCContext::ctx_create() {
+  dirty_pes_.clear();
 }
 
 __device__ void IPCContext::ctx_destroy(){
@@ -65,36 +71,51 @@ __device__ void IPCContext::ctx_destroy(){
 
 __device__ void IPCContext::putmem(void *dest, const void *source, size_t nelems,
                                   int pe) {
-  uint64_t L_offset =
-      reinterpret_cast<char *>(dest) - ipcImpl_.ipc_bases[my_pe];
-  ipcImpl_.ipcCopy(ipcImpl_.ipc_bases[pe] + L_offset,
+  ipcImpl_.ipcCopy(ipcImpl_.ipcTranslate(dest, pe),
                    const_cast<void *>(source), nelems);
   ipcImpl_.ipcFence();
 }
 
 __device__ void IPCContext::getmem(void *dest, const void *source, size_t nelems,
                                   int pe) {
-  const char *src_typed = reinterpret_cast<const char *>(source);
-  uint64_t L_offset =
-      const_cast<char *>(src_typed) - ipcImpl_.ipc_bases[my_pe];
-  ipcImpl_.ipcCopy(dest, ipcImpl_.ipc_bases[pe] + L_offset, nelems);
+  ipcImpl_.ipcCopy(dest, ipcImpl_.ipcTranslate(source, pe), nelems);
   ipcImpl_.ipcFence();
 }
 
+/*
+ * The non-blocking copies skip the system-scope fence of their blocking
+ * counterparts; fence and quiet order and complete them. The target is
+ * recorded so that fence and quiet only visit PEs which were written to.
+ */
 __device__ void IPCContext::putmem_nbi(void *dest, const void *source,
                                       size_t nelems, int pe) {
-  putmem(dest, source, nelems, pe);
+  mark_dirty_pe(pe);
+  ipcImpl_.ipcCopy(ipcImpl_.ipcTranslate(dest, pe),
+                   const_cast<void *>(source), nelems);
 }
 
 __device__ void IPCContext::getmem_nbi(void *dest, const void *source,
                                       size_t nelems, int pe) {
-  getmem(dest, source, nelems, pe);
+  mark_dirty_pe(pe);
+  ipcImpl_.ipcCopy(dest, ipcImpl_.ipcTranslate(source, pe), nelems);
 }
 
+/*
+ * Blocking copies and atomics complete at system scope before returning,
+ * so only the PEs in dirty_pes_ need ordering. The system-scope fence is
+ * always issued: it orders this thread's stores through rocshmem_ptr and
+ * its copies whose bits another thread's fence already took.
+ */
 __device__ void IPCContext::fence() {
-  for (int i{0}, j{tinfo->pe_start}; i < tinfo->size; i++, j += tinfo->stride) {
-    detail::atomic::store<int, detail::atomic::memory_scope_system>(&fence_pool[j], 1, orders_);
+  __threadfence_system();
+  if (!track_dirty_pes_) {
+    for (int i{0}, j{tinfo->pe_start}; i < tinfo->size;
+         i++, j += tinfo->stride) {
+      fence(j);
+    }
+    return;
   }
+  dirty_pes_.next_epoch([this](int pe) { fence(pe); });
 }
 
 __device__ void IPCContext::fence(int pe) {
@@ -105,26 +126,53 @@ __device__ void IPCContext::quiet() {
   fence();
 }
 
+__device__ void IPCContext::mark_dirty_pe(int pe) {
+  if (!track_dirty_pes_) {
+    return;
+  }
+  bool pending{!dirty_pes_.test(pe)};
+  uint64_t lanes{__ballot(pending)};
+  while (lanes) {
+    int leader = __ffsll(lanes) - 1;
+    int leader_pe = __shfl(pe, leader);
+    if (pending && pe == leader_pe) {
+      if (static_cast<int>(get_flat_block_id() % WF_SIZE) == leader) {
+        dirty_pes_.mark(pe);
+      }
+      pending = false;
+    }
+    lanes = __ballot(pending);
+  }
+}
+
 __device__ void *IPCContext::shmem_ptr(const void *dest, int pe) {
   void *ret = nullptr;
+  if (ipcImpl_.isIpcAvailable(my_pe, pe)) {
+    ret = ipcImpl_.ipcTranslate(dest, pe);
+  }
   return ret;
 }
 
+__device__ void IPCContext::host_callback(int id, const uint64_t *args,
+                                          int nargs, uint64_t *sig_addr,
+                                          uint64_t signal) {
+  // No host proxy serves this backend; registration returns -1 instead.
+  GPU_DPRINTF("Host callbacks are not supported by IPC.\n");
+  assert(false);
+}
+
 __device__ void IPCContext::putmem_wg(void *dest, const void *source,
                                      size_t nelems, int pe) {
-  uint64_t L_offset =
-      reinterpret_cast<char *>(dest) - ipcImpl_.ipc_bases[my_pe];
-  ipcImpl_.ipcCopy_wg(ipcImpl_.ipc_bases[pe] + L_offset,
+  mark_dirty_pe(pe);
+  ipcImpl_.ipcCopy_wg(ipcImpl_.ipcTranslate(dest, pe),
                       const_cast<void *>(source), nelems);
   __syncthreads();
 }
 
 __device__ void IPCContext::getmem_wg(void *dest, const void *source,
                                      size_t nelems, int pe) {
-  const char *src_typed = reinterpret_cast<const char *>(source);
-  uint64_t L_offset =
-      const_cast<char *>(src_typed) - ipcImpl_.ipc_bases[my_pe];
-  ipcImpl_.ipcCopy_wg(dest, ipcImpl_.ipc_bases[pe] + L_offset, nelems);
+  mark_dirty_pe(pe);
+  ipcImpl_.ipcCopy_wg(dest, ipcImpl_.ipcTranslate(source, pe), nelems);
   __syncthreads();
 }
 
@@ -140,39 +188,36 @@ __device__ void IPCContext::getmem_nbi_wg(void *dest, const void *source,
 
 __device__ void IPCContext::putmem_wave(void *dest, const void *source,
                                        size_t nelems, int pe) {
-  uint64_t L_offset =
-      reinterpret_cast<char *>(dest) - ipcImpl_.ipc_bases[my_pe];
-  ipcImpl_.ipcCopy_wave(ipcImpl_.ipc_bases[pe] + L_offset,
+  ipcImpl_.ipcCopy_wave(ipcImpl_.ipcTranslate(dest, pe),
                         const_cast<void *>(source), nelems);
   ipcImpl_.ipcFence();
 }
 
 __device__ void IPCContext::getmem_wave(void *dest, const void *source,
                                        size_t nelems, int pe) {
-  const char *src_typed = reinterpret_cast<const char *>(source);
-  uint64_t L_offset =
-      const_cast<char *>(src_typed) - ipcImpl_.ipc_bases[my_pe];
-  ipcImpl_.ipcCopy_wave(dest, ipcImpl_.ipc_bases[pe] + L_offset,
-                        nelems);
+  ipcImpl_.ipcCopy_wave(dest, ipcImpl_.ipcTranslate(source, pe), nelems);
   ipcImpl_.ipcFence();
 }
 
 __device__ void IPCContext::putmem_nbi_wave(void *dest, const void *source,
                                            size_t nelems, int pe) {
-  putmem_wave(dest, source, nelems, pe);
+  mark_dirty_pe(pe);
+  ipcImpl_.ipcCopy_wave(ipcImpl_.ipcTranslate(dest, pe),
+                        const_cast<void *>(source), nelems);
 }
 
 __device__ void IPCContext::getmem_nbi_wave(void *dest, const void *source,
                                            size_t nelems, int pe) {
-  getmem_wave(dest, source, nelems, pe);
+  mark_dirty_pe(pe);
+  ipcImpl_.ipcCopy_wave(dest, ipcImpl_.ipcTranslate(source, pe), nelems);
 }
 
 __device__ void IPCContext::internal_putmem(void *dest, const void *source,
                                             size_t nelems, int pe) {
   uint64_t L_offset =
       reinterpret_cast<char *>(dest) - Wrk_Sync_buffer_bases_[my_pe];
-  memcpy(Wrk_Sync_buffer_bases_[pe] + L_offset,
-                   const_cast<void *>(source), nelems);
+  memcpy_vec(Wrk_Sync_buffer_bases_[pe] + L_offset,
+             const_cast<void *>(source), nelems);
   ipcImpl_.ipcFence();
 }
 
@@ -181,16 +226,20 @@ __device__ void IPCContext::internal_getmem(void *dest, const void *source,
   const char *src_typed = reinterpret_cast<const char *>(source);
   uint64_t L_offset =
       const_cast<char *>(src_typed) - Wrk_Sync_buffer_bases_[my_pe];
-  memcpy(dest, Wrk_Sync_buffer_bases_[pe] + L_offset, nelems);
+  memcpy_vec(dest, Wrk_Sync_buffer_bases_[pe] + L_offset, nelems);
   ipcImpl_.ipcFence();
 }
 
 __device__ void IPCContext::internal_putmem_wg(void *dest, const void *source,
                                      size_t nelems, int pe) {
-  uint64_t L_offset =
-      reinterpret_cast<char *>(dest) - Wrk_Sync_buffer_bases_[my_pe];
-  memcpy_wg(Wrk_Sync_buffer_bases_[pe] + L_offset,
-                      const_cast<void *>(source), nelems);
+  internal_putmem_wg(dest, source, nelems, pe, Wrk_Sync_buffer_bases_);
+}
+
+__device__ void IPCContext::internal_putmem_wg(void *dest, const void *source,
+                                               size_t nelems, int pe,
+                                               char **bases) {
+  uint64_t L_offset = reinterpret_cast<char *>(dest) - bases[my_pe];
+  memcpy_vec_wg(bases[pe] + L_offset, const_cast<void *>(source), nelems);
   __syncthreads();
 }
 
@@ -199,7 +248,7 @@ __device__ void IPCContext::internal_getmem_wg(void *dest, const void *source,
   const char *src_typed = reinterpret_cast<const char *>(source);
   uint64_t L_offset =
       const_cast<char *>(src_typed) - Wrk_Sync_buffer_bases_[my_pe];
-  memcpy_wg(dest, Wrk_Sync_buffer_bases_[pe] + L_offset, nelems);
+  memcpy_vec_wg(dest, Wrk_Sync_buffer_bases_[pe] + L_offset, nelems);
   __syncthreads();
 }
 
@@ -207,8 +256,8 @@ __device__ void IPCContext::internal_putmem_wave(void *dest,
                         const void *source, size_t nelems, int pe) {
   uint64_t L_offset =
       reinterpret_cast<char *>(dest) - Wrk_Sync_buffer_bases_[my_pe];
-  memcpy_wave(Wrk_Sync_buffer_bases_[pe] + L_offset,
-                        const_cast<void *>(source), nelems);
+  memcpy_vec_wave(Wrk_Sync_buffer_bases_[pe] + L_offset,
+                  const_cast<void *>(source), nelems);
   ipcImpl_.ipcFence();
 }
 
@@ -217,11 +266,20 @@ __device__ void IPCContext::internal_getmem_wave(void *dest,
   const char *src_typed = reinterpret_cast<const char *>(source);
   uint64_t L_offset =
       const_cast<char *>(src_typed) - Wrk_Sync_buffer_bases_[my_pe];
-  memcpy_wave(dest, Wrk_Sync_buffer_bases_[pe] + L_offset,
-                        nelems);
+  memcpy_vec_wave(dest, Wrk_Sync_buffer_bases_[pe] + L_offset,
+                  nelems);
   ipcImpl_.ipcFence();
 }
 
+__device__ void IPCContext::internal_amo_add(int64_t *dest, int64_t value,
+                                             int pe) {
+  uint64_t L_offset =
+      reinterpret_cast<char *>(dest) - Wrk_Sync_buffer_bases_[my_pe];
+  ipcImpl_.ipcAMOAdd(
+      reinterpret_cast<int64_t *>(Wrk_Sync_buffer_bases_[pe] + L_offset),
+      value);
+}
+
 __device__ void IPCContext::putmem_signal(void *dest, const void *source, size_t nelems,
                                           uint64_t *sig_addr, uint64_t signal, int sig_op,
                                           int pe) {
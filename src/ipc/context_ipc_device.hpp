@@ -26,6 +26,12 @@
 #include "../context.hpp"
 #include "../atomic.hpp"
 #include "../team.hpp"
+#include "../memory/dirty_pe_mask.hpp"
+#include "../sync/allreduce_schedule.hpp"
+#include "../sync/alltoall_schedule.hpp"
+#include "../sync/barrier_schedule.hpp"
+#include "../sync/broadcast_schedule.hpp"
+#include "../sync/grid_partition.hpp"
 
 namespace rocshmem {
 
@@ -59,6 +65,9 @@ class IPCContext : public Context {
 
   __device__ void *shmem_ptr(const void *dest, int pe);
 
+  __device__ void host_callback(int id, const uint64_t *args, int nargs,
+                                uint64_t *sig_addr, uint64_t signal);
+
   __device__ void barrier_all();
 
   __device__ void sync_all();
@@ -83,6 +92,14 @@ class IPCContext : public Context {
   template <typename T>
   __device__ void get_nbi(T *dest, const T *source, size_t nelems, int pe);
 
+  template <typename T>
+  __device__ void iput(T *dest, const T *source, ptrdiff_t dst, ptrdiff_t sst,
+                       size_t nelems, int pe);
+
+  template <typename T>
+  __device__ void iget(T *dest, const T *source, ptrdiff_t dst, ptrdiff_t sst,
+                       size_t nelems, int pe);
+
   // Atomic operations
   template <typename T>
   __device__ void amo_add(void *dst, T value, int pe);
@@ -135,6 +152,22 @@ class IPCContext : public Context {
   __device__ void fcollect(rocshmem_team_t team, T *dest, const T *source,
                            int nelems);
 
+  // Grid collectives: every workgroup of the grid takes part
+  template <typename T, ROCSHMEM_OP Op>
+  __device__ int reduce_grid(rocshmem_team_t team, T *dest, const T *source,
+                             int nreduce);
+
+  template <typename T>
+  __device__ void broadcast_grid(rocshmem_team_t team, T *dest,
+                                 const T *source, int nelems, int pe_root);
+
+  template <typename T>
+  __device__ void alltoall_grid(rocshmem_team_t team, T *dest,
+                                const T *source, int nelems);
+
+  template <typename T>
+  __device__ void fcollect_grid(rocshmem_team_t team, T *dest,
+                                const T *source, int nelems);
 
   // Block/wave functions
   __device__ void putmem_wg(void *dest, const void *source, size_t nelems,
@@ -186,6 +219,14 @@ class IPCContext : public Context {
   template <typename T>
   __device__ void get_nbi_wave(T *dest, const T *source, size_t nelems, int pe);
 
+  template <typename T>
+  __device__ void iput_wave(T *dest, const T *source, ptrdiff_t dst,
+                            ptrdiff_t sst, size_t nelems, int pe);
+
+  template <typename T>
+  __device__ void iget_wave(T *dest, const T *source, ptrdiff_t dst,
+                            ptrdiff_t sst, size_t nelems, int pe);
+
 #define IPC_CONTEXT_PUT_SIGNAL_DEC(SUFFIX)                                               \
   template <typename T>                                                                  \
   __device__ void put_signal##SUFFIX(T *dest, const T *source, size_t nelems,            \
@@ -231,6 +272,13 @@ class IPCContext : public Context {
   __device__ void internal_get_broadcast(T *dst, const T *src, int nelems,
                                          int pe_root);  // NOLINT(runtime/int)
 
+  template <typename T>
+  __device__ void internal_pipelined_broadcast(T *dst, const T *src,
+                                               int nelems, int pe_root,
+                                               int pe_start, int stride,
+                                               int pe_size,
+                                               long *p_sync);  // NOLINT(runtime/int)
+
   template <typename T>
   __device__ void fcollect_linear(rocshmem_team_t team, T *dest,
                                   const T *source, int nelems);
@@ -239,14 +287,39 @@ class IPCContext : public Context {
   __device__ void alltoall_linear(rocshmem_team_t team, T *dest,
                                   const T *source, int nelems);
 
+  template <typename T>
+  __device__ void fcollect_pairwise(rocshmem_team_t team, T *dest,
+                                    const T *source, int nelems);
+
+  template <typename T>
+  __device__ void alltoall_pairwise(rocshmem_team_t team, T *dest,
+                                    const T *source, int nelems);
+
+  __device__ AlltoallSchedule select_alltoall_schedule(int n_pes,
+                                                      size_t bytes_per_peer);
+
   __device__ void internal_sync(int pe, int PE_start, int stride, int PE_size,
                                 int64_t *pSync);
 
+  /**
+   * @brief Barrier of all workgroups of the grid on every PE of the team
+   *
+   * The workgroups of this PE meet on the team's grid_notifier, the first
+   * one runs the team barrier on pSync, and all of them wait for it to
+   * finish.
+   */
+  __device__ void internal_grid_sync(IPCTeam *team_obj,
+                                     long *pSync);  // NOLINT(runtime/int)
+
   __device__ void internal_direct_barrier(int pe, int PE_start, int stride,
                                           int n_pes, int64_t *pSync);
 
-  __device__ void internal_atomic_barrier(int pe, int PE_start, int stride,
-                                          int n_pes, int64_t *pSync);
+  __device__ void internal_tree_barrier(int pe, int PE_start, int stride,
+                                        int n_pes, int64_t *pSync);
+
+  __device__ void internal_dissemination_barrier(int pe, int PE_start,
+                                                 int stride, int n_pes,
+                                                 int64_t *pSync);
 
   template <typename T, ROCSHMEM_OP Op>
   __device__ void internal_direct_allreduce(T *dst, const T *src,
@@ -255,6 +328,10 @@ class IPCContext : public Context {
   __device__ void internal_ring_allreduce(T *dst, const T *src,
                                           int nelems, IPCTeam *team_obj,
 					  int n_seg, int seg_size, int chunk_size);
+  template <typename T, ROCSHMEM_OP Op>
+  __device__ void internal_scheduled_allreduce(T *dst, const T *src,
+                                               int nelems, IPCTeam *team_obj,
+                                               AllreduceAlgorithm algo);
 
   //internal functions used by collectives routines to write/read to
   //work/sync buffers
@@ -267,6 +344,10 @@ class IPCContext : public Context {
   __device__ void internal_putmem_wg(void *dest, const void *source,
                                     size_t nelems, int pe);
 
+  //Same as above for a buffer described by bases, such as a team's pWrk
+  __device__ void internal_putmem_wg(void *dest, const void *source,
+                                     size_t nelems, int pe, char **bases);
+
   __device__ void internal_getmem_wg(void *dest, const void *source,
                                     size_t nelems, int pe);
 
@@ -276,6 +357,16 @@ class IPCContext : public Context {
   __device__ void internal_getmem_wave(void *dest, const void *source,
                                       size_t nelems, int pe);
 
+  __device__ void internal_amo_add(int64_t *dest, int64_t value, int pe);
+
+  /**
+   * @brief Records a copy to pe which fence and quiet must order
+   *
+   * Lanes of a wavefront targeting the same PE share one update of the
+   * mask, issued by the lowest of them.
+   */
+  __device__ void mark_dirty_pe(int pe);
+
   //Temporary scratchpad memory used by internal barrier algorithms.
   int64_t *barrier_sync{nullptr};
 
@@ -285,6 +376,22 @@ class IPCContext : public Context {
   //Buffer to perform Atomic store to enforce memory ordering
   int *fence_pool{nullptr};
 
+  //PEs targeted since the last fence by copies which complete without a
+  //system-scope fence; collective work copies are not tracked
+  DirtyPeMask dirty_pes_{};
+
+  //True if every PE fits in dirty_pes_; fence covers the team otherwise
+  bool track_dirty_pes_{false};
+
+  //Bytes per chunk of the pipelined broadcast
+  size_t bcast_chunk_size{BROADCAST_DEFAULT_CHUNK_SIZE};
+
+  //Peer order of alltoall and fcollect
+  AlltoallSchedule alltoall_schedule{AlltoallSchedule::AUTO};
+
+  //Team barrier requested through ROCSHMEM_BARRIER_KIND
+  BarrierKind forced_barrier_kind{BarrierKind::AUTO};
+
   /**
    * @brief Array containing the addresses of the work/sync buffer bases
    * of other PEs
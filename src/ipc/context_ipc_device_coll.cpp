@@ -24,6 +24,7 @@
 #include "../context_incl.hpp"
 #include "context_ipc_tmpl_device.hpp"
 #include "../util.hpp"
+#include "../sync/barrier_schedule.hpp"
 #include "ipc_team.hpp"
 
 namespace rocshmem {
@@ -64,40 +65,106 @@ __device__ void IPCContext::internal_direct_barrier(int pe, int PE_start,
   }
 }
 
-__device__ void IPCContext::internal_atomic_barrier(int pe, int PE_start,
-                                                      int stride, int n_pes,
-                                                      int64_t *pSync) {
+__device__ void IPCContext::internal_tree_barrier(int pe, int PE_start,
+                                                  int stride, int n_pes,
+                                                  int64_t *pSync) {
   int64_t flag_val = 1;
-  if (pe == PE_start) {
-    wait_until(&pSync[0], ROCSHMEM_CMP_EQ, (int64_t)(n_pes - 1));
-    pSync[0] = ROCSHMEM_SYNC_VALUE;
-    threadfence_system();
+  int rank = (pe - PE_start) / stride;
+  int num_children = tree_num_children(rank, BARRIER_TREE_RADIX, n_pes);
 
-    for (int i = 1, j = PE_start + stride; i < n_pes; ++i, j += stride) {
-      internal_putmem(&pSync[0], &flag_val, sizeof(*pSync), j);
-    }
-  } else {
-    amo_add<int64_t>(&pSync[0], flag_val, PE_start);
-    wait_until(&pSync[0], ROCSHMEM_CMP_EQ, flag_val);
-    pSync[0] = ROCSHMEM_SYNC_VALUE;
+  // Wait until the whole subtree has arrived
+  for (int i = 0; i < num_children; i++) {
+    wait_until(&pSync[BARRIER_TREE_ARRIVAL_SLOT + i], ROCSHMEM_CMP_EQ,
+               flag_val);
+    pSync[BARRIER_TREE_ARRIVAL_SLOT + i] = ROCSHMEM_SYNC_VALUE;
+  }
+  threadfence_system();
+
+  if (rank != 0) {
+    int parent = PE_start + tree_parent(rank, BARRIER_TREE_RADIX) * stride;
+    int slot = BARRIER_TREE_ARRIVAL_SLOT +
+               tree_child_index(rank, BARRIER_TREE_RADIX);
+    internal_putmem(&pSync[slot], &flag_val, sizeof(*pSync), parent);
+#if defined(__gfx90a__)
+    __threadfence_system();
+#endif /* __gfx90a__ */
+    wait_until(&pSync[BARRIER_TREE_RELEASE_SLOT], ROCSHMEM_CMP_EQ, flag_val);
+    pSync[BARRIER_TREE_RELEASE_SLOT] = ROCSHMEM_SYNC_VALUE;
     threadfence_system();
   }
+
+  // Release the children
+  int child = tree_first_child(rank, BARRIER_TREE_RADIX);
+  for (int i = 0; i < num_children; i++, child++) {
+    internal_putmem(&pSync[BARRIER_TREE_RELEASE_SLOT], &flag_val,
+                    sizeof(*pSync), PE_start + child * stride);
+  }
+}
+
+__device__ void IPCContext::internal_dissemination_barrier(int pe,
+                                                           int PE_start,
+                                                           int stride,
+                                                           int n_pes,
+                                                           int64_t *pSync) {
+  int rank = (pe - PE_start) / stride;
+  int rounds = dissemination_rounds(n_pes);
+
+  /*
+   * The round flags count signals instead of being set and reset: a
+   * neighbour which already left this barrier may signal the same round
+   * of the next one before we have consumed this one.
+   */
+  threadfence_system();
+  for (int round = 0; round < rounds; round++) {
+    int to = PE_start + dissemination_to(rank, round, n_pes) * stride;
+    internal_amo_add(&pSync[round], 1, to);
+    wait_until(&pSync[round], ROCSHMEM_CMP_GE, (int64_t)1);
+    internal_amo_add(&pSync[round], -1, pe);
+  }
+  threadfence_system();
 }
 
 // Uses PE values that are relative to world
+__device__ AlltoallSchedule IPCContext::select_alltoall_schedule(
+    int n_pes, size_t bytes_per_peer) {
+  int num_waves = (get_flat_block_size() + WF_SIZE - 1) / WF_SIZE;
+  return alltoall_select(alltoall_schedule, n_pes, bytes_per_peer,
+                         num_waves);
+}
+
 __device__ void IPCContext::internal_sync(int pe, int PE_start, int stride,
                                           int PE_size, int64_t *pSync) {
   __syncthreads();
   if (is_thread_zero_in_block()) {
-    if (PE_size < 64) {
-      internal_direct_barrier(pe, PE_start, stride, PE_size, pSync);
-    } else {
-      internal_atomic_barrier(pe, PE_start, stride, PE_size, pSync);
+    switch (barrier_select(forced_barrier_kind, PE_size)) {
+      case BarrierKind::DIRECT:
+        internal_direct_barrier(pe, PE_start, stride, PE_size, pSync);
+        break;
+      case BarrierKind::TREE:
+        internal_tree_barrier(pe, PE_start, stride, PE_size, pSync);
+        break;
+      case BarrierKind::DISSEMINATION:
+        internal_dissemination_barrier(pe, PE_start, stride, PE_size, pSync);
+        break;
+      case BarrierKind::AUTO:
+        break;
     }
   }
   __syncthreads();
 }
 
+__device__ void IPCContext::internal_grid_sync(IPCTeam *team_obj,
+                                               long *pSync) {  // NOLINT
+  threadfence_system();
+  team_obj->grid_notifier.sync();
+  if (get_flat_grid_id() == 0) {
+    internal_sync(my_pe, team_obj->tinfo_wrt_world->pe_start,
+                  team_obj->tinfo_wrt_world->stride, team_obj->num_pes,
+                  pSync);
+  }
+  team_obj->grid_notifier.sync();
+}
+
 __device__ void IPCContext::sync(rocshmem_team_t team) {
   IPCTeam *team_obj = reinterpret_cast<IPCTeam *>(team);
 
@@ -33,13 +33,13 @@
 namespace rocshmem {
 
 __host__ IPCHostContext::IPCHostContext(Backend *backend,
-                                            [[maybe_unused]] int64_t options)
+                                            int64_t options)
     : Context(backend, true) {
   IPCBackend *b{static_cast<IPCBackend *>(backend)};
 
   host_interface = b->host_interface;
 
-  context_window_info = host_interface->acquire_window_context();
+  context_window_info = host_interface->acquire_window_context(options);
 }
 
 __host__ IPCHostContext::~IPCHostContext() {
@@ -56,6 +56,11 @@ __host__ void IPCHostContext::getmem_nbi(void *dest, const void *source,
   host_interface->getmem_nbi(dest, source, nelems, pe, context_window_info);
 }
 
+__host__ void IPCHostContext::batch(const rocshmem_batch_op_t *ops,
+                                    size_t nops) {
+  host_interface->batch(ops, nops, context_window_info);
+}
+
 __host__ void IPCHostContext::putmem(void *dest, const void *source,
                                        size_t nelems, int pe) {
   host_interface->putmem(dest, source, nelems, pe, context_window_info);
@@ -82,4 +87,16 @@ __host__ void IPCHostContext::barrier_all() {
   host_interface->barrier_all(context_window_info);
 }
 
+__host__ void IPCHostContext::barrier_all_nbi(rocshmem_request_t *request) {
+  host_interface->barrier_all_nbi(context_window_info, request);
+}
+
+__host__ int IPCHostContext::test_request(rocshmem_request_t *request) {
+  return HostInterface::test_request(request);
+}
+
+__host__ void IPCHostContext::wait_request(rocshmem_request_t *request) {
+  HostInterface::wait_request(request);
+}
+
 }  // namespace rocshmem
@@ -51,6 +51,14 @@ class IPCHostContext : public Context {
   template <typename T>
   __host__ void get_nbi(T *dest, const T *source, size_t nelems, int pe);
 
+  template <typename T>
+  __host__ void iput(T *dest, const T *source, ptrdiff_t dst, ptrdiff_t sst,
+                     size_t nelems, int pe);
+
+  template <typename T>
+  __host__ void iget(T *dest, const T *source, ptrdiff_t dst, ptrdiff_t sst,
+                     size_t nelems, int pe);
+
   __host__ void putmem(void *dest, const void *source, size_t nelems, int pe);
 
   __host__ void getmem(void *dest, const void *source, size_t nelems, int pe);
@@ -60,6 +68,8 @@ class IPCHostContext : public Context {
 
   __host__ void getmem_nbi(void *dest, const void *source, size_t size, int pe);
 
+  __host__ void batch(const rocshmem_batch_op_t *ops, size_t nops);
+
   template <typename T>
   __host__ void amo_add(void *dst, T value, int pe);
 
@@ -80,6 +90,12 @@ class IPCHostContext : public Context {
 
   __host__ void sync_all();
 
+  __host__ void barrier_all_nbi(rocshmem_request_t *request);
+
+  __host__ int test_request(rocshmem_request_t *request);
+
+  __host__ void wait_request(rocshmem_request_t *request);
+
   template <typename T>
   __host__ void broadcast(T *dest, const T *source, int nelems, int pe_root,
                           int pe_start, int log_pe_stride, int pe_size,
@@ -97,6 +113,29 @@ class IPCHostContext : public Context {
   template <typename T, ROCSHMEM_OP Op>
   __host__ int reduce(rocshmem_team_t team, T *dest, const T *source, int nreduce);
 
+  template <typename T>
+  __host__ void broadcast_nbi(rocshmem_team_t team, T *dest, const T *source,
+                              int nelems, int pe_root,
+                              rocshmem_request_t *request);
+
+  template <typename T, ROCSHMEM_OP Op>
+  __host__ int reduce_nbi(rocshmem_team_t team, T *dest, const T *source,
+                          int nreduce, rocshmem_request_t *request);
+
+  template <typename T>
+  __host__ void alltoall(rocshmem_team_t team, T *dest, const T *source,
+                         int nelems);
+
+  template <typename T>
+  __host__ void alltoallv(rocshmem_team_t team, T *dest,
+                          const int *dest_counts, const int *dest_displs,
+                          const T *source, const int *source_counts,
+                          const int *source_displs);
+
+  template <typename T>
+  __host__ void fcollect(rocshmem_team_t team, T *dest, const T *source,
+                         int nelems);
+
   template <typename T>
   __host__ void wait_until(T *ivars, int cmp, T val);
 
@@ -37,7 +37,7 @@ namespace rocshmem {
  *****************************************************************************/
 template <typename T>
 __device__ void IPCContext::p(T *dest, T value, int pe) {
-  putmem_nbi(dest, &value, sizeof(T), pe);
+  putmem(dest, &value, sizeof(T), pe);
 }
 
 template <typename T>
@@ -70,21 +70,38 @@ __device__ void IPCContext::get_nbi(T *dest, const T *source, size_t nelems,
   getmem_nbi(dest, source, sizeof(T) * nelems, pe);
 }
 
+template <typename T>
+__device__ void IPCContext::iput(T *dest, const T *source, ptrdiff_t dst,
+                                 ptrdiff_t sst, size_t nelems, int pe) {
+  T *remote_dest{reinterpret_cast<T *>(ipcImpl_.ipcTranslate(dest, pe))};
+  for (size_t i{0}; i < nelems; i++) {
+    remote_dest[i * dst] = source[i * sst];
+  }
+  ipcImpl_.ipcFence();
+}
+
+template <typename T>
+__device__ void IPCContext::iget(T *dest, const T *source, ptrdiff_t dst,
+                                 ptrdiff_t sst, size_t nelems, int pe) {
+  const T *remote_source{
+      reinterpret_cast<const T *>(ipcImpl_.ipcTranslate(source, pe))};
+  for (size_t i{0}; i < nelems; i++) {
+    dest[i * dst] = remote_source[i * sst];
+  }
+  ipcImpl_.ipcFence();
+}
+
 // Atomics
 template <typename T>
 __device__ void IPCContext::amo_add(void *dest, T value, int pe) {
-  uint64_t L_offset =
-      reinterpret_cast<char *>(dest) - ipcImpl_.ipc_bases[my_pe];
   ipcImpl_.ipcAMOAdd(
-      reinterpret_cast<T *>(ipcImpl_.ipc_bases[pe] + L_offset), value);
+      reinterpret_cast<T *>(ipcImpl_.ipcTranslate(dest, pe)), value);
 }
 
 template <typename T>
 __device__ void IPCContext::amo_set(void *dest, T value, int pe) {
-  uint64_t L_offset =
-      reinterpret_cast<char *>(dest) - ipcImpl_.ipc_bases[my_pe];
   ipcImpl_.ipcAMOSet(
-      reinterpret_cast<T *>(ipcImpl_.ipc_bases[pe] + L_offset), value);
+      reinterpret_cast<T *>(ipcImpl_.ipcTranslate(dest, pe)), value);
 }
 
 template <typename T>
@@ -128,27 +145,21 @@ __device__ void IPCContext::amo_xor(void *dst, T value, int pe) {
 
 template <typename T>
 __device__ void IPCContext::amo_cas(void *dest, T value, T cond, int pe) {
-  uint64_t L_offset =
-      reinterpret_cast<char *>(dest) - ipcImpl_.ipc_bases[my_pe];
   ipcImpl_.ipcAMOCas(
-      reinterpret_cast<T *>(ipcImpl_.ipc_bases[pe] + L_offset), cond,
+      reinterpret_cast<T *>(ipcImpl_.ipcTranslate(dest, pe)), cond,
       value);
 }
 
 template <typename T>
 __device__ T IPCContext::amo_fetch_add(void *dest, T value, int pe) {
-  uint64_t L_offset =
-      reinterpret_cast<char *>(dest) - ipcImpl_.ipc_bases[my_pe];
   return ipcImpl_.ipcAMOFetchAdd(
-      reinterpret_cast<T *>(ipcImpl_.ipc_bases[pe] + L_offset), value);
+      reinterpret_cast<T *>(ipcImpl_.ipcTranslate(dest, pe)), value);
 }
 
 template <typename T>
 __device__ T IPCContext::amo_fetch_cas(void *dest, T value, T cond, int pe) {
-  uint64_t L_offset =
-      reinterpret_cast<char *>(dest) - ipcImpl_.ipc_bases[my_pe];
   return ipcImpl_.ipcAMOFetchCas(
-      reinterpret_cast<T *>(ipcImpl_.ipc_bases[pe] + L_offset), cond,
+      reinterpret_cast<T *>(ipcImpl_.ipcTranslate(dest, pe)), cond,
       value);
 }
 
@@ -187,7 +198,7 @@ __device__ void IPCContext::internal_direct_allreduce(
   for (int i = PE_start; i < finish; i += stride) {
     if (i != pe) {
       internal_putmem_wg(&pWrk[pe * nelems], reinterpret_cast<const void *>(src),
-                    nelems * sizeof(T), i);
+                    nelems * sizeof(T), i, team_obj->pWrk_bases);
 
       if (is_thread_zero_in_block()) {
         fence();
@@ -313,7 +324,7 @@ __device__ void IPCContext::internal_ring_allreduce(
 
       internal_putmem_wg(reinterpret_cast<void *>(&pWrk[off_send]),
                     reinterpret_cast<void *>(&dst[off_send + off_seg]),
-                    chunk_size * sizeof(T), send_pe);
+                    chunk_size * sizeof(T), send_pe, team_obj->pWrk_bases);
 
       if (is_thread_zero_in_block()) {
         fence();
@@ -357,6 +368,89 @@ __device__ void IPCContext::internal_ring_allreduce(
   __syncthreads();
 }
 
+/*
+ * Recursive doubling and Rabenseifner allreduce, driven by the step
+ * schedule of allreduce_schedule.hpp. Every step that combines data
+ * receives it into its own pWrk slot; consecutive passes alternate between
+ * the two halves of pWrk and two sets of pSync flags.
+ */
+template <typename T, ROCSHMEM_OP Op>
+__device__ void IPCContext::internal_scheduled_allreduce(
+    T *dst, const T *src, int nelems, IPCTeam *team_obj,  // NOLINT(runtime/int)
+    AllreduceAlgorithm algo) {
+
+  int PE_size = team_obj->tinfo_wrt_world->size;
+  long *pSync = team_obj->barrier_pSync;
+  T *pWrk = reinterpret_cast<T *>(team_obj->pWrk);
+  int my_pe_in_team = team_obj->my_pe;
+
+  int num_steps = allreduce_num_steps(algo, PE_size);
+  int wrk_elems = static_cast<int>(team_obj->pWrk_size);
+  int pass_elems = allreduce_pass_elems(algo, PE_size, wrk_elems);
+  int wrk_half = wrk_elems / 2;
+  long flag_val = 1;  // NOLINT(runtime/int)
+
+  int wg_size = get_flat_block_size();
+  int wg_id = get_flat_block_id();
+
+  for (int i = wg_id; i < nelems; i += wg_size) {
+    dst[i] = src[i];
+  }
+  __syncthreads();
+
+  for (int base = 0, pass = 0; base < nelems; base += pass_elems, pass++) {
+    int count = min(pass_elems, nelems - base);
+    int parity = pass & 1;
+    T *wrk = &pWrk[parity * wrk_half];
+
+    for (int step = 0; step < num_steps; step++) {
+      AllreduceStep s = allreduce_step(algo, my_pe_in_team, PE_size, count,
+                                       step);
+      if (s.peer < 0) {
+        continue;
+      }
+      int peer = team_obj->get_pe_in_world(s.peer);
+      long *flag = &pSync[parity * num_steps + step];
+
+      if (s.sends) {
+        /* Partial results land in pWrk, finished blocks in the peer's dst */
+        if (s.reduce) {
+          internal_putmem_wg(&wrk[s.wrk_offset], &dst[base + s.send_offset],
+                             s.send_count * sizeof(T), peer,
+                             team_obj->pWrk_bases);
+        } else {
+          putmem_wg(&dst[base + s.send_offset], &dst[base + s.send_offset],
+                    s.send_count * sizeof(T), peer);
+        }
+
+        if (is_thread_zero_in_block()) {
+          fence();
+          internal_putmem(flag, &flag_val, sizeof(*pSync), peer);
+#if defined(__gfx90a__)
+          __threadfence_system();
+#endif /* __gfx90a__ */
+        }
+      }
+
+      if (s.recvs) {
+        if (is_thread_zero_in_block()) {
+          wait_until(flag, ROCSHMEM_CMP_EQ, flag_val);
+          *flag = ROCSHMEM_SYNC_VALUE;
+        }
+        __syncthreads();
+        if (s.reduce) {
+          compute_reduce<T, Op>(&wrk[s.wrk_offset],
+                                &dst[base + s.recv_offset], s.recv_count,
+                                wg_id, wg_size);
+        }
+      }
+      __syncthreads();
+    }
+  }
+  threadfence_system();
+  __syncthreads();
+}
+
 template <typename T, ROCSHMEM_OP Op>
 __device__ int IPCContext::reduce(rocshmem_team_t team, T *dest,
                                   const T *source, int nreduce) {
@@ -364,17 +458,21 @@ __device__ int IPCContext::reduce(rocshmem_team_t team, T *dest,
 
   int PE_size = team_obj->tinfo_wrt_world->size;
 
-  size_t direct_pWrk = PE_size * nreduce;
-  size_t direct_pSync = PE_size;
-  size_t ring_pSync = 2 * PE_size;
-  size_t provided_pWrk = max(nreduce / 2 + 1, ROCSHMEM_REDUCE_MIN_WRKDATA_SIZE);
-  size_t provided_pSync = ROCSHMEM_REDUCE_SYNC_SIZE;
-
-  if (provided_pWrk >= direct_pWrk && provided_pSync >= direct_pSync) {
-    internal_direct_allreduce<T, Op>(dest, source, nreduce, team_obj);
-  } else {
-    if (ring_pSync <= ROCSHMEM_REDUCE_SYNC_SIZE) {
-      size_t ring_pWrk = ROCSHMEM_REDUCE_MIN_WRKDATA_SIZE;
+  AllreduceAlgorithm algo = allreduce_select(
+      PE_size, nreduce, sizeof(T), team_obj->pWrk_size,
+      ROCSHMEM_REDUCE_SYNC_SIZE);
+
+  switch (algo) {
+    case AllreduceAlgorithm::DIRECT:
+      internal_direct_allreduce<T, Op>(dest, source, nreduce, team_obj);
+      break;
+    case AllreduceAlgorithm::RECURSIVE_DOUBLING:
+    case AllreduceAlgorithm::RABENSEIFNER:
+      internal_scheduled_allreduce<T, Op>(dest, source, nreduce, team_obj,
+                                          algo);
+      break;
+    case AllreduceAlgorithm::RING: {
+      size_t ring_pWrk = team_obj->pWrk_size;
       // integer division truncating value
       int chunk_size = ring_pWrk / PE_size;
       int seg_size = chunk_size * PE_size;
@@ -408,10 +506,11 @@ __device__ int IPCContext::reduce(rocshmem_team_t team, T *dest,
           internal_direct_allreduce<T, Op>(p_dst, p_src2, p_count, team_obj);
         }
       }
-    } else {
+      break;
+    }
+    default:
       GPU_DPRINTF("Unsupported reduction size for IPC conduit.\n");
       return ROCSHMEM_ERROR;
-    }
   }
   return ROCSHMEM_SUCCESS;
 }
@@ -438,6 +537,63 @@ __device__ void IPCContext::internal_get_broadcast(
   }
 }
 
+/*
+ * The buffer is cut into bcast_chunk_size chunks which travel down a chain
+ * or a binary tree rooted at pe_root. A PE forwards chunk c to its
+ * children once its parent has raised its flag to c + 1, so the links of
+ * every PE stay busy instead of all PEs reading from the root at once.
+ */
+template <typename T>
+__device__ void IPCContext::internal_pipelined_broadcast(
+    T *dst, const T *src, int nelems, int pe_root, int pe_start,
+    int stride, int pe_size, long *p_sync) {  // NOLINT(runtime/int)
+  int rank = (my_pe - pe_start) / stride;
+  int root = (pe_root - pe_start) / stride;
+  int vrank = (rank - root + pe_size) % pe_size;
+
+  int chunk_elems = max(static_cast<int>(bcast_chunk_size / sizeof(T)), 1);
+  int num_chunks = (nelems + chunk_elems - 1) / chunk_elems;
+  BroadcastTopology topo = broadcast_topology(pe_size, num_chunks);
+  int num_children = broadcast_num_children(vrank, pe_size, topo);
+
+  long *flag = &p_sync[BROADCAST_FLAG_SLOT];  // NOLINT(runtime/int)
+  const T *from = (vrank == 0) ? src : dst;
+
+  for (int c = 0; c < num_chunks; c++) {
+    int offset = c * chunk_elems;
+    int count = min(chunk_elems, nelems - offset);
+
+    if (vrank != 0) {
+      if (is_thread_zero_in_block()) {
+        wait_until(flag, ROCSHMEM_CMP_GE, static_cast<long>(c + 1));  // NOLINT
+      }
+      __syncthreads();
+    }
+
+    for (int i = 0; i < num_children; i++) {
+      int child_rank = (broadcast_child(vrank, i, topo) + root) % pe_size;
+      int child = pe_start + child_rank * stride;
+      putmem_wg(&dst[offset], &from[offset], count * sizeof(T), child);
+
+      if (is_thread_zero_in_block()) {
+        fence();
+        long chunks = c + 1;  // NOLINT(runtime/int)
+        internal_putmem(flag, &chunks, sizeof(*flag), child);
+#if defined(__gfx90a__)
+        __threadfence_system();
+#endif /* __gfx90a__ */
+      }
+      __syncthreads();
+    }
+  }
+
+  /* The parent writes again only after the closing barrier */
+  if (vrank != 0 && is_thread_zero_in_block()) {
+    *flag = ROCSHMEM_SYNC_VALUE;
+  }
+  __syncthreads();
+}
+
 template <typename T>
 __device__ void IPCContext::broadcast(rocshmem_team_t team, T *dst,
 				      const T *src, int nelems, int pe_root) {
@@ -459,7 +615,10 @@ __device__ void IPCContext::internal_broadcast(T *dst, const T *src, int nelems,
 				      int pe_root, int pe_start,
 				      int stride, int pe_size,
 				      long *p_sync) {  // NOLINT(runtime/int)
-  if (num_pes < 4) {
+  if (pe_size > 2 && nelems * sizeof(T) > bcast_chunk_size) {
+    internal_pipelined_broadcast(dst, src, nelems, pe_root, pe_start, stride,
+                                 pe_size, p_sync);
+  } else if (num_pes < 4) {
     internal_put_broadcast(dst, src, nelems, pe_root, pe_start, stride,
                            pe_size);
   } else {
@@ -473,7 +632,53 @@ __device__ void IPCContext::internal_broadcast(T *dst, const T *src, int nelems,
 template <typename T>
 __device__ void IPCContext::alltoall(rocshmem_team_t team, T *dst,
 				     const T *src, int nelems) {
-  alltoall_linear(team, dst, src, nelems);
+  IPCTeam *team_obj = reinterpret_cast<IPCTeam *>(team);
+
+  if (select_alltoall_schedule(team_obj->num_pes, nelems * sizeof(T)) ==
+      AlltoallSchedule::LINEAR) {
+    alltoall_linear(team, dst, src, nelems);
+  } else {
+    alltoall_pairwise(team, dst, src, nelems);
+  }
+}
+
+template <typename T>
+__device__ void IPCContext::alltoall_pairwise(rocshmem_team_t team, T *dst,
+                                              const T *src, int nelems) {
+  IPCTeam *team_obj = reinterpret_cast<IPCTeam *>(team);
+
+  int pe_start = team_obj->tinfo_wrt_world->pe_start;
+  int pe_size = team_obj->num_pes;
+  int stride = team_obj->tinfo_wrt_world->stride;
+  long *pSync = team_obj->alltoall_pSync;
+  int my_pe_in_team = team_obj->my_pe;
+
+  if (select_alltoall_schedule(pe_size, nelems * sizeof(T)) ==
+      AlltoallSchedule::PAIRWISE_WAVE) {
+    // Each wavefront takes every num_waves-th step
+    int num_waves = (get_flat_block_size() + WF_SIZE - 1) / WF_SIZE;
+    int wave_id = get_flat_block_id() / WF_SIZE;
+    for (int step = wave_id; step < pe_size; step += num_waves) {
+      int j = alltoall_peer(my_pe_in_team, step, pe_size);
+      put_nbi_wave(&dst[my_pe_in_team * nelems], &src[j * nelems], nelems,
+                   team_obj->get_pe_in_world(j));
+    }
+    if (is_thread_zero_in_wave()) {
+      quiet();
+    }
+    __syncthreads();
+  } else {
+    for (int step = 0; step < pe_size; step++) {
+      int j = alltoall_peer(my_pe_in_team, step, pe_size);
+      put_nbi_wg(&dst[my_pe_in_team * nelems], &src[j * nelems], nelems,
+                 team_obj->get_pe_in_world(j));
+    }
+  }
+  if (is_thread_zero_in_block()) {
+    quiet();
+  }
+  // wait until everyone has obtained their designated data
+  internal_sync(my_pe, pe_start, stride, pe_size, pSync);
 }
 
 template <typename T>
@@ -502,7 +707,53 @@ __device__ void IPCContext::alltoall_linear(rocshmem_team_t team, T *dst,
 template <typename T>
 __device__ void IPCContext::fcollect(rocshmem_team_t team, T *dst,
 				     const T *src, int nelems) {
-  fcollect_linear(team, dst, src, nelems);
+  IPCTeam *team_obj = reinterpret_cast<IPCTeam *>(team);
+
+  if (select_alltoall_schedule(team_obj->num_pes, nelems * sizeof(T)) ==
+      AlltoallSchedule::LINEAR) {
+    fcollect_linear(team, dst, src, nelems);
+  } else {
+    fcollect_pairwise(team, dst, src, nelems);
+  }
+}
+
+template <typename T>
+__device__ void IPCContext::fcollect_pairwise(rocshmem_team_t team, T *dst,
+                                              const T *src, int nelems) {
+  IPCTeam *team_obj = reinterpret_cast<IPCTeam *>(team);
+
+  int pe_start = team_obj->tinfo_wrt_world->pe_start;
+  int pe_size = team_obj->num_pes;
+  int stride = team_obj->tinfo_wrt_world->stride;
+  long *pSync = team_obj->alltoall_pSync;
+  int my_pe_in_team = team_obj->my_pe;
+
+  if (select_alltoall_schedule(pe_size, nelems * sizeof(T)) ==
+      AlltoallSchedule::PAIRWISE_WAVE) {
+    // Each wavefront takes every num_waves-th step
+    int num_waves = (get_flat_block_size() + WF_SIZE - 1) / WF_SIZE;
+    int wave_id = get_flat_block_id() / WF_SIZE;
+    for (int step = wave_id; step < pe_size; step += num_waves) {
+      int j = alltoall_peer(my_pe_in_team, step, pe_size);
+      put_nbi_wave(&dst[my_pe_in_team * nelems], src, nelems,
+                   team_obj->get_pe_in_world(j));
+    }
+    if (is_thread_zero_in_wave()) {
+      quiet();
+    }
+    __syncthreads();
+  } else {
+    for (int step = 0; step < pe_size; step++) {
+      int j = alltoall_peer(my_pe_in_team, step, pe_size);
+      put_nbi_wg(&dst[my_pe_in_team * nelems], src, nelems,
+                 team_obj->get_pe_in_world(j));
+    }
+  }
+  if (is_thread_zero_in_block()) {
+    quiet();
+  }
+  // wait until everyone has obtained their designated data
+  internal_sync(my_pe, pe_start, stride, pe_size, pSync);
 }
 
 template <typename T>
@@ -529,6 +780,156 @@ __device__ void IPCContext::fcollect_linear(rocshmem_team_t team, T *dst,
   internal_sync(my_pe, pe_start, stride, pe_size, pSync);
 }
 
+/*
+ * Grid collectives. Every workgroup of the calling grid enters with the
+ * same arguments and moves its grid_slice of the data, so a large
+ * collective is spread over the whole device instead of one CU. The grid
+ * must be resident at once (a cooperative launch) for the workgroups to
+ * meet in internal_grid_sync.
+ */
+
+/*
+ * PE r of the team owns slice r of the buffer: it reads that slice from
+ * the source of every PE, reduces it and writes the result into the dest
+ * of every PE. Slice r of any PE's buffers is only touched by PE r, so
+ * dest may alias source.
+ */
+template <typename T, ROCSHMEM_OP Op>
+__device__ int IPCContext::reduce_grid(rocshmem_team_t team, T *dest,
+                                       const T *source, int nreduce) {
+  IPCTeam *team_obj = reinterpret_cast<IPCTeam *>(team);
+
+  int pe_size = team_obj->num_pes;
+  int my_pe_in_team = team_obj->my_pe;
+  long *pSync = team_obj->reduce_pSync;  // NOLINT(runtime/int)
+
+  // Every PE's source is complete before any of it is read
+  internal_grid_sync(team_obj, pSync);
+
+  GridSlice owned = grid_slice(my_pe_in_team, pe_size, nreduce, sizeof(T));
+  GridSlice part = grid_slice(get_flat_grid_id(), get_flat_grid_num_blocks(),
+                              owned.count, sizeof(T));
+
+  if (part.count) {
+    size_t first = owned.offset + part.offset;
+    T *acc = &dest[first];
+    const T *mine = &source[first];
+    int wg_id = get_flat_block_id();
+    int wg_size = get_flat_block_size();
+
+    for (size_t i = wg_id; i < part.count; i += wg_size) {
+      acc[i] = mine[i];
+    }
+    for (int j = 0; j < pe_size; j++) {
+      if (j == my_pe_in_team) {
+        continue;
+      }
+      T *peer_src = reinterpret_cast<T *>(
+          ipcImpl_.ipcTranslate(mine, team_obj->get_pe_in_world(j)));
+      for (size_t i = wg_id; i < part.count; i += wg_size) {
+        OpWrap<Op>::Calc(peer_src, acc, i);
+      }
+    }
+    __syncthreads();
+
+    for (int step = 1; step < pe_size; step++) {
+      int j = (my_pe_in_team + step) % pe_size;
+      put_nbi_wg(acc, acc, part.count, team_obj->get_pe_in_world(j));
+    }
+    if (is_thread_zero_in_block()) {
+      quiet();
+    }
+  }
+
+  // Every PE's dest holds all slices
+  internal_grid_sync(team_obj, pSync);
+  return ROCSHMEM_SUCCESS;
+}
+
+template <typename T>
+__device__ void IPCContext::broadcast_grid(rocshmem_team_t team, T *dst,
+                                           const T *src, int nelems,
+                                           int pe_root) {
+  IPCTeam *team_obj = reinterpret_cast<IPCTeam *>(team);
+
+  int pe_size = team_obj->num_pes;
+  int block = get_flat_grid_id();
+  long *p_sync = team_obj->bcast_pSync;  // NOLINT(runtime/int)
+
+  if (team_obj->my_pe == pe_root) {
+    GridSlice part = grid_slice(block, get_flat_grid_num_blocks(), nelems,
+                                sizeof(T));
+    if (part.count) {
+      // Workgroups start on different PEs to spread the links
+      for (int step = 0; step < pe_size; step++) {
+        int j = (block + step) % pe_size;
+        if (j != pe_root) {
+          put_nbi_wg(&dst[part.offset], &src[part.offset], part.count,
+                     team_obj->get_pe_in_world(j));
+        }
+      }
+      if (is_thread_zero_in_block()) {
+        quiet();
+      }
+    }
+  }
+
+  internal_grid_sync(team_obj, p_sync);
+}
+
+template <typename T>
+__device__ void IPCContext::alltoall_grid(rocshmem_team_t team, T *dst,
+                                          const T *src, int nelems) {
+  IPCTeam *team_obj = reinterpret_cast<IPCTeam *>(team);
+
+  int pe_size = team_obj->num_pes;
+  int my_pe_in_team = team_obj->my_pe;
+  int block = get_flat_grid_id();
+  long *pSync = team_obj->alltoall_pSync;  // NOLINT(runtime/int)
+
+  GridSlice part = grid_slice(block, get_flat_grid_num_blocks(), nelems,
+                              sizeof(T));
+  if (part.count) {
+    for (int step = 0; step < pe_size; step++) {
+      int j = alltoall_peer(my_pe_in_team, (block + step) % pe_size, pe_size);
+      put_nbi_wg(&dst[my_pe_in_team * nelems + part.offset],
+                 &src[j * nelems + part.offset], part.count,
+                 team_obj->get_pe_in_world(j));
+    }
+    if (is_thread_zero_in_block()) {
+      quiet();
+    }
+  }
+
+  internal_grid_sync(team_obj, pSync);
+}
+
+template <typename T>
+__device__ void IPCContext::fcollect_grid(rocshmem_team_t team, T *dst,
+                                          const T *src, int nelems) {
+  IPCTeam *team_obj = reinterpret_cast<IPCTeam *>(team);
+
+  int pe_size = team_obj->num_pes;
+  int my_pe_in_team = team_obj->my_pe;
+  int block = get_flat_grid_id();
+  long *pSync = team_obj->alltoall_pSync;  // NOLINT(runtime/int)
+
+  GridSlice part = grid_slice(block, get_flat_grid_num_blocks(), nelems,
+                              sizeof(T));
+  if (part.count) {
+    for (int step = 0; step < pe_size; step++) {
+      int j = alltoall_peer(my_pe_in_team, (block + step) % pe_size, pe_size);
+      put_nbi_wg(&dst[my_pe_in_team * nelems + part.offset],
+                 &src[part.offset], part.count, team_obj->get_pe_in_world(j));
+    }
+    if (is_thread_zero_in_block()) {
+      quiet();
+    }
+  }
+
+  internal_grid_sync(team_obj, pSync);
+}
+
 // Block/wave functions
 template <typename T>
 __device__ void IPCContext::put_wg(T *dest, const T *source, size_t nelems,
@@ -578,6 +979,35 @@ __device__ void IPCContext::get_nbi_wave(T *dest, const T *source,
   getmem_nbi_wave(dest, source, nelems * sizeof(T), pe);
 }
 
+/*
+ * Each lane of the wavefront moves every WF_SIZE-th element, so the strided
+ * transfer is split across the wave instead of serialized on one lane.
+ */
+template <typename T>
+__device__ void IPCContext::iput_wave(T *dest, const T *source, ptrdiff_t dst,
+                                      ptrdiff_t sst, size_t nelems, int pe) {
+  T *remote_dest{reinterpret_cast<T *>(ipcImpl_.ipcTranslate(dest, pe))};
+  size_t wave_tid = get_flat_block_id() % WF_SIZE;
+  size_t wave_size = wave_SZ();
+  for (size_t i{wave_tid}; i < nelems; i += wave_size) {
+    remote_dest[i * dst] = source[i * sst];
+  }
+  ipcImpl_.ipcFence();
+}
+
+template <typename T>
+__device__ void IPCContext::iget_wave(T *dest, const T *source, ptrdiff_t dst,
+                                      ptrdiff_t sst, size_t nelems, int pe) {
+  const T *remote_source{
+      reinterpret_cast<const T *>(ipcImpl_.ipcTranslate(source, pe))};
+  size_t wave_tid = get_flat_block_id() % WF_SIZE;
+  size_t wave_size = wave_SZ();
+  for (size_t i{wave_tid}; i < nelems; i += wave_size) {
+    dest[i * dst] = remote_source[i * sst];
+  }
+  ipcImpl_.ipcFence();
+}
+
 #define IPC_CONTEXT_PUT_SIGNAL_DEF(SUFFIX)                                                            \
   template <typename T>                                                                               \
   __device__ void IPCContext::put_signal##SUFFIX(T *dest, const T *source, size_t nelems,             \
@@ -47,8 +47,7 @@ IPCTeam::IPCTeam(Backend *backend, TeamInfo *team_info_parent,
 
   pWrk = reinterpret_cast<char *>(b->pWrk_pool) +
          ROCSHMEM_REDUCE_MIN_WRKDATA_SIZE * sizeof(double) * pool_index;
-  pAta = reinterpret_cast<char *>(b->pAta_pool) +
-         ROCSHMEM_ATA_MAX_WRKDATA_SIZE * sizeof(double) * pool_index;
+  pWrk_bases = b->get_wrk_sync_bases();
 }
 
 IPCTeam::~IPCTeam() {}
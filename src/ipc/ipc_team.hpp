@@ -24,6 +24,7 @@
 #define LIBRARY_SRC_IPC_TEAM_HPP_
 
 #include "../team.hpp"
+#include "../memory/notifier.hpp"
 
 namespace rocshmem {
 
@@ -40,7 +41,35 @@ class IPCTeam : public Team {
   long* bcast_pSync{nullptr};
   long* alltoall_pSync{nullptr};
   void* pWrk{nullptr};
-  void* pAta{nullptr};
+
+  /**
+   * @brief Elements of the largest reduction type pWrk holds
+   */
+  size_t pWrk_size{ROCSHMEM_REDUCE_MIN_WRKDATA_SIZE};
+
+  /**
+   * @brief Bases from which pWrk addresses on other PEs are computed,
+   * indexed by PE in TEAM_WORLD
+   *
+   * The work/sync buffer bases while pWrk is the team's pool slot, the
+   * bases of the team's own buffer once it has one.
+   */
+  char** pWrk_bases{nullptr};
+
+  /**
+   * @brief True if pWrk was allocated for this team instead of taken
+   * from the pool
+   */
+  bool owns_pWrk{false};
+
+  /**
+   * @brief Barrier the workgroups of a grid collective on this team meet
+   * on
+   *
+   * Every workgroup of the grid passes the same team, whatever context
+   * it issues the collective on, so the barrier lives here.
+   */
+  Notifier<detail::atomic::memory_scope_device> grid_notifier{};
 
   int pool_index_{-1};
 };
@@ -24,6 +24,9 @@
 
 #include <mpi.h>
 
+#include <cassert>
+#include <new>
+
 #include "rocshmem_config.h"  // NOLINT(build/include_subdir)
 #include "backend_bc.hpp"
 #include "context_incl.hpp"
@@ -32,26 +35,51 @@
 namespace rocshmem {
 
 __host__ void IpcOnImpl::ipcHostInit(int my_pe, const HEAP_BASES_T &heap_bases,
-                                     MPI_Comm thread_comm) {
+                                     size_t heap_size, MPI_Comm thread_comm) {
   /*
    * Create an MPI communicator that deals only with local processes.
    */
-  MPI_Comm shmcomm;
   MPI_Comm_split_type(thread_comm, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL,
-                      &shmcomm);
+                      &shm_comm);
 
   /*
    * Figure out how many local process there are.
    */
   int Shm_size;
-  MPI_Comm_size(shmcomm, &Shm_size);
+  MPI_Comm_size(shm_comm, &Shm_size);
   shm_size = Shm_size;
 
   /*
    * Figure out how this process' rank among local processes.
    */
-  MPI_Comm_rank(shmcomm, &shm_rank);
+  MPI_Comm_rank(shm_comm, &shm_rank);
+
+  /*
+   * Map the symmetric heap of every local processing element.
+   */
+  ipc_bases = ipcOpenBases(heap_bases[my_pe]);
 
+  /*
+   * Allocate the segment table used by device-side address translation
+   * and register the initial heap as its first segment. The table lives
+   * in host-pinned memory so segments added later become visible to
+   * contexts which already hold the table pointer.
+   */
+  CHECK_HIP(hipHostMalloc(reinterpret_cast<void **>(&ipc_segments),
+                          sizeof(HeapSegmentTable)));
+  new (ipc_segments) HeapSegmentTable();
+  ipc_segments->add_segment(heap_bases[my_pe], heap_size, ipc_bases);
+}
+
+__host__ void IpcOnImpl::ipcHostAddSegment(char *segment_base,
+                                           size_t segment_size) {
+  char **segment_bases{ipcOpenBases(segment_base)};
+  int index{ipc_segments->add_segment(segment_base, segment_size,
+                                      segment_bases)};
+  assert(index >= 0);
+}
+
+__host__ char **IpcOnImpl::ipcOpenBases(char *local_base) {
   /*
    * Allocate a host-side c-array to hold the IPC handles.
    */
@@ -60,23 +88,21 @@ __host__ void IpcOnImpl::ipcHostInit(int my_pe, const HEAP_BASES_T &heap_bases,
       reinterpret_cast<hipIpcMemHandle_t *>(ipc_mem_handle_uncast);
 
   /*
-   * Call into the hip runtime to get an IPC handle for my symmetric
-   * heap and store that IPC handle into the host-side c-array which was
+   * Call into the hip runtime to get an IPC handle for my memory region
+   * and store that IPC handle into the host-side c-array which was
    * just allocated.
    */
-  char *base_heap = heap_bases[my_pe];
-  CHECK_HIP(hipIpcGetMemHandle(&vec_ipc_handle[shm_rank], base_heap));
+  CHECK_HIP(hipIpcGetMemHandle(&vec_ipc_handle[shm_rank], local_base));
 
   /*
    * Do an all-to-all exchange with each local processing element to
-   * share the symmetric heap IPC handles.
+   * share the IPC handles.
    */
   MPI_Allgather(MPI_IN_PLACE, sizeof(hipIpcMemHandle_t), MPI_CHAR,
-                vec_ipc_handle, sizeof(hipIpcMemHandle_t), MPI_CHAR, shmcomm);
+                vec_ipc_handle, sizeof(hipIpcMemHandle_t), MPI_CHAR, shm_comm);
 
   /*
-   * Allocate device-side array to hold the IPC symmetric heap base
-   * addresses.
+   * Allocate device-side array to hold the IPC base addresses.
    */
   char **ipc_base;
   CHECK_HIP(hipMalloc(reinterpret_cast<void **>(&ipc_base),
@@ -84,7 +110,7 @@ __host__ void IpcOnImpl::ipcHostInit(int my_pe, const HEAP_BASES_T &heap_bases,
 
   /*
    * For all local processing elements, initialize the device-side array
-   * with the IPC symmetric heap base addresses.
+   * with the IPC base addresses.
    */
   for (int i = 0; i < shm_size; i++) {
     if (i != shm_rank) {
@@ -92,41 +118,49 @@ __host__ void IpcOnImpl::ipcHostInit(int my_pe, const HEAP_BASES_T &heap_bases,
       CHECK_HIP(hipIpcOpenMemHandle(ipc_base_uncast, vec_ipc_handle[i],
                                     hipIpcMemLazyEnablePeerAccess));
     } else {
-      ipc_base[i] = base_heap;
+      ipc_base[i] = local_base;
     }
   }
 
   /*
-   * Set member variables used by subsequent method calls.
-   */
-  ipc_bases = ipc_base;
-
-  /*
-   * Free the host-side memory used to exchange the symmetric heap base
-   * addresses.
+   * Free the host-side memory used to exchange the IPC handles.
    */
   free(vec_ipc_handle);
+
+  return ipc_base;
 }
 
-__host__ void IpcOnImpl::ipcHostStop() {
+__host__ void IpcOnImpl::ipcCloseBases(char **bases) {
   for (int i = 0; i < shm_size; i++) {
     if (i != shm_rank) {
-      CHECK_HIP(hipIpcCloseMemHandle(ipc_bases[i]));
+      CHECK_HIP(hipIpcCloseMemHandle(bases[i]));
     }
   }
-  CHECK_HIP(hipFree(ipc_bases));
+  CHECK_HIP(hipFree(bases));
+}
+
+__host__ void IpcOnImpl::ipcHostStop() {
+  /*
+   * Segment zero is ipc_bases.
+   */
+  for (int i = 1; i < ipc_segments->get_num_segments(); i++) {
+    ipcCloseBases(ipc_segments->get_remote_bases(i));
+  }
+  ipcCloseBases(ipc_bases);
+  CHECK_HIP(hipHostFree(ipc_segments));
+  MPI_Comm_free(&shm_comm);
 }
 
 __device__ void IpcOnImpl::ipcCopy(void *dst, void *src, size_t size) {
-  memcpy(dst, src, size);
+  memcpy_vec(dst, src, size);
 }
 
 __device__ void IpcOnImpl::ipcCopy_wave(void *dst, void *src, size_t size) {
-  memcpy_wave(dst, src, size);
+  memcpy_vec_wave(dst, src, size);
 }
 
 __device__ void IpcOnImpl::ipcCopy_wg(void *dst, void *src, size_t size) {
-  memcpy_wg(dst, src, size);
+  memcpy_vec_wg(dst, src, size);
 }
 
 }  // namespace rocshmem
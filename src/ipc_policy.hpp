@@ -30,6 +30,7 @@
 #include <vector>
 
 #include "rocshmem_config.h"  // NOLINT(build/include_subdir)
+#include "memory/heap_segment_table.hpp"
 #include "memory/hip_allocator.hpp"
 #include "util.hpp"
 
@@ -48,14 +49,24 @@ class IpcOnImpl {
 
   char **ipc_bases{nullptr};
 
+  HeapSegmentTable *ipc_segments{nullptr};
+
+  MPI_Comm shm_comm{MPI_COMM_NULL};
+
   __host__ void ipcHostInit(int my_pe, const HEAP_BASES_T &heap_bases,
-                            MPI_Comm thread_comm);
+                            size_t heap_size, MPI_Comm thread_comm);
+
+  __host__ void ipcHostAddSegment(char *segment_base, size_t segment_size);
 
   __host__ void ipcHostStop();
 
   __device__ bool isIpcAvailable(int my_pe, int target_pe) {
     return my_pe / shm_size == target_pe / shm_size;
   }
+
+  __device__ char *ipcTranslate(const void *local_addr, int local_pe) {
+    return ipc_segments->translate(local_addr, local_pe);
+  }
   __device__ void ipcGpuInit(Backend *gpu_backend, Context *ctx, int thread_id);
 
   __device__ void ipcCopy(void *dst, void *src, size_t size);
@@ -104,6 +115,11 @@ class IpcOnImpl {
     volatile uint32_t read_value = __hip_atomic_load(
         pe_ipc_base, __ATOMIC_SEQ_CST, __HIP_MEMORY_SCOPE_SYSTEM);
   }
+
+ private:
+  __host__ char **ipcOpenBases(char *local_base);
+
+  __host__ void ipcCloseBases(char **bases);
 };
 
 // clang-format off
@@ -116,13 +132,21 @@ class IpcOffImpl {
 
   char **ipc_bases{nullptr};
 
+  HeapSegmentTable *ipc_segments{nullptr};
+
   __host__ void ipcHostInit(int my_pe, const HEAP_BASES_T &heap_bases,
-                            MPI_Comm thread_comm) {}
+                            size_t heap_size, MPI_Comm thread_comm) {}
+
+  __host__ void ipcHostAddSegment(char *segment_base, size_t segment_size) {}
 
   __host__ void ipcHostStop() {}
 
   __device__ bool isIpcAvailable(int my_pe, int target_pe) { return false; }
 
+  __device__ char *ipcTranslate(const void *local_addr, int local_pe) {
+    return nullptr;
+  }
+
   __device__ void ipcGpuInit(Backend *rocshmem_handle, Context *ctx,
                              int thread_id) {}
 
@@ -24,15 +24,17 @@
 #define LIBRARY_SRC_MEMORY_BIN_HPP_
 
 #include <cassert>
-#include <stack>
+#include <iterator>
+#include <vector>
 
 /**
  * @file bin.hpp
  *
  * @brief Simple container class
  *
- * The class wraps a stack and provides simple mutators. A different internal
- * container class might be preferable to a stack.
+ * The class wraps a last-in-first-out container and provides simple
+ * mutators. The container is a vector so that specific elements can be
+ * searched for and removed.
  */
 
 namespace rocshmem {
@@ -59,7 +61,7 @@ class Bin {
    *
    * @param[in] An element
    */
-  void put(T element) { stack_.emplace(element); }
+  void put(T element) { stack_.push_back(element); }
 
   /**
    * @brief Retrieve an element from stack
@@ -68,16 +70,36 @@ class Bin {
    */
   T get() {
     assert(stack_.size());
-    auto top = stack_.top();
-    stack_.pop();
+    auto top = stack_.back();
+    stack_.pop_back();
     return top;
   }
 
+  /**
+   * @brief Retrieve the most recently stored element matching a predicate
+   *
+   * @param[in] Unary predicate over elements
+   * @param[out] Matching element
+   *
+   * @return A boolean denoting whether an element matched
+   */
+  template <typename PRED_T>
+  bool take_if(PRED_T pred, T* element) {
+    for (auto it = stack_.rbegin(); it != stack_.rend(); it++) {
+      if (pred(*it)) {
+        *element = *it;
+        stack_.erase(std::next(it).base());
+        return true;
+      }
+    }
+    return false;
+  }
+
  private:
   /**
    * @brief Implementation container
    */
-  std::stack<T> stack_{};
+  std::vector<T> stack_{};
 };
 
 }  // namespace rocshmem
@@ -0,0 +1,153 @@
+/******************************************************************************
+ * Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+
+#ifndef LIBRARY_SRC_MEMORY_DIRTY_PE_MASK_HPP_
+#define LIBRARY_SRC_MEMORY_DIRTY_PE_MASK_HPP_
+
+#include <hip/hip_runtime.h>
+
+#include <cstdint>
+
+/**
+ * @file dirty_pe_mask.hpp
+ *
+ * @brief Contains a fixed-size set of PEs targeted through a device context
+ *
+ * Unlike DirtyPeSet, the mask lives inside a context in device memory and
+ * is updated concurrently by every thread using that context, so bits are
+ * set atomically and a completion point swaps each word out atomically to
+ * start a new epoch.
+ */
+
+namespace rocshmem {
+
+/**
+ * @brief Number of 64-bit words in a DirtyPeMask
+ */
+constexpr int DIRTY_PE_MASK_WORDS = 4;
+
+class DirtyPeMask {
+ public:
+  /**
+   * @brief Largest number of PEs a mask can track
+   */
+  static constexpr int CAPACITY = 64 * DIRTY_PE_MASK_WORDS;
+
+  /**
+   * @param[in] num_pes number of PEs which may be targeted
+   *
+   * @return true if every PE has a bit in the mask
+   */
+  __host__ __device__ static constexpr bool fits(int num_pes) {
+    return num_pes <= CAPACITY;
+  }
+
+  /**
+   * @brief Records a transfer to a PE
+   *
+   * The atomic is skipped when the bit is already set, which is the common
+   * case once a kernel has reached all of its peers.
+   *
+   * @param[in] pe target of the transfer
+   *
+   * @return true if this call set the bit
+   */
+  __host__ __device__ bool mark(int pe) {
+    uint64_t bit{uint64_t{1} << (pe % 64)};
+    uint64_t *word{&words_[pe / 64]};
+    if (__atomic_load_n(word, __ATOMIC_RELAXED) & bit) {
+      return false;
+    }
+    return !(__atomic_fetch_or(word, bit, __ATOMIC_RELAXED) & bit);
+  }
+
+  /**
+   * @param[in] pe PE to look up
+   *
+   * @return true if the PE has been marked
+   */
+  __host__ __device__ bool test(int pe) const {
+    return (__atomic_load_n(&words_[pe / 64], __ATOMIC_RELAXED) >> (pe % 64)) &
+           1;
+  }
+
+  /**
+   * @brief Calls fn on every marked PE in increasing order
+   *
+   * @param[in] fn callable taking a PE number
+   */
+  template <typename FN_T>
+  __host__ __device__ void for_each(FN_T fn) const {
+    for (int w{0}; w < DIRTY_PE_MASK_WORDS; w++) {
+      uint64_t bits{__atomic_load_n(&words_[w], __ATOMIC_RELAXED)};
+      while (bits) {
+        fn(w * 64 + __builtin_ctzll(bits));
+        bits &= bits - 1;
+      }
+    }
+  }
+
+  /**
+   * @brief Starts a new epoch and calls fn on every PE marked in the one
+   * which ended, in increasing order
+   *
+   * Each word is swapped out atomically, so a PE marked concurrently is
+   * either visited now or left marked for the next epoch, never lost.
+   *
+   * @param[in] fn callable taking a PE number
+   */
+  template <typename FN_T>
+  __host__ __device__ void next_epoch(FN_T fn) {
+    for (int w{0}; w < DIRTY_PE_MASK_WORDS; w++) {
+      if (!__atomic_load_n(&words_[w], __ATOMIC_RELAXED)) {
+        continue;
+      }
+      uint64_t bits{__atomic_exchange_n(&words_[w], uint64_t{0},
+                                        __ATOMIC_RELAXED)};
+      while (bits) {
+        fn(w * 64 + __builtin_ctzll(bits));
+        bits &= bits - 1;
+      }
+    }
+  }
+
+  /**
+   * @brief Unmarks every PE
+   *
+   * Only safe while no other thread uses the owning context.
+   */
+  __host__ __device__ void clear() {
+    for (int w{0}; w < DIRTY_PE_MASK_WORDS; w++) {
+      __atomic_store_n(&words_[w], uint64_t{0}, __ATOMIC_RELAXED);
+    }
+  }
+
+ private:
+  /**
+   * @brief One bit per PE targeted in the current epoch
+   */
+  uint64_t words_[DIRTY_PE_MASK_WORDS]{};
+};
+
+}  // namespace rocshmem
+
+#endif  // LIBRARY_SRC_MEMORY_DIRTY_PE_MASK_HPP_
@@ -0,0 +1,244 @@
+/******************************************************************************
+ * Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+
+#ifndef LIBRARY_SRC_MEMORY_DIRTY_PE_SET_HPP_
+#define LIBRARY_SRC_MEMORY_DIRTY_PE_SET_HPP_
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+/**
+ * @file dirty_pe_set.hpp
+ *
+ * @brief Contains a set of PEs targeted through a window since the last
+ * completion point
+ *
+ * Windows of shared contexts, including ROCSHMEM_HOST_CTX_DEFAULT, are used
+ * by several host threads at once, so the set of a shared window takes its
+ * lock in every method. The sets of other windows are used by one thread
+ * at a time and skip the lock.
+ */
+
+namespace rocshmem {
+
+class DirtyPeSet {
+ public:
+  /**
+   * @brief Default constructor
+   */
+  DirtyPeSet() = default;
+
+  /**
+   * @brief Primary constructor
+   *
+   * @param[in] num_pes number of PEs which may be targeted
+   */
+  explicit DirtyPeSet(int num_pes) { resize(num_pes); }
+
+  DirtyPeSet(const DirtyPeSet&) = delete;
+  DirtyPeSet& operator=(const DirtyPeSet&) = delete;
+
+  /**
+   * @brief Move constructor, used while the owning window is built
+   */
+  DirtyPeSet(DirtyPeSet&& other) { *this = std::move(other); }
+
+  /**
+   * @brief Move assignment, used while the owning window is built
+   */
+  DirtyPeSet& operator=(DirtyPeSet&& other) {
+    if (this != &other) {
+      std::scoped_lock lock(mutex_, other.mutex_);
+      shared_ = other.shared_;
+      dirty_ = std::move(other.dirty_);
+      amo_ready_ = std::move(other.amo_ready_);
+      dirty_list_ = std::move(other.dirty_list_);
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Empties the set and sizes it for a number of PEs
+   *
+   * @param[in] num_pes number of PEs which may be targeted
+   */
+  void resize(int num_pes) {
+    auto lock{lock_if_shared()};
+    dirty_.assign(num_words(num_pes), 0);
+    amo_ready_.assign(num_words(num_pes), 0);
+    dirty_list_.clear();
+  }
+
+  /**
+   * @brief Records a write to a PE
+   *
+   * The PE needs a flush at the next completion point and before the next
+   * atomic to it.
+   *
+   * @param[in] pe target of the write
+   */
+  void mark_written(int pe) {
+    auto lock{lock_if_shared()};
+    mark_dirty(pe);
+    clear_bit(&amo_ready_, pe);
+  }
+
+  /**
+   * @brief Records an atomic to a PE
+   *
+   * Consecutive atomics to a PE share the flush issued before the first
+   * one until the PE is written or the set is cleared.
+   *
+   * @param[in] pe target of the atomic
+   *
+   * @return true if the PE must be flushed before the atomic
+   */
+  bool mark_amo(int pe) {
+    auto lock{lock_if_shared()};
+    mark_dirty(pe);
+    if (test_bit(amo_ready_, pe)) {
+      return false;
+    }
+    set_bit(&amo_ready_, pe);
+    return true;
+  }
+
+  /**
+   * @brief Calls fn on every dirty PE in the order they were first targeted
+   *
+   * @param[in] fn callable taking a PE number
+   */
+  template <typename FN_T>
+  void for_each(FN_T fn) const {
+    auto lock{lock_if_shared()};
+    for (int pe : dirty_list_) {
+      fn(pe);
+    }
+  }
+
+  /**
+   * @return number of dirty PEs
+   */
+  size_t size() const {
+    auto lock{lock_if_shared()};
+    return dirty_list_.size();
+  }
+
+  /**
+   * @brief Starts a new epoch with no dirty PEs
+   *
+   * The PEs are taken in one step so that a PE marked by another thread
+   * while the caller flushes stays in the new epoch instead of being lost.
+   *
+   * @return the PEs dirty in the epoch which ended, in the order they were
+   * first targeted
+   */
+  std::vector<int> take() {
+    std::vector<int> pes;
+    auto lock{lock_if_shared()};
+    for (int pe : dirty_list_) {
+      clear_bit(&dirty_, pe);
+    }
+    pes.swap(dirty_list_);
+    std::fill(amo_ready_.begin(), amo_ready_.end(), 0);
+    return pes;
+  }
+
+  /**
+   * @brief Starts a new epoch with no dirty PEs
+   */
+  void clear() { take(); }
+
+  /**
+   * @brief Sets whether several threads may use the set at once
+   *
+   * Must be called while no other thread uses the set, e.g. when the
+   * owning window is handed to a context.
+   *
+   * @param[in] shared true to guard every method with the set's lock
+   */
+  void set_shared(bool shared) { shared_ = shared; }
+
+ private:
+  std::unique_lock<std::mutex> lock_if_shared() const {
+    return shared_ ? std::unique_lock<std::mutex>(mutex_)
+                   : std::unique_lock<std::mutex>();
+  }
+
+  static size_t num_words(int num_pes) { return (num_pes + 63) / 64; }
+
+  static bool test_bit(const std::vector<uint64_t>& bits, int pe) {
+    assert(static_cast<size_t>(pe / 64) < bits.size());
+    return (bits[pe / 64] >> (pe % 64)) & 1;
+  }
+
+  static void set_bit(std::vector<uint64_t>* bits, int pe) {
+    (*bits)[pe / 64] |= uint64_t{1} << (pe % 64);
+  }
+
+  static void clear_bit(std::vector<uint64_t>* bits, int pe) {
+    (*bits)[pe / 64] &= ~(uint64_t{1} << (pe % 64));
+  }
+
+  void mark_dirty(int pe) {
+    if (!test_bit(dirty_, pe)) {
+      set_bit(&dirty_, pe);
+      dirty_list_.push_back(pe);
+    }
+  }
+
+  /**
+   * @brief Guards the members below when the set is shared
+   */
+  mutable std::mutex mutex_{};
+
+  /**
+   * @brief True if several threads may use the set at once
+   */
+  bool shared_{false};
+
+  /**
+   * @brief One bit per PE written or atomically updated in this epoch
+   */
+  std::vector<uint64_t> dirty_{};
+
+  /**
+   * @brief One bit per PE flushed for atomics and not written since
+   */
+  std::vector<uint64_t> amo_ready_{};
+
+  /**
+   * @brief PEs with their dirty_ bit set
+   *
+   * Lets completion points visit only the targeted PEs instead of
+   * scanning every PE in the job.
+   */
+  std::vector<int> dirty_list_{};
+};
+
+}  // namespace rocshmem
+
+#endif  // LIBRARY_SRC_MEMORY_DIRTY_PE_SET_HPP_
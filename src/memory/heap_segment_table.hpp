@@ -0,0 +1,173 @@
+/******************************************************************************
+ * Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+
+
+#ifndef LIBRARY_SRC_MEMORY_HEAP_SEGMENT_TABLE_HPP_
+#define LIBRARY_SRC_MEMORY_HEAP_SEGMENT_TABLE_HPP_
+
+#include <hip/hip_runtime.h>
+
+#include <cstddef>
+
+/**
+ * @file heap_segment_table.hpp
+ *
+ * @brief Contains the table of symmetric heap segments
+ *
+ * The symmetric heap starts with a single segment and may grow by
+ * collectively adding segments. Every segment has a local base address
+ * and one base address per processing element. Address translation
+ * finds the segment which holds a local address and applies its
+ * offset to the remote base of the same segment.
+ */
+
+namespace rocshmem {
+
+class HeapSegmentTable {
+ public:
+  /**
+   * @brief Upper bound on the number of heap segments
+   */
+  static constexpr int MAX_NUM_SEGMENTS{16};
+
+  /**
+   * @brief Registers a new segment in the table
+   *
+   * @param[in] Local base address of the segment
+   * @param[in] Size in bytes of the segment
+   * @param[in] C-array of segment base addresses indexed by PE
+   *
+   * @return Index of the new segment or -1 if the table is full
+   */
+  __host__ int add_segment(char* local_base, size_t size,
+                           char** remote_bases) {
+    if (num_segments_ == MAX_NUM_SEGMENTS) {
+      return -1;
+    }
+    int index{num_segments_};
+    local_bases_[index] = local_base;
+    sizes_[index] = size;
+    remote_bases_[index] = remote_bases;
+    num_segments_++;
+    return index;
+  }
+
+  /**
+   * @brief Finds the segment which contains an address
+   *
+   * @param[in] Local address
+   *
+   * @return Index of the segment or -1 if the address is not in the heap
+   */
+  __host__ __device__ int find_segment(const void* local_addr) const {
+    const char* addr{reinterpret_cast<const char*>(local_addr)};
+    for (int i{0}; i < num_segments_; i++) {
+      if (addr >= local_bases_[i] && addr < local_bases_[i] + sizes_[i]) {
+        return i;
+      }
+    }
+    return -1;
+  }
+
+  /**
+   * @brief Translates a local heap address into a processing element's
+   * address for the same symmetric object
+   *
+   * @param[in] Local address
+   * @param[in] Target processing element
+   *
+   * @return Address on the target or nullptr if not in the heap
+   */
+  __host__ __device__ char* translate(const void* local_addr, int pe) const {
+    int segment{find_segment(local_addr)};
+    if (segment < 0) {
+      return nullptr;
+    }
+    const char* addr{reinterpret_cast<const char*>(local_addr)};
+    return remote_bases_[segment][pe] + (addr - local_bases_[segment]);
+  }
+
+  /**
+   * @brief Accessor for number of segments
+   *
+   * @return Number of registered segments
+   */
+  __host__ __device__ int get_num_segments() const { return num_segments_; }
+
+  /**
+   * @brief Accessor for segment local base
+   *
+   * @param[in] Segment index
+   *
+   * @return Local base address of the segment
+   */
+  __host__ __device__ char* get_local_base(int segment) const {
+    return local_bases_[segment];
+  }
+
+  /**
+   * @brief Accessor for segment size
+   *
+   * @param[in] Segment index
+   *
+   * @return Size in bytes of the segment
+   */
+  __host__ __device__ size_t get_size(int segment) const {
+    return sizes_[segment];
+  }
+
+  /**
+   * @brief Accessor for segment remote bases
+   *
+   * @param[in] Segment index
+   *
+   * @return C-array of segment base addresses indexed by PE
+   */
+  __host__ __device__ char** get_remote_bases(int segment) const {
+    return remote_bases_[segment];
+  }
+
+ private:
+  /**
+   * @brief Number of registered segments
+   */
+  int num_segments_{0};
+
+  /**
+   * @brief Local base address of each segment
+   */
+  char* local_bases_[MAX_NUM_SEGMENTS]{};
+
+  /**
+   * @brief Size in bytes of each segment
+   */
+  size_t sizes_[MAX_NUM_SEGMENTS]{};
+
+  /**
+   * @brief Per-segment c-arrays of base addresses indexed by PE
+   */
+  char** remote_bases_[MAX_NUM_SEGMENTS]{};
+};
+
+}  // namespace rocshmem
+
+#endif  // LIBRARY_SRC_MEMORY_HEAP_SEGMENT_TABLE_HPP_
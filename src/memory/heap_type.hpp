@@ -43,7 +43,7 @@ using HEAP_T = HeapMemory<HIPAllocatorManaged>;
 #elif defined USE_COHERENT_HEAP
 using HEAP_T = HeapMemory<HIPAllocator>;
 #elif defined USE_HOST_HEAP
-using HEAP_T = HeapMemory<HostAllocator>;
+using HEAP_T = HeapMemory<HostHugePageAllocator>;
 #elif defined USE_HIP_HOST_HEAP
 using HEAP_T = HeapMemory<HIPHostAllocator>;
 #else
@@ -34,6 +34,7 @@
 #include <cstdlib>
 #include <limits>
 
+#include "huge_page_memory.hpp"
 #include "memory_allocator.hpp"
 
 // `hipDeviceMallocUncached` was introduced at ROCm 5.5
@@ -87,6 +88,12 @@ class HostAllocator : public MemoryAllocator {
   HostAllocator() : MemoryAllocator(std::malloc, std::free) {}
 };
 
+class HostHugePageAllocator : public MemoryAllocator {
+ public:
+  HostHugePageAllocator()
+      : MemoryAllocator(huge_page_alloc, huge_page_free) {}
+};
+
 class PosixAligned64Allocator : public MemoryAllocator {
  public:
   PosixAligned64Allocator() : MemoryAllocator(posix_memalign, std::free, 64) {}
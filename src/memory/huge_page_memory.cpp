@@ -0,0 +1,202 @@
+/******************************************************************************
+ * Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+
+
+#include "huge_page_memory.hpp"
+
+#include <hip/hip_runtime_api.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace rocshmem {
+
+namespace {
+
+/**
+ * @brief Memory policy mode from linux/mempolicy.h
+ */
+constexpr int MPOL_BIND_MODE{2};
+
+/**
+ * @brief Fallback huge page size when /proc/meminfo is unavailable
+ */
+constexpr size_t default_huge_page_size{2 << 20};
+
+/**
+ * @brief Sizes of live mappings keyed by their base address
+ *
+ * munmap needs the mapping length but MemoryAllocator only passes the
+ * pointer to its free function.
+ */
+std::unordered_map<void*, size_t> mapping_sizes;
+
+std::mutex mapping_sizes_mutex;
+
+size_t huge_page_size() {
+  std::ifstream meminfo("/proc/meminfo");
+  std::string key;
+  size_t value;
+  std::string unit;
+  while (meminfo >> key >> value) {
+    if (key == "Hugepagesize:") {
+      meminfo >> unit;
+      return value << 10;
+    }
+    meminfo.ignore(256, '\n');
+  }
+  return default_huge_page_size;
+}
+
+int read_int_env(const char* name, int default_value) {
+  if (auto value = getenv(name)) {
+    return atoi(value);
+  }
+  return default_value;
+}
+
+int select_numa_node() {
+  int node{read_int_env("ROCSHMEM_HOST_HEAP_NUMA_NODE", -1)};
+  if (node >= 0) {
+    return node;
+  }
+  return huge_page_device_numa_node();
+}
+
+void bind_to_numa_node(void* ptr, size_t length, int node) {
+  constexpr int bits_per_mask_word{sizeof(unsigned long) * 8};
+  if (node < 0 || node >= 64 * bits_per_mask_word) {
+    return;
+  }
+  std::vector<unsigned long> node_mask(node / bits_per_mask_word + 1, 0);
+  node_mask[node / bits_per_mask_word] |= 1UL << (node % bits_per_mask_word);
+  unsigned long max_node{node_mask.size() * bits_per_mask_word + 1};
+  /*
+   * Binding is a placement hint. Failure (for instance, no permission
+   * or a single node machine) leaves the default first-touch policy.
+   */
+  syscall(SYS_mbind, ptr, length, MPOL_BIND_MODE, node_mask.data(), max_node,
+          0);
+}
+
+void prefault(char* ptr, size_t length, size_t page_size, int num_threads) {
+  size_t num_pages{length / page_size};
+  size_t pages_per_thread{(num_pages + num_threads - 1) / num_threads};
+
+  std::vector<std::thread> threads;
+  for (int i{0}; i < num_threads; i++) {
+    size_t first_page{i * pages_per_thread};
+    size_t last_page{std::min(num_pages, first_page + pages_per_thread)};
+    if (first_page >= last_page) {
+      break;
+    }
+    threads.emplace_back([=]() {
+      for (size_t page{first_page}; page < last_page; page++) {
+        ptr[page * page_size] = 0;
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+}  // namespace
+
+void* huge_page_alloc(size_t size) {
+  size_t page_size{huge_page_size()};
+  size_t length{(size + page_size - 1) / page_size * page_size};
+
+  void* ptr{mmap(nullptr, length, PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0)};
+  if (ptr == MAP_FAILED) {
+    /*
+     * No explicit huge page pool; ask for transparent huge pages.
+     */
+    ptr = mmap(nullptr, length, PROT_READ | PROT_WRITE,
+               MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ptr == MAP_FAILED) {
+      return nullptr;
+    }
+    madvise(ptr, length, MADV_HUGEPAGE);
+  }
+
+  bind_to_numa_node(ptr, length, select_numa_node());
+
+  int num_threads{read_int_env("ROCSHMEM_HOST_HEAP_PREFAULT_THREADS", 0)};
+  if (num_threads > 0) {
+    prefault(reinterpret_cast<char*>(ptr), length, page_size, num_threads);
+  }
+
+  std::lock_guard<std::mutex> lock(mapping_sizes_mutex);
+  mapping_sizes[ptr] = length;
+  return ptr;
+}
+
+void huge_page_free(void* ptr) {
+  if (!ptr) {
+    return;
+  }
+  size_t length{0};
+  {
+    std::lock_guard<std::mutex> lock(mapping_sizes_mutex);
+    auto it{mapping_sizes.find(ptr)};
+    if (it == mapping_sizes.end()) {
+      return;
+    }
+    length = it->second;
+    mapping_sizes.erase(it);
+  }
+  munmap(ptr, length);
+}
+
+int huge_page_device_numa_node() {
+  int device;
+  if (hipGetDevice(&device) != hipSuccess) {
+    return -1;
+  }
+  char bus_id[64];
+  if (hipDeviceGetPCIBusId(bus_id, sizeof(bus_id), device) != hipSuccess) {
+    return -1;
+  }
+  std::string pci_address{bus_id};
+  std::transform(pci_address.begin(), pci_address.end(), pci_address.begin(),
+                 [](unsigned char c) { return std::tolower(c); });
+
+  std::ifstream numa_node_file("/sys/bus/pci/devices/" + pci_address +
+                               "/numa_node");
+  int node{-1};
+  numa_node_file >> node;
+  return node;
+}
+
+}  // namespace rocshmem
@@ -0,0 +1,70 @@
+/******************************************************************************
+ * Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+
+
+#ifndef LIBRARY_SRC_MEMORY_HUGE_PAGE_MEMORY_HPP_
+#define LIBRARY_SRC_MEMORY_HUGE_PAGE_MEMORY_HPP_
+
+#include <cstddef>
+
+/**
+ * @file huge_page_memory.hpp
+ *
+ * @brief Contains NUMA-aware huge page allocation routines for host heaps
+ *
+ * Host heaps are mapped with explicit huge pages (MAP_HUGETLB) when the
+ * system has a huge page pool and fall back to transparent huge pages
+ * (MADV_HUGEPAGE) otherwise. The mapping is bound to the NUMA node
+ * closest to the processing element's GPU unless a node is configured
+ * with ROCSHMEM_HOST_HEAP_NUMA_NODE. Setting
+ * ROCSHMEM_HOST_HEAP_PREFAULT_THREADS to a non-zero value touches every
+ * page with that many threads before the allocation is returned.
+ */
+
+namespace rocshmem {
+
+/**
+ * @brief Maps host memory backed by huge pages
+ *
+ * @param[in] Size in bytes of the allocation
+ *
+ * @return Pointer to the mapping or nullptr on failure
+ */
+void* huge_page_alloc(size_t size);
+
+/**
+ * @brief Unmaps memory returned by huge_page_alloc
+ *
+ * @param[in] Pointer returned by huge_page_alloc
+ */
+void huge_page_free(void* ptr);
+
+/**
+ * @brief Finds the NUMA node closest to the current HIP device
+ *
+ * @return NUMA node identifier or -1 if unknown
+ */
+int huge_page_device_numa_node();
+
+}  // namespace rocshmem
+
+#endif  // LIBRARY_SRC_MEMORY_HUGE_PAGE_MEMORY_HPP_
@@ -23,9 +23,14 @@
 #ifndef LIBRARY_SRC_MEMORY_POW2_BINS_HPP_
 #define LIBRARY_SRC_MEMORY_POW2_BINS_HPP_
 
+#include <algorithm>
+#include <array>
 #include <cassert>
+#include <cstdint>
 #include <map>
+#include <vector>
 
+#include "rocshmem/rocshmem_common.hpp"
 #include "../constants.hpp"
 #include "bin.hpp"
 #include "binner.hpp"
@@ -162,19 +167,152 @@ class Pow2Bins : public ShmemAllocatorStrategy {
    */
   __device__ void free([[maybe_unused]] char* ptr) override {}
 
+  /**
+   * @brief Allocates aligned memory from the heap
+   *
+   * Searches the bins for a record which contains a suitably aligned
+   * block and splits the record down to that block. Halves that do
+   * not contain the block are returned to their bins.
+   *
+   * @param[in, out] Address of raw pointer (&pointer_to_char)
+   * @param[in] Power-of-two alignment in bytes
+   * @param[in] Size in bytes of memory allocation
+   */
+  void alloc_aligned(char** ptr, size_t alignment, size_t request_size) {
+    assert(ptr);
+    assert(alignment && !(alignment & (alignment - 1)));
+    *ptr = nullptr;
+
+    if (alignment <= ALIGNMENT) {
+      alloc(ptr, request_size);
+      return;
+    }
+
+    if (!request_size) {
+      return;
+    }
+
+    auto block_it{bins_.lower_bound(request_size)};
+    if (block_it == bins_.end()) {
+      return;
+    }
+    size_t block_size{block_it->first};
+
+    for (auto it{block_it}; it != bins_.end(); it++) {
+      auto& [IGNORE, bin]{*it};
+      char* target{nullptr};
+      auto holds_aligned_block = [&](AR_T& record) {
+        target = aligned_block(record, alignment, block_size);
+        return target != nullptr;
+      };
+      AR_T record;
+      if (!bin.take_if(holds_aligned_block, &record)) {
+        continue;
+      }
+      while (record.get_size() > block_size) {
+        auto [smaller, larger]{record.split()};
+        if (target < larger.get_address()) {
+          emplace_record_in_bin(larger);
+          record = smaller;
+        } else {
+          emplace_record_in_bin(smaller);
+          record = larger;
+        }
+      }
+      emplace_in_proffered(record);
+      *ptr = record.get_address();
+      return;
+    }
+  }
+
+  /**
+   * @brief Grows an allocation without moving it
+   *
+   * Absorbs free records which directly follow the allocation until
+   * it is large enough. The allocation is left unchanged if the
+   * following memory is in use.
+   *
+   * @param[in] Raw pointer to heap memory
+   * @param[in] Requested size in bytes
+   *
+   * @return A boolean denoting whether the allocation now holds the size
+   */
+  bool grow_in_place(char* ptr, size_t request_size) {
+    auto prof_it{proffered_.find(ptr)};
+    assert(prof_it != proffered_.end());
+    auto& [IGNORE_RECORD_ADDR, record]{*prof_it};
+
+    std::vector<AR_T> absorbed;
+    AR_T grown{record};
+    while (grown.get_size() < request_size) {
+      char* neighbor{grown.get_address() + grown.get_size()};
+      auto bins_it{bins_.find(grown.get_size())};
+      AR_T neighbor_record;
+      auto is_neighbor = [neighbor](AR_T& r) {
+        return r.get_address() == neighbor;
+      };
+      if (bins_it == bins_.end() ||
+          !bins_it->second.take_if(is_neighbor, &neighbor_record)) {
+        for (auto& r : absorbed) {
+          emplace_record_in_bin(r);
+        }
+        return false;
+      }
+      absorbed.push_back(neighbor_record);
+      grown = grown.combine(neighbor_record);
+    }
+
+    note_retrieved(record);
+    record = grown;
+    note_proffered(record);
+    return true;
+  }
+
+  /**
+   * @brief Size of the record backing an allocation
+   *
+   * @param[in] Raw pointer to heap memory
+   *
+   * @return Usable size in bytes
+   */
+  size_t usable_size(char* ptr) {
+    auto prof_it{proffered_.find(ptr)};
+    assert(prof_it != proffered_.end());
+    return prof_it->second.get_size();
+  }
+
   /**
    * @brief Sum of all proffered_ memory sizes
    *
    * @return memory size
    */
-  size_t amount_proffered() {
-    size_t size{0};
-    auto sum_sizes = [&size](const auto& pair) {
-      auto [address, record] = pair;
-      size += record.get_size();
-    };
-    std::for_each(proffered_.begin(), proffered_.end(), sum_sizes);
-    return size;
+  size_t amount_proffered() { return amount_proffered_; }
+
+  /**
+   * @brief Adds this strategy's block statistics to a heap statistics
+   * object
+   *
+   * Allocated block counts are maintained as records are proffered and
+   * retrieved. Free block counts are read from the bins, so the cost is
+   * proportional to the number of size classes.
+   *
+   * @param[in, out] Heap statistics object
+   */
+  void accumulate_stats(rocshmem_heap_stats_t* stats) {
+    stats->used_bytes += amount_proffered_;
+    for (int k{0}; k < ROCSHMEM_HEAP_STATS_NUM_SIZE_CLASSES; k++) {
+      stats->allocated_blocks[k] += allocated_per_class_[k];
+    }
+    for (auto& [bin_size, bin] : bins_) {
+      size_t num_free{bin.size()};
+      if (!num_free) {
+        continue;
+      }
+      stats->free_blocks[size_class(bin_size)] += num_free;
+      stats->free_bytes += num_free * bin_size;
+      stats->largest_free_block =
+          std::max(stats->largest_free_block, bin_size);
+    }
   }
 
   /**
@@ -202,6 +340,30 @@ class Pow2Bins : public ShmemAllocatorStrategy {
     bin.put(record);
   }
 
+  /**
+   * @brief Find an aligned block inside a record
+   *
+   * Records are split in halves, so a block of size block_size can only
+   * start at a multiple of block_size from the record address.
+   *
+   * @param[in] An address record
+   * @param[in] Power-of-two alignment in bytes
+   * @param[in] Power-of-two block size in bytes
+   *
+   * @return Address of the block or nullptr if none exists
+   */
+  char* aligned_block(AR_T& record, size_t alignment, size_t block_size) {
+    auto addr{reinterpret_cast<uintptr_t>(record.get_address())};
+    uintptr_t target{(addr + alignment - 1) & ~(alignment - 1)};
+    if ((target - addr) % block_size) {
+      return nullptr;
+    }
+    if (target + block_size > addr + record.get_size()) {
+      return nullptr;
+    }
+    return reinterpret_cast<char*>(target);
+  }
+
   /**
    * @brief Retrieve address record from bin within a BINS_IT_T
    *
@@ -294,8 +456,38 @@ class Pow2Bins : public ShmemAllocatorStrategy {
   void emplace_in_proffered(AR_T record) {
     assert(record.get_address());
     proffered_[record.get_address()] = record;
+    note_proffered(record);
   }
 
+  /**
+   * @brief Account for a record handed to the user
+   *
+   * @param[in] An address record
+   */
+  void note_proffered(AR_T record) {
+    amount_proffered_ += record.get_size();
+    allocated_per_class_[size_class(record.get_size())]++;
+  }
+
+  /**
+   * @brief Account for a record returned by the user
+   *
+   * @param[in] An address record
+   */
+  void note_retrieved(AR_T record) {
+    amount_proffered_ -= record.get_size();
+    allocated_per_class_[size_class(record.get_size())]--;
+  }
+
+  /**
+   * @brief Size class of a power-of-two block size
+   *
+   * @param[in] Block size in bytes
+   *
+   * @return Base-two logarithm of the block size
+   */
+  static int size_class(size_t size) { return find_first_set_one(size); }
+
   /**
    * @brief Retrieve record from proffered_ data structure
    *
@@ -314,6 +506,7 @@ class Pow2Bins : public ShmemAllocatorStrategy {
 
     auto [IGNORE_RECORD_ADDR, record]{*prof_it};
     proffered_.erase(prof_it);
+    note_retrieved(record);
 
     return record;
   }
@@ -346,6 +539,17 @@ class Pow2Bins : public ShmemAllocatorStrategy {
    * through the "free" interface.
    */
   PROFFERED_T proffered_{};
+
+  /**
+   * @brief Sum of the sizes of all records in proffered_
+   */
+  size_t amount_proffered_{0};
+
+  /**
+   * @brief Number of records in proffered_ per power-of-two size class
+   */
+  std::array<size_t, ROCSHMEM_HEAP_STATS_NUM_SIZE_CLASSES>
+      allocated_per_class_{};
 };
 
 }  // namespace rocshmem
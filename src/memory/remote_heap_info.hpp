@@ -27,8 +27,10 @@
 #include <mpi.h>
 
 #include <cassert>
+#include <memory>
 #include <vector>
 
+#include "heap_segment_table.hpp"
 #include "hip_allocator.hpp"
 #include "window_info.hpp"
 
@@ -91,6 +93,22 @@ class CommunicatorMPI {
                   MPI_CHAR, comm_);
   }
 
+  /**
+   * @brief Gathers the MPI address of a local pointer from every PE
+   *
+   * @param[in] Local pointer
+   *
+   * @return MPI address of the pointer on each processing element
+   */
+  std::vector<MPI_Aint> allgather_address(void* ptr) {
+    MPI_Aint address{0};
+    MPI_Get_address(ptr, &address);
+    std::vector<MPI_Aint> addresses(num_pes_);
+    MPI_Allgather(&address, 1, MPI_AINT, addresses.data(), 1, MPI_AINT,
+                  comm_);
+    return addresses;
+  }
+
   /**
    * @brief Accessor method for heap_window_info_
    */
@@ -149,6 +167,40 @@ class RemoteHeapInfo {
     communicator_.allgather(heap_bases_.data());
 
     device_heap_bases_ = heap_bases_.data();
+
+    segment_table_.add_segment(heap_ptr, heap_size, heap_bases_.data());
+    segment_displacements_.push_back(communicator_.allgather_address(heap_ptr));
+  }
+
+  /**
+   * @brief Exchanges the base addresses of a new heap segment
+   *
+   * @param[in] Local base address of the segment
+   * @param[in] Size in bytes of the segment
+   *
+   * @return Index of the segment in the segment table
+   *
+   * @note Collective across all processing elements. The segment is also
+   * attached to the communicator's window.
+   */
+  int add_segment(char* segment_ptr, size_t segment_size) {
+    auto bases{std::make_unique<HEAP_BASES_T>(communicator_.num_pes())};
+    for (auto& base : *bases) {
+      base = nullptr;
+    }
+    (*bases)[communicator_.my_pe()] = segment_ptr;
+    communicator_.allgather(bases->data());
+
+    int index{segment_table_.add_segment(segment_ptr, segment_size,
+                                         bases->data())};
+    assert(index >= 0);
+    segment_bases_.push_back(std::move(bases));
+    segment_displacements_.push_back(
+        communicator_.allgather_address(segment_ptr));
+
+    communicator_.get_window_info()->attach(segment_ptr, segment_size,
+                                            segment_displacements_[index]);
+    return index;
   }
 
   /**
@@ -191,6 +243,27 @@ class RemoteHeapInfo {
    */
   __device__ auto get_heap_bases() { return device_heap_bases_; }
 
+  /**
+   * @brief Accessor for heap segment table
+   *
+   * @return Table used to translate addresses in any heap segment
+   */
+  __host__ __device__ HeapSegmentTable* get_segment_table() {
+    return &segment_table_;
+  }
+
+  /**
+   * @brief Accessor for the window displacements of a heap segment
+   *
+   * @param[in] Index of the segment in the segment table
+   *
+   * @return MPI address of the segment base on each processing element
+   */
+  __host__ const std::vector<MPI_Aint>& get_segment_displacements(
+      int segment) {
+    return segment_displacements_[segment];
+  }
+
  private:
   /**
    * @brief Communicator implementation
@@ -216,6 +289,29 @@ class RemoteHeapInfo {
    * @note Used by __device__ code
    */
   char** device_heap_bases_{nullptr};
+
+  /**
+   * @brief Base addresses of segments added after construction
+   *
+   * The vectors are kept behind owning pointers so the addresses stored
+   * in segment_table_ remain valid.
+   */
+  std::vector<std::unique_ptr<HEAP_BASES_T>> segment_bases_{};
+
+  /**
+   * @brief Local and remote base addresses of every heap segment
+   */
+  HeapSegmentTable segment_table_{};
+
+  /**
+   * @brief MPI address of every heap segment base on each processing
+   * element, used to attach the segments to dynamic windows
+   */
+  std::vector<std::vector<MPI_Aint>> segment_displacements_{};
+
+  static_assert(HeapSegmentTable::MAX_NUM_SEGMENTS <=
+                    WindowInfo::MAX_NUM_SEGMENTS,
+                "every heap segment must fit in the windows");
 };
 
 }  // namespace rocshmem
@@ -22,22 +22,50 @@
 
 #include "single_heap.hpp"
 
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <limits>
 #include <sstream>
+#include <thread>
+#include <vector>
+
+#include "../util.hpp"
 
 namespace rocshmem {
 
-SingleHeap::SingleHeap() {
-  if (auto heap_size_cstr = getenv("ROCSHMEM_HEAP_SIZE")) {
-    std::stringstream sstream(heap_size_cstr);
-    size_t heap_size;
-    sstream >> heap_size;
-    heap_mem_ = HEAP_T{heap_size};
-    strat_ = STRAT_T{&heap_mem_};
+namespace {
+
+size_t read_size_env(const char* name, size_t default_size) {
+  if (auto size_cstr = getenv(name)) {
+    std::stringstream sstream(size_cstr);
+    size_t size;
+    sstream >> size;
+    return size;
   }
+  return default_size;
+}
+
+}  // namespace
+
+SingleHeap::SingleHeap() {
+  constexpr size_t gibibyte{1 << 30};
+  size_t heap_size{read_size_env("ROCSHMEM_HEAP_SIZE", gibibyte)};
+  growth_size_ = read_size_env("ROCSHMEM_HEAP_GROWTH_SIZE", heap_size);
+  segments_.push_back(std::make_unique<Segment>(heap_size));
 }
 
 void SingleHeap::malloc(void** ptr, size_t size) {
-  strat_.alloc(reinterpret_cast<char**>(ptr), size);
+  *ptr = nullptr;
+  for (auto& segment : segments_) {
+    segment->strat.alloc(reinterpret_cast<char**>(ptr), size);
+    if (*ptr) {
+      break;
+    }
+  }
+  if (size) {
+    note_alloc(*ptr);
+  }
 }
 
 __device__ void SingleHeap::malloc(void** ptr, size_t size) {}
@@ -46,21 +74,188 @@ void SingleHeap::free(void* ptr) {
   if (!ptr) {
     return;
   }
-  strat_.free(reinterpret_cast<char*>(ptr));
+  auto* segment{find_segment(ptr)};
+  assert(segment);
+  segment->strat.free(reinterpret_cast<char*>(ptr));
+  num_frees_++;
 }
 
 __device__ void SingleHeap::free(void* ptr) {}
 
-void* SingleHeap::realloc(void* ptr, size_t size) { return nullptr; }
+void* SingleHeap::realloc(void* ptr, size_t size) {
+  if (!ptr) {
+    void* new_ptr;
+    malloc(&new_ptr, size);
+    return new_ptr;
+  }
+  if (!size) {
+    free(ptr);
+    return nullptr;
+  }
+
+  auto* segment{find_segment(ptr)};
+  assert(segment);
+  char* char_ptr{reinterpret_cast<char*>(ptr)};
+  if (segment->strat.grow_in_place(char_ptr, size)) {
+    high_water_ = std::max(high_water_, get_used());
+    return ptr;
+  }
+
+  void* new_ptr;
+  malloc(&new_ptr, size);
+  if (!new_ptr) {
+    return nullptr;
+  }
+  copy(new_ptr, ptr, std::min(size, segment->strat.usable_size(char_ptr)));
+  free(ptr);
+  return new_ptr;
+}
+
+void* SingleHeap::malign(size_t alignment, size_t size) {
+  if (!alignment || (alignment & (alignment - 1))) {
+    return nullptr;
+  }
+  char* ptr{nullptr};
+  for (auto& segment : segments_) {
+    segment->strat.alloc_aligned(&ptr, alignment, size);
+    if (ptr) {
+      break;
+    }
+  }
+  if (size) {
+    note_alloc(ptr);
+  }
+  return ptr;
+}
+
+void* SingleHeap::calloc(size_t count, size_t size) {
+  if (size && count > std::numeric_limits<size_t>::max() / size) {
+    return nullptr;
+  }
+  void* ptr;
+  malloc(&ptr, count * size);
+  if (ptr) {
+    zero(ptr, count * size);
+  }
+  return ptr;
+}
 
-void* SingleHeap::malign(size_t alignment, size_t size) { return nullptr; }
+int SingleHeap::add_segment(size_t size) {
+  if (segments_.size() == MAX_NUM_SEGMENTS_) {
+    return -1;
+  }
+  /*
+   * The power-of-two bins can only serve a request as large as the
+   * largest bin, so round the segment size up to a power of two.
+   */
+  size_t segment_size{1};
+  while (segment_size < std::max(size, growth_size_)) {
+    segment_size <<= 1;
+  }
+  segments_.push_back(std::make_unique<Segment>(segment_size));
+  return segments_.size() - 1;
+}
 
-char* SingleHeap::get_base_ptr() { return heap_mem_.get_ptr(); }
+char* SingleHeap::get_base_ptr() { return get_segment_base_ptr(0); }
 
-size_t SingleHeap::get_size() { return heap_mem_.get_size(); }
+size_t SingleHeap::get_size() {
+  size_t size{0};
+  for (auto& segment : segments_) {
+    size += segment->heap_mem.get_size();
+  }
+  return size;
+}
 
-size_t SingleHeap::get_used() { return strat_.amount_proffered(); }
+size_t SingleHeap::get_used() {
+  size_t used{0};
+  for (auto& segment : segments_) {
+    used += segment->strat.amount_proffered();
+  }
+  return used;
+}
 
 size_t SingleHeap::get_avail() { return get_size() - get_used(); }
 
+void SingleHeap::get_stats(rocshmem_heap_stats_t* stats) {
+  *stats = rocshmem_heap_stats_t{};
+  for (auto& segment : segments_) {
+    segment->strat.accumulate_stats(stats);
+  }
+  stats->high_water_bytes = high_water_;
+  stats->num_segments = segments_.size();
+  stats->num_allocs = num_allocs_;
+  stats->num_frees = num_frees_;
+  stats->num_failed_allocs = num_failed_allocs_;
+
+  std::chrono::duration<double> elapsed{CLOCK_T::now() - stats_start_};
+  if (elapsed.count() > 0) {
+    stats->allocs_per_second = num_allocs_ / elapsed.count();
+    stats->frees_per_second = num_frees_ / elapsed.count();
+  }
+}
+
+void SingleHeap::reset_stats() {
+  num_allocs_ = 0;
+  num_frees_ = 0;
+  num_failed_allocs_ = 0;
+  high_water_ = get_used();
+  stats_start_ = CLOCK_T::now();
+}
+
+void SingleHeap::note_alloc(void* ptr) {
+  if (!ptr) {
+    return;
+  }
+  num_allocs_++;
+  high_water_ = std::max(high_water_, get_used());
+}
+
+void SingleHeap::copy(void* dst, const void* src, size_t size) {
+#ifdef USE_HOST_HEAP
+  std::memcpy(dst, src, size);
+#else
+  CHECK_HIP(hipMemcpy(dst, src, size, hipMemcpyDefault));
+#endif
+}
+
+void SingleHeap::zero(void* ptr, size_t size) {
+#ifdef USE_HOST_HEAP
+  /*
+   * Split large host heap clears across threads; first touch on huge
+   * page backed heaps makes a single-threaded memset page-fault bound.
+   */
+  constexpr size_t bytes_per_thread{1 << 24};
+  size_t num_threads{std::min<size_t>(std::thread::hardware_concurrency(),
+                                      size / bytes_per_thread)};
+  if (num_threads < 2) {
+    std::memset(ptr, 0, size);
+    return;
+  }
+  size_t chunk{(size + num_threads - 1) / num_threads};
+  std::vector<std::thread> threads;
+  for (size_t i{0}; i < num_threads; i++) {
+    char* start{reinterpret_cast<char*>(ptr) + i * chunk};
+    size_t length{std::min(chunk, size - i * chunk)};
+    threads.emplace_back([=]() { std::memset(start, 0, length); });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+#else
+  CHECK_HIP(hipMemset(ptr, 0, size));
+  CHECK_HIP(hipDeviceSynchronize());
+#endif
+}
+
+SingleHeap::Segment* SingleHeap::find_segment(void* ptr) {
+  char* addr{reinterpret_cast<char*>(ptr)};
+  for (auto& segment : segments_) {
+    char* base{segment->heap_mem.get_ptr()};
+    if (addr >= base && addr < base + segment->heap_mem.get_size()) {
+      return segment.get();
+    }
+  }
+  return nullptr;
+}
+
 }  // namespace rocshmem
@@ -23,6 +23,10 @@
 #ifndef LIBRARY_SRC_MEMORY_SINGLE_HEAP_HPP_
 #define LIBRARY_SRC_MEMORY_SINGLE_HEAP_HPP_
 
+#include <chrono>
+#include <memory>
+#include <vector>
+
 #include "address_record.hpp"
 #include "heap_memory.hpp"
 #include "heap_type.hpp"
@@ -35,6 +39,10 @@
  *
  * The single heap implements local processing element allocations. The
  * symmetric heap delegates allocations to this class.
+ *
+ * The heap is made of one or more segments. The first segment is created
+ * by the constructor. Additional segments are appended by add_segment
+ * when the existing segments cannot satisfy a request.
  */
 
 namespace rocshmem {
@@ -50,6 +58,20 @@ class SingleHeap {
    */
   using STRAT_T = Pow2Bins<AR_T, HEAP_T>;
 
+  /**
+   * @brief Heap memory and allocation strategy of one segment
+   *
+   * The strategy holds a pointer to the heap memory so segments are
+   * kept behind owning pointers and never moved.
+   */
+  struct Segment {
+    explicit Segment(size_t size) : heap_mem{size} {}
+
+    HEAP_T heap_mem;
+
+    STRAT_T strat{&heap_mem};
+  };
+
  public:
   /**
    * @brief Primary constructor
@@ -91,25 +113,53 @@ class SingleHeap {
   __device__ void free(void* ptr);
 
   /**
-   * @brief
+   * @brief Changes the size of an allocation
+   *
+   * The allocation grows in place when the memory following it is free.
+   * Otherwise, a new allocation is made, the contents are copied and the
+   * old allocation is freed.
    *
-   * @param[in]
-   * @param[in]
+   * @param[in] Raw pointer to heap memory (may be nullptr)
+   * @param[in] Size in bytes of new allocation
    *
-   * @return
+   * @return Pointer to the resized allocation or nullptr on failure
+   * (the original allocation is left untouched)
    */
   void* realloc(void* ptr, size_t size);
 
   /**
-   * @brief
+   * @brief Allocates memory aligned to a power of two
    *
-   * @param[in]
-   * @param[in]
+   * @param[in] Power-of-two alignment in bytes
+   * @param[in] Size in bytes of memory allocation
    *
-   * @return
+   * @return Pointer to the allocation or nullptr on failure
    */
   void* malign(size_t alignment, size_t size);
 
+  /**
+   * @brief Allocates zero-filled memory for an array
+   *
+   * @param[in] Number of array elements
+   * @param[in] Size in bytes of each element
+   *
+   * @return Pointer to the allocation or nullptr on failure
+   */
+  void* calloc(size_t count, size_t size);
+
+  /**
+   * @brief Appends a segment to the heap
+   *
+   * The segment holds at least the requested number of bytes and at
+   * least ROCSHMEM_HEAP_GROWTH_SIZE bytes (defaults to the initial heap
+   * size).
+   *
+   * @param[in] Size in bytes of the request which triggered growth
+   *
+   * @return Index of the new segment or -1 if no segment can be added
+   */
+  int add_segment(size_t size);
+
   /**
    * @brief Accessor for heap base ptr
    *
@@ -120,10 +170,39 @@ class SingleHeap {
   /**
    * @brief Accessor for heap size
    *
-   * @return Amount of bytes in heap
+   * @return Amount of bytes in heap (all segments)
    */
   size_t get_size();
 
+  /**
+   * @brief Accessor for number of segments
+   *
+   * @return Number of segments in heap
+   */
+  int get_num_segments() { return segments_.size(); }
+
+  /**
+   * @brief Accessor for segment base ptr
+   *
+   * @param[in] Segment index
+   *
+   * @return Pointer to base of the segment
+   */
+  char* get_segment_base_ptr(int segment) {
+    return segments_[segment]->heap_mem.get_ptr();
+  }
+
+  /**
+   * @brief Accessor for segment size
+   *
+   * @param[in] Segment index
+   *
+   * @return Amount of bytes in the segment
+   */
+  size_t get_segment_size(int segment) {
+    return segments_[segment]->heap_mem.get_size();
+  }
+
   /**
    * @brief Accessor for heap usage
    *
@@ -138,23 +217,115 @@ class SingleHeap {
    */
   size_t get_avail();
 
+  /**
+   * @brief Collects usage and fragmentation statistics
+   *
+   * @param[out] Heap statistics object
+   */
+  void get_stats(rocshmem_heap_stats_t* stats);
+
+  /**
+   * @brief Restarts operation counters and the high-water mark
+   */
+  void reset_stats();
+
+  /**
+   * @brief Counts an allocation request that failed even after the heap
+   * was given the chance to grow
+   */
+  void note_failed_alloc() { num_failed_allocs_++; }
+
   /**
    * @brief Returns is the heap is allocated with managed memory
    *
    * @return bool
    */
-  bool is_managed() { return heap_mem_.is_managed(); }
+  bool is_managed() { return segments_.front()->heap_mem.is_managed(); }
 
  private:
   /**
-   * @brief Heap memory object
+   * @brief Finds the segment which owns an address
+   *
+   * @param[in] Raw pointer to heap memory
+   *
+   * @return Segment owning the address or nullptr
+   */
+  Segment* find_segment(void* ptr);
+
+  /**
+   * @brief Copies bytes between heap allocations
+   *
+   * @param[in] Destination raw pointer
+   * @param[in] Source raw pointer
+   * @param[in] Number of bytes
+   */
+  void copy(void* dst, const void* src, size_t size);
+
+  /**
+   * @brief Zeroes bytes of a heap allocation
+   *
+   * Host heaps are cleared by several threads. Device heaps are cleared
+   * by a device memset.
+   *
+   * @param[in] Raw pointer to heap memory
+   * @param[in] Number of bytes
+   */
+  void zero(void* ptr, size_t size);
+
+  /**
+   * @brief Updates operation counters after an allocation attempt
+   *
+   * A failed attempt is not counted here; the caller may still grow the
+   * heap and retry, and calls note_failed_alloc if that fails too.
+   *
+   * @param[in] Allocated pointer or nullptr on failure
+   */
+  void note_alloc(void* ptr);
+
+  /**
+   * @brief Helper type for statistics timestamps
+   */
+  using CLOCK_T = std::chrono::steady_clock;
+
+  /**
+   * @brief Number of successful allocations since last reset
+   */
+  size_t num_allocs_{0};
+
+  /**
+   * @brief Number of frees since last reset
+   */
+  size_t num_frees_{0};
+
+  /**
+   * @brief Number of failed allocations since last reset
+   */
+  size_t num_failed_allocs_{0};
+
+  /**
+   * @brief Largest number of used bytes since last reset
+   */
+  size_t high_water_{0};
+
+  /**
+   * @brief Time of construction or last reset
+   */
+  CLOCK_T::time_point stats_start_{CLOCK_T::now()};
+
+  /**
+   * @brief Upper bound on the number of segments
+   */
+  static constexpr size_t MAX_NUM_SEGMENTS_{16};
+
+  /**
+   * @brief Minimum size of segments added by add_segment
    */
-  HEAP_T heap_mem_{};
+  size_t growth_size_{0};
 
   /**
-   * @brief Allocation strategy object
+   * @brief Heap segments (index zero is the initial heap)
    */
-  STRAT_T strat_{&heap_mem_};
+  std::vector<std::unique_ptr<Segment>> segments_{};
 };
 
 }  // namespace rocshmem
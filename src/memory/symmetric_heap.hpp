@@ -69,6 +69,115 @@ class SymmetricHeap {
    */
   void free(void* ptr) { single_heap_.free(ptr); }
 
+  /**
+   * @brief Changes the size of previously allocated memory
+   *
+   * @param[in] Handle of previously allocated memory
+   * @param[in] Number of bytes requested
+   *
+   * @return Handle of resized memory or nullptr
+   */
+  void* realloc(void* ptr, size_t size) {
+    return single_heap_.realloc(ptr, size);
+  }
+
+  /**
+   * @brief Allocates aligned heap memory
+   *
+   * @param[in] Power-of-two alignment in bytes
+   * @param[in] Number of bytes requested
+   *
+   * @return Handle of allocated memory or nullptr
+   */
+  void* malign(size_t alignment, size_t size) {
+    return single_heap_.malign(alignment, size);
+  }
+
+  /**
+   * @brief Allocates zero-filled heap memory
+   *
+   * @param[in] Number of elements requested
+   * @param[in] Size in bytes of each element
+   *
+   * @return Handle of allocated memory or nullptr
+   */
+  void* calloc(size_t count, size_t size) {
+    return single_heap_.calloc(count, size);
+  }
+
+  /**
+   * @brief Adds a segment large enough to hold a request
+   *
+   * The new segment base addresses are exchanged with all processing
+   * elements and registered in the segment table.
+   *
+   * @param[in] Number of bytes of the request which did not fit
+   *
+   * @return Index of the new segment or -1 if the heap cannot grow
+   *
+   * @note Collective across all processing elements
+   */
+  int grow(size_t size) {
+    int segment{single_heap_.add_segment(size)};
+    if (segment < 0) {
+      return segment;
+    }
+    return remote_heap_info_.add_segment(
+        single_heap_.get_segment_base_ptr(segment),
+        single_heap_.get_segment_size(segment));
+  }
+
+  /**
+   * @brief Creates a window over every segment of the heap
+   *
+   * @param[in] Communicator of the window
+   *
+   * @return Window owned by the caller
+   *
+   * @note Collective over the communicator
+   */
+  WindowInfo* create_window_info(MPI_Comm comm) {
+    auto* segment_table{remote_heap_info_.get_segment_table()};
+    auto* window_info{new WindowInfo(comm, segment_table->get_local_base(0),
+                                     segment_table->get_size(0))};
+    for (int i{1}; i < segment_table->get_num_segments(); i++) {
+      attach_segment(window_info, i);
+    }
+    return window_info;
+  }
+
+  /**
+   * @brief Attaches a segment added by grow to a window
+   *
+   * @param[in] Window created by create_window_info
+   * @param[in] Index of the segment
+   */
+  void attach_segment(WindowInfo* window_info, int segment) {
+    auto* segment_table{remote_heap_info_.get_segment_table()};
+    window_info->attach(segment_table->get_local_base(segment),
+                        segment_table->get_size(segment),
+                        remote_heap_info_.get_segment_displacements(segment));
+  }
+
+  /**
+   * @brief Collects usage and fragmentation statistics
+   *
+   * @param[out] Heap statistics object
+   */
+  void get_stats(rocshmem_heap_stats_t* stats) {
+    single_heap_.get_stats(stats);
+  }
+
+  /**
+   * @brief Restarts heap operation counters and the high-water mark
+   */
+  void reset_stats() { single_heap_.reset_stats(); }
+
+  /**
+   * @brief Counts an allocation request that failed after growing
+   */
+  void note_failed_alloc() { single_heap_.note_failed_alloc(); }
+
   /**
    * @brief Accessor for local heap base
    *
@@ -78,9 +187,18 @@ class SymmetricHeap {
 
   /**
    * @brief Accessor method for heap size
+   *
+   * @note Sum over all segments, which are not contiguous
    */
   auto get_size() { return single_heap_.get_size(); }
 
+  /**
+   * @brief Accessor for the size of the first segment
+   *
+   * @return Size in bytes of the range starting at the local heap base
+   */
+  auto get_base_size() { return single_heap_.get_segment_size(0); }
+
   /**
    * @brief Accessor method for heap_window_info_
    */
@@ -104,6 +222,15 @@ class SymmetricHeap {
     return remote_heap_info_.get_heap_bases();
   }
 
+  /**
+   * @brief Accessor for heap segment table
+   *
+   * @return Table used to translate addresses in any heap segment
+   */
+  __host__ __device__ auto get_segment_table() {
+    return remote_heap_info_.get_segment_table();
+  }
+
   /**
    * @brief Returns is the heap is allocated with managed memory
    *
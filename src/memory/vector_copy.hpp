@@ -0,0 +1,136 @@
+/******************************************************************************
+ * Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+
+#ifndef LIBRARY_SRC_MEMORY_VECTOR_COPY_HPP_
+#define LIBRARY_SRC_MEMORY_VECTOR_COPY_HPP_
+
+#include <hip/hip_runtime.h>
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @file vector_copy.hpp
+ *
+ * @brief Address splitting and lane striping of the 16-byte copy routines
+ *
+ * A copy is split into a head which brings the destination to a 16-byte
+ * boundary, a body of whole 16-byte vectors and a tail shorter than one
+ * vector. The body is striped across the lanes taking part in the copy:
+ * each lane handles up to VECTOR_COPY_UNROLL vectors per iteration, one
+ * lane count apart, so the lanes of a wavefront access consecutive
+ * vectors and every lane keeps several loads in flight before storing.
+ */
+
+namespace rocshmem {
+
+/**
+ * @brief Bytes moved by one vector load or store (dwordx4)
+ */
+constexpr size_t VECTOR_COPY_WIDTH = 16;
+
+/**
+ * @brief Vectors loaded by a lane before it stores any of them
+ */
+constexpr int VECTOR_COPY_UNROLL = 4;
+
+/**
+ * @brief Smallest copy which takes the vector path
+ *
+ * Below it the head and tail peeling costs more than the wider stores
+ * save, and the scalar routines are used.
+ */
+constexpr size_t VECTOR_COPY_MIN_BYTES = 256;
+
+struct CopySplit {
+  /**
+   * @brief Bytes copied before the first aligned vector
+   */
+  size_t head;
+
+  /**
+   * @brief Bytes copied as whole vectors, a multiple of VECTOR_COPY_WIDTH
+   */
+  size_t body;
+
+  /**
+   * @brief Bytes copied after the last vector
+   */
+  size_t tail;
+};
+
+/**
+ * @brief Splits a copy into head, body and tail
+ *
+ * The body is empty when the copy is below VECTOR_COPY_MIN_BYTES or when
+ * source and destination cannot be aligned together; the whole copy is
+ * then reported as head.
+ *
+ * @param[in] dst destination address
+ * @param[in] src source address
+ * @param[in] size bytes to copy
+ *
+ * @return the split
+ */
+__host__ __device__ inline CopySplit copy_split(const void *dst,
+                                                const void *src,
+                                                size_t size) {
+  uintptr_t dst_addr{reinterpret_cast<uintptr_t>(dst)};
+  uintptr_t src_addr{reinterpret_cast<uintptr_t>(src)};
+  if (size < VECTOR_COPY_MIN_BYTES ||
+      (dst_addr - src_addr) % VECTOR_COPY_WIDTH != 0) {
+    return {size, 0, 0};
+  }
+  size_t head{(VECTOR_COPY_WIDTH - dst_addr % VECTOR_COPY_WIDTH) %
+              VECTOR_COPY_WIDTH};
+  size_t body{(size - head) / VECTOR_COPY_WIDTH * VECTOR_COPY_WIDTH};
+  return {head, body, size - head - body};
+}
+
+/**
+ * @brief Calls fn on every group of vectors one lane copies
+ *
+ * fn receives the index of the first vector of the group, the distance
+ * between the vectors of the group and their number (at most
+ * VECTOR_COPY_UNROLL). Across all lanes every vector in [0, num_vectors)
+ * is visited exactly once.
+ *
+ * @param[in] lane index of the calling lane in [0, num_lanes)
+ * @param[in] num_lanes lanes taking part in the copy
+ * @param[in] num_vectors vectors in the body
+ * @param[in] fn callable taking (first, stride, count)
+ */
+template <typename FN_T>
+__host__ __device__ void for_each_vector_group(size_t lane, size_t num_lanes,
+                                               size_t num_vectors, FN_T fn) {
+  size_t step{num_lanes * VECTOR_COPY_UNROLL};
+  for (size_t first{lane}; first < num_vectors; first += step) {
+    size_t left{(num_vectors - first + num_lanes - 1) / num_lanes};
+    int count{left < VECTOR_COPY_UNROLL ? static_cast<int>(left)
+                                        : VECTOR_COPY_UNROLL};
+    fn(first, num_lanes, count);
+  }
+}
+
+}  // namespace rocshmem
+
+#endif  // LIBRARY_SRC_MEMORY_VECTOR_COPY_HPP_
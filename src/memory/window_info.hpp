@@ -25,19 +25,38 @@
 
 #include <mpi.h>
 
+#include <array>
 #include <cassert>
 #include <memory>
+#include <vector>
+
+#include "dirty_pe_set.hpp"
 
 /**
  * @file window_info.hpp
  *
  * @brief Contains information about symmetric heaps' windows
+ *
+ * The initial heap segment is exposed through a window created over it,
+ * so the displacement of an address in it is its offset from the cached
+ * segment start. Segments added to a growing heap are attached to a
+ * dynamic window created with the first of them. Displacements in a
+ * dynamic window are addresses on the target, so each grown segment keeps
+ * the base displacement of every PE.
  */
 
 namespace rocshmem {
 
+class PutAggregator;
+
 class WindowInfo {
  public:
+  /**
+   * @brief Upper bound on the number of segments, including the initial
+   * one, covered by a window
+   */
+  static constexpr int MAX_NUM_SEGMENTS{16};
+
   /**
    * @brief Default constructor
    */
@@ -45,11 +64,17 @@ class WindowInfo {
 
   /**
    * @brief Primary constructor
+   *
+   * Collective over comm: creates the window over the initial segment.
    */
   WindowInfo(MPI_Comm comm, void* start, size_t size)
       : comm_{comm},
-        win_start_{start},
+        win_start_{reinterpret_cast<char*>(start)},
         win_end_{reinterpret_cast<char*>(start) + size} {
+    int num_pes{0};
+    MPI_Comm_size(comm_, &num_pes);
+    dirty_pes_.resize(num_pes);
+
     up_win_ = std::unique_ptr<MPI_Win>(new MPI_Win);
     MPI_Win_create(win_start_, size, 1, MPI_INFO_NULL, comm_, up_win_.get());
     MPI_Win_lock_all(MPI_MODE_NOCHECK, *up_win_.get());
@@ -63,6 +88,13 @@ class WindowInfo {
       MPI_Win_unlock_all(*up_win_.get());
       MPI_Win_free(up_win_.get());
     }
+    if (up_dyn_win_) {
+      MPI_Win_unlock_all(*up_dyn_win_.get());
+      for (int i{0}; i < num_segments_; i++) {
+        MPI_Win_detach(*up_dyn_win_.get(), segments_[i].start);
+      }
+      MPI_Win_free(up_dyn_win_.get());
+    }
   }
 
   /**
@@ -99,10 +131,47 @@ class WindowInfo {
   /**
    * @brief Accessor for object in up_win_
    *
-   * @return MPI_Win object
+   * @return MPI_Win object over the initial segment
    */
   MPI_Win get_win() const { return *up_win_.get(); }
 
+  /**
+   * @brief Accessor for the window which exposes an address
+   *
+   * @param[in] Address in raw pointer format
+   *
+   * @return MPI_Win object to pass with get_offset of the address
+   */
+  MPI_Win get_win(const void* addr) const {
+    if (in_base(addr)) {
+      return *up_win_.get();
+    }
+    assert(find_segment(addr));
+    return *up_dyn_win_.get();
+  }
+
+  /**
+   * @brief Calls fn on every MPI window of this object
+   *
+   * Completion points use it to reach operations on grown segments too.
+   *
+   * @param[in] fn callable taking an MPI_Win
+   */
+  template <typename FN_T>
+  void for_each_win(FN_T fn) const {
+    fn(*up_win_.get());
+    if (__atomic_load_n(&num_segments_, __ATOMIC_ACQUIRE)) {
+      fn(*up_dyn_win_.get());
+    }
+  }
+
+  /**
+   * @brief Accessor for comm_
+   *
+   * @return MPI communicator the window was created on
+   */
+  MPI_Comm get_comm() const { return comm_; }
+
   /**
    * @brief Accessor for win_start_
    *
@@ -111,54 +180,128 @@ class WindowInfo {
   void* get_start() const { return win_start_; }
 
   /**
-   * @brief Accessor for win_end_
+   * @brief Check if an address is in the initial segment
    *
-   * @return Raw end pointer
+   * @param[in] Address in raw pointer format
    */
-  void* get_end() const { return win_end_; }
+  bool in_base(const void* addr) const {
+    const char* ptr{reinterpret_cast<const char*>(addr)};
+    return ptr >= win_start_ && ptr < win_end_;
+  }
 
   /**
-   * @brief Setter for object in up_win_
+   * @brief Accessor for the end of the segment which contains an address
    *
-   * @param[in] An MPI Window object
+   * A single MPI operation must not cross it.
+   *
+   * @param[in] Address in raw pointer format
+   *
+   * @return Raw pointer one past the end of the segment
    */
-  void set_win(MPI_Win win) { *up_win_.get() = win; }
+  const char* get_segment_end(const void* addr) const {
+    if (in_base(addr)) {
+      return win_end_;
+    }
+    const Segment* segment{find_segment(addr)};
+    assert(segment);
+    return segment->end;
+  }
 
   /**
-   * @brief Setter for win_start_
+   * @brief Check if an address is in a segment covered by the window
    *
-   * @param[in] Start raw pointer
+   * @param[in] Address in raw pointer format
    */
-  void set_start(void* start) { win_start_ = start; }
+  bool contains(const void* addr) const {
+    return in_base(addr) || find_segment(addr) != nullptr;
+  }
 
   /**
-   * @brief Setter for win_end_
+   * @brief Accessor for the PEs targeted through this window since the
+   * last completion point
    *
-   * @param[in] End raw pointer
+   * @return Pointer to the dirty PE set
    */
-  void set_end(void* end) { win_end_ = end; }
+  DirtyPeSet* get_dirty_pes() { return &dirty_pes_; }
 
   /**
-   * @brief Get offset between address and start of window
+   * @brief Accessor for the staging buffers of small puts
    *
-   * @param[in] Address in raw pointer format
+   * @return Pointer to the aggregator or nullptr if puts are not aggregated
+   */
+  PutAggregator* get_put_aggregator() { return put_aggregator_; }
+
+  /**
+   * @brief Setter for put_aggregator_
+   *
+   * @param[in] Pointer to the aggregator or nullptr
+   */
+  void set_put_aggregator(PutAggregator* aggregator) {
+    put_aggregator_ = aggregator;
+  }
+
+  /**
+   * @brief Setter for object in up_win_
+   *
+   * @param[in] An MPI Window object
+   */
+  void set_win(MPI_Win win) { *up_win_.get() = win; }
+
+  /**
+   * @brief Attaches a segment added by heap growth
    *
-   * @return Difference between dest and window start
+   * Collective over the window's communicator the first time, which
+   * creates the dynamic window; local to this PE afterwards. Every PE
+   * attaches its part of the segment before any PE accesses it, which the
+   * heap growth guarantees by returning only after a barrier.
+   *
+   * @param[in] start local base address of the segment
+   * @param[in] size size in bytes of the segment
+   * @param[in] displacements MPI address of the segment base on each PE
    */
-  MPI_Aint get_offset(const void* dest) {
-    assert(reinterpret_cast<char*>(const_cast<void*>(dest)) >=
-           reinterpret_cast<char*>(win_start_));
-    assert(reinterpret_cast<char*>(const_cast<void*>(dest)) >=
-           reinterpret_cast<char*>(win_start_));
-    assert(reinterpret_cast<char*>(const_cast<void*>(dest)) <
-           reinterpret_cast<char*>(win_end_));
+  void attach(void* start, size_t size,
+              const std::vector<MPI_Aint>& displacements) {
+    int index{num_segments_};
+    assert(index + 1 < MAX_NUM_SEGMENTS);
+
+    if (!up_dyn_win_) {
+      up_dyn_win_ = std::unique_ptr<MPI_Win>(new MPI_Win);
+      MPI_Win_create_dynamic(MPI_INFO_NULL, comm_, up_dyn_win_.get());
+      MPI_Win_lock_all(MPI_MODE_NOCHECK, *up_dyn_win_.get());
+    }
+    MPI_Win_attach(*up_dyn_win_.get(), start, size);
 
-    MPI_Aint dest_disp;
-    MPI_Get_address(dest, &dest_disp);
-    MPI_Aint start_disp;
-    MPI_Get_address(win_start_, &start_disp);
+    Segment& segment{segments_[index]};
+    segment.start = reinterpret_cast<char*>(start);
+    segment.end = segment.start + size;
+    segment.displacements = displacements;
 
-    return MPI_Aint_diff(dest_disp, start_disp);
+    /* Threads driving other contexts look segments up concurrently */
+    __atomic_store_n(&num_segments_, index + 1, __ATOMIC_RELEASE);
+  }
+
+  /**
+   * @brief Get the target displacement of an address
+   *
+   * An address in the initial segment is displaced by its offset from the
+   * segment start, which is the same on every PE. An address in a grown
+   * segment is translated to the same offset in that segment on the
+   * target PE.
+   *
+   * @param[in] Address in raw pointer format
+   * @param[in] pe target PE
+   *
+   * @return Displacement of the symmetric address in get_win(dest)
+   */
+  MPI_Aint get_offset(const void* dest, int pe) const {
+    const char* addr{reinterpret_cast<const char*>(dest)};
+    if (in_base(addr)) {
+      return addr - win_start_;
+    }
+
+    const Segment* segment{find_segment(dest)};
+    assert(segment);
+    return segment->displacements[pe] + (addr - segment->start);
   }
 
  private:
@@ -168,7 +311,7 @@ class WindowInfo {
   MPI_Comm comm_{MPI_COMM_WORLD};
 
   /**
-   * @brief Owning pointer to MPI_Win
+   * @brief Owning pointer to the MPI_Win over the initial segment
    *
    * The pointer is used to track which object is responsible for
    * releasing window resources during class destruction.
@@ -179,14 +322,66 @@ class WindowInfo {
   std::unique_ptr<MPI_Win> up_win_{nullptr};
 
   /**
-   * @brief Raw pointer marking the start of window
+   * @brief Raw pointer marking the start of the initial segment
+   */
+  char* win_start_{nullptr};
+
+  /**
+   * @brief Raw pointer marking the end of the initial segment
+   */
+  char* win_end_{nullptr};
+
+  /**
+   * @brief Owning pointer to the dynamic MPI_Win of the grown segments
+   *
+   * Created by the first attach and published by num_segments_.
+   */
+  std::unique_ptr<MPI_Win> up_dyn_win_{nullptr};
+
+  /**
+   * @brief Local range and per-PE displacements of an attached segment
+   */
+  struct Segment {
+    char* start{nullptr};
+    char* end{nullptr};
+    std::vector<MPI_Aint> displacements{};
+  };
+
+  /**
+   * @brief Finds the grown segment which contains an address
+   *
+   * @return Pointer to the segment or nullptr
+   */
+  const Segment* find_segment(const void* dest) const {
+    const char* addr{reinterpret_cast<const char*>(dest)};
+    int num_segments{__atomic_load_n(&num_segments_, __ATOMIC_ACQUIRE)};
+    for (int i{0}; i < num_segments; i++) {
+      if (addr >= segments_[i].start && addr < segments_[i].end) {
+        return &segments_[i];
+      }
+    }
+    return nullptr;
+  }
+
+  /**
+   * @brief Segments attached to the dynamic window, in heap segment order
+   */
+  std::array<Segment, MAX_NUM_SEGMENTS - 1> segments_{};
+
+  /**
+   * @brief Number of valid entries in segments_
+   */
+  int num_segments_{0};
+
+  /**
+   * @brief PEs targeted through this window since the last completion point
    */
-  void* win_start_{nullptr};
+  DirtyPeSet dirty_pes_{};
 
   /**
-   * @brief Raw pointer marking the end of window
+   * @brief Staging buffers of small puts, owned by the host context pool
    */
-  void* win_end_{nullptr};
+  PutAggregator* put_aggregator_{nullptr};
 };
 
 }  // namespace rocshmem
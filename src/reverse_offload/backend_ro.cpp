@@ -81,7 +81,8 @@ ROBackend::ROBackend(MPI_Comm comm)
 
   host_interface = transport_->host_interface;
 
-  default_host_ctx = std::make_unique<ROHostContext>(this, 0);
+  default_host_ctx =
+      std::make_unique<ROHostContext>(this, ROCSHMEM_CTX_SHARED);
 
   ROCSHMEM_HOST_CTX_DEFAULT.ctx_opaque = default_host_ctx.get();
 
@@ -148,6 +149,9 @@ void ROBackend::create_new_team(Team *parent_team,
                                 TeamInfo *team_info_wrt_parent,
                                 TeamInfo *team_info_wrt_world, int num_pes,
                                 int my_pe_in_new_team, MPI_Comm team_comm,
+                                [[maybe_unused]]
+                                const rocshmem_team_config_t *config,
+                                [[maybe_unused]] long config_mask,  // NOLINT
                                 rocshmem_team_t *new_team) {
   transport_->createNewTeam(this, parent_team, team_info_wrt_parent,
                             team_info_wrt_world, num_pes, my_pe_in_new_team,
@@ -169,6 +173,11 @@ void ROBackend::ctx_destroy(Context *ctx) {
   delete ro_net_host_ctx;
 }
 
+int ROBackend::register_host_callback(rocshmem_host_callback_t fn,
+                                      void *user_data, int flags) {
+  return transport_->host_callbacks->add(fn, user_data, flags);
+}
+
 void ROBackend::reset_backend_stats() {
   auto *bp{backend_proxy.get()};
 
@@ -282,7 +291,24 @@ void ROBackend::initIPC() {
   const auto &heap_bases{heap.get_heap_bases()};
 
   ipcImpl.ipcHostInit(transport_->getMyPe(), heap_bases,
-                      transport_->get_world_comm());
+                      heap.get_base_size(), transport_->get_world_comm());
+}
+
+bool ROBackend::grow_heap(size_t size) {
+  int segment{heap.grow(size)};
+  if (segment < 0) {
+    return false;
+  }
+  auto *segment_table{heap.get_segment_table()};
+  ipcImpl.ipcHostAddSegment(segment_table->get_local_base(segment),
+                            segment_table->get_size(segment));
+
+  auto *window_info{ro_window_proxy_->get()};
+  for (size_t i{0}; i < WindowProxyT::MAX_NUM_WINDOWS; i++) {
+    heap.attach_segment(window_info[i], segment);
+  }
+  host_interface->attach_segment(&heap, segment);
+  return true;
 }
 
 void ROBackend::global_exit(int status) { transport_->global_exit(status); }
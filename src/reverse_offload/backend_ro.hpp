@@ -85,6 +85,8 @@ class ROBackend : public Backend {
   void create_new_team(Team *parent_team, TeamInfo *team_info_wrt_parent,
                        TeamInfo *team_info_wrt_world, int num_pes,
                        int my_pe_in_new_team, MPI_Comm team_comm,
+                       const rocshmem_team_config_t *config,
+                       long config_mask,  // NOLINT(runtime/int)
                        rocshmem_team_t *new_team) override;
 
   /**
@@ -110,6 +112,17 @@ class ROBackend : public Backend {
    */
   void ctx_destroy(Context *ctx) override;
 
+  /**
+   * @copydoc Backend::grow_heap
+   */
+  bool grow_heap(size_t size) override;
+
+  /**
+   * @copydoc Backend::register_host_callback
+   */
+  int register_host_callback(rocshmem_host_callback_t fn, void *user_data,
+                             int flags) override;
+
   /**
    * @brief Free all resources associated with the backend.
    *
@@ -68,6 +68,7 @@ class DefaultBlockHandleProxy {
     block_handle->atomic_ret.atomic_base_ptr = atomic_ret->atomic_base_ptr;
     block_handle->atomic_ret.atomic_counter = 0;
     block_handle->ipc.ipc_bases = ipc_policy->ipc_bases;
+    block_handle->ipc.ipc_segments = ipc_policy->ipc_segments;
     block_handle->ipc.shm_size = ipc_policy->shm_size;
     block_handle->hdp = hdp_policy;
     block_handle->lock = 0;
@@ -105,6 +106,7 @@ class BlockHandleProxy {
       block_handle->atomic_ret.atomic_base_ptr = atomic_ret->atomic_base_ptr;
       block_handle->atomic_ret.atomic_counter = 0;
       block_handle->ipc.ipc_bases = ipc_policy->ipc_bases;
+      block_handle->ipc.ipc_segments = ipc_policy->ipc_segments;
       block_handle->ipc.shm_size = ipc_policy->shm_size;
       block_handle->hdp = hdp_policy;
       block_handle->lock = 0;
@@ -45,6 +45,9 @@ enum ro_net_cmds {
   RO_NET_TEAM_BROADCAST,
   RO_NET_ALLTOALL,
   RO_NET_FCOLLECT,
+  RO_NET_IPUT,
+  RO_NET_IGET,
+  RO_NET_HOST_CALLBACK,
 };
 
 enum ro_net_types {
@@ -52,6 +52,7 @@ __host__ ROContext::ROContext(Backend *b, size_t block_id)
   ro_net_win_id = block_id % backend->ro_window_proxy_->MAX_NUM_WINDOWS;
 
   ipcImpl_.ipc_bases = b->ipcImpl.ipc_bases;
+  ipcImpl_.ipc_segments = b->ipcImpl.ipc_segments;
   ipcImpl_.shm_size = b->ipcImpl.shm_size;
 }
 
@@ -59,9 +60,7 @@ __device__ void ROContext::putmem(void *dest, const void *source, size_t nelems,
                                   int pe) {
   if (ipcImpl_.isIpcAvailable(my_pe, pe)) {
     int local_pe = pe % ipcImpl_.shm_size;
-    uint64_t L_offset =
-        reinterpret_cast<char *>(dest) - ipcImpl_.ipc_bases[my_pe];
-    ipcImpl_.ipcCopy(ipcImpl_.ipc_bases[local_pe] + L_offset,
+    ipcImpl_.ipcCopy(ipcImpl_.ipcTranslate(dest, local_pe),
                      const_cast<void *>(source), nelems);
   } else {
     bool must_send_message = wf_coal_.coalesce(pe, source, dest, &nelems);
@@ -78,10 +77,7 @@ __device__ void ROContext::getmem(void *dest, const void *source, size_t nelems,
                                   int pe) {
   if (ipcImpl_.isIpcAvailable(my_pe, pe)) {
     int local_pe = pe % ipcImpl_.shm_size;
-    const char *src_typed = reinterpret_cast<const char *>(source);
-    uint64_t L_offset =
-        const_cast<char *>(src_typed) - ipcImpl_.ipc_bases[my_pe];
-    ipcImpl_.ipcCopy(dest, ipcImpl_.ipc_bases[local_pe] + L_offset, nelems);
+    ipcImpl_.ipcCopy(dest, ipcImpl_.ipcTranslate(source, local_pe), nelems);
   } else {
     bool must_send_message = wf_coal_.coalesce(pe, source, dest, &nelems);
     if (!must_send_message) {
@@ -97,9 +93,7 @@ __device__ void ROContext::putmem_nbi(void *dest, const void *source,
                                       size_t nelems, int pe) {
   if (ipcImpl_.isIpcAvailable(my_pe, pe)) {
     int local_pe = pe % ipcImpl_.shm_size;
-    uint64_t L_offset =
-        reinterpret_cast<char *>(dest) - ipcImpl_.ipc_bases[my_pe];
-    ipcImpl_.ipcCopy(ipcImpl_.ipc_bases[local_pe] + L_offset,
+    ipcImpl_.ipcCopy(ipcImpl_.ipcTranslate(dest, local_pe),
                      const_cast<void *>(source), nelems);
   } else {
     bool must_send_message = wf_coal_.coalesce(pe, source, dest, &nelems);
@@ -116,10 +110,7 @@ __device__ void ROContext::getmem_nbi(void *dest, const void *source,
                                       size_t nelems, int pe) {
   if (ipcImpl_.isIpcAvailable(my_pe, pe)) {
     int local_pe = pe % ipcImpl_.shm_size;
-    const char *src_typed = reinterpret_cast<const char *>(source);
-    uint64_t L_offset =
-        const_cast<char *>(src_typed) - ipcImpl_.ipc_bases[my_pe];
-    ipcImpl_.ipcCopy(dest, ipcImpl_.ipc_bases[local_pe] + L_offset, nelems);
+    ipcImpl_.ipcCopy(dest, ipcImpl_.ipcTranslate(source, local_pe), nelems);
   } else {
     bool must_send_message = wf_coal_.coalesce(pe, source, dest, &nelems);
     if (!must_send_message) {
@@ -150,14 +141,22 @@ __device__ void ROContext::quiet() {
 __device__ void *ROContext::shmem_ptr(const void *dest, int pe) {
   void *ret = nullptr;
   if (ipcImpl_.isIpcAvailable(my_pe, pe)) {
-    void *dst = const_cast<void *>(dest);
-    uint64_t L_offset =
-        reinterpret_cast<char *>(dst) - ipcImpl_.ipc_bases[my_pe];
-    ret = ipcImpl_.ipc_bases[pe] + L_offset;
+    int local_pe = pe % ipcImpl_.shm_size;
+    ret = ipcImpl_.ipcTranslate(dest, local_pe);
   }
   return ret;
 }
 
+__device__ void ROContext::host_callback(int id, const uint64_t *args,
+                                         int nargs, uint64_t *sig_addr,
+                                         uint64_t signal) {
+  nargs = min(max(nargs, 0), ROCSHMEM_HOST_CALLBACK_MAX_ARGS);
+  build_queue_element(RO_NET_HOST_CALLBACK, sig_addr, nullptr, nargs, id, 0, 0,
+                      0, nullptr, nullptr, (MPI_Comm)NULL, ro_net_win_id,
+                      block_handle, false, ROCSHMEM_SUM, RO_NET_INT, 0, 0, 0,
+                      args, signal);
+}
+
 __device__ void ROContext::barrier_all() {
   if (is_thread_zero_in_block()) {
     build_queue_element(RO_NET_BARRIER_ALL, nullptr, nullptr, 0, 0, 0, 0, 0,
@@ -210,9 +209,7 @@ __device__ void ROContext::putmem_wg(void *dest, const void *source,
                                      size_t nelems, int pe) {
   if (ipcImpl_.isIpcAvailable(my_pe, pe)) {
     int local_pe = pe % ipcImpl_.shm_size;
-    uint64_t L_offset =
-        reinterpret_cast<char *>(dest) - ipcImpl_.ipc_bases[my_pe];
-    ipcImpl_.ipcCopy_wg(ipcImpl_.ipc_bases[local_pe] + L_offset,
+    ipcImpl_.ipcCopy_wg(ipcImpl_.ipcTranslate(dest, local_pe),
                         const_cast<void *>(source), nelems);
   } else {
     if (is_thread_zero_in_block()) {
@@ -228,10 +225,7 @@ __device__ void ROContext::getmem_wg(void *dest, const void *source,
                                      size_t nelems, int pe) {
   if (ipcImpl_.isIpcAvailable(my_pe, pe)) {
     int local_pe = pe % ipcImpl_.shm_size;
-    const char *src_typed = reinterpret_cast<const char *>(source);
-    uint64_t L_offset =
-        const_cast<char *>(src_typed) - ipcImpl_.ipc_bases[my_pe];
-    ipcImpl_.ipcCopy_wg(dest, ipcImpl_.ipc_bases[local_pe] + L_offset, nelems);
+    ipcImpl_.ipcCopy_wg(dest, ipcImpl_.ipcTranslate(source, local_pe), nelems);
   } else {
     if (is_thread_zero_in_block()) {
       build_queue_element(RO_NET_GET, dest, const_cast<void *>(source), nelems,
@@ -246,9 +240,7 @@ __device__ void ROContext::putmem_nbi_wg(void *dest, const void *source,
                                          size_t nelems, int pe) {
   if (ipcImpl_.isIpcAvailable(my_pe, pe)) {
     int local_pe = pe % ipcImpl_.shm_size;
-    uint64_t L_offset =
-        reinterpret_cast<char *>(dest) - ipcImpl_.ipc_bases[my_pe];
-    ipcImpl_.ipcCopy_wg(ipcImpl_.ipc_bases[local_pe] + L_offset,
+    ipcImpl_.ipcCopy_wg(ipcImpl_.ipcTranslate(dest, local_pe),
                         const_cast<void *>(source), nelems);
   } else {
     if (is_thread_zero_in_block()) {
@@ -264,10 +256,7 @@ __device__ void ROContext::getmem_nbi_wg(void *dest, const void *source,
                                          size_t nelems, int pe) {
   if (ipcImpl_.isIpcAvailable(my_pe, pe)) {
     int local_pe = pe % ipcImpl_.shm_size;
-    const char *src_typed = reinterpret_cast<const char *>(source);
-    uint64_t L_offset =
-        const_cast<char *>(src_typed) - ipcImpl_.ipc_bases[my_pe];
-    ipcImpl_.ipcCopy_wg(dest, ipcImpl_.ipc_bases[local_pe] + L_offset, nelems);
+    ipcImpl_.ipcCopy_wg(dest, ipcImpl_.ipcTranslate(source, local_pe), nelems);
   } else {
     if (is_thread_zero_in_block()) {
       build_queue_element(RO_NET_GET_NBI, dest, const_cast<void *>(source),
@@ -282,9 +271,7 @@ __device__ void ROContext::putmem_wave(void *dest, const void *source,
                                        size_t nelems, int pe) {
   if (ipcImpl_.isIpcAvailable(my_pe, pe)) {
     int local_pe = pe % ipcImpl_.shm_size;
-    uint64_t L_offset =
-        reinterpret_cast<char *>(dest) - ipcImpl_.ipc_bases[my_pe];
-    ipcImpl_.ipcCopy_wave(ipcImpl_.ipc_bases[local_pe] + L_offset,
+    ipcImpl_.ipcCopy_wave(ipcImpl_.ipcTranslate(dest, local_pe),
                           const_cast<void *>(source), nelems);
   } else {
     if (is_thread_zero_in_wave()) {
@@ -299,10 +286,7 @@ __device__ void ROContext::getmem_wave(void *dest, const void *source,
                                        size_t nelems, int pe) {
   if (ipcImpl_.isIpcAvailable(my_pe, pe)) {
     int local_pe = pe % ipcImpl_.shm_size;
-    const char *src_typed = reinterpret_cast<const char *>(source);
-    uint64_t L_offset =
-        const_cast<char *>(src_typed) - ipcImpl_.ipc_bases[my_pe];
-    ipcImpl_.ipcCopy_wave(dest, ipcImpl_.ipc_bases[local_pe] + L_offset,
+    ipcImpl_.ipcCopy_wave(dest, ipcImpl_.ipcTranslate(source, local_pe),
                           nelems);
   } else {
     if (is_thread_zero_in_wave()) {
@@ -317,9 +301,7 @@ __device__ void ROContext::putmem_nbi_wave(void *dest, const void *source,
                                            size_t nelems, int pe) {
   if (ipcImpl_.isIpcAvailable(my_pe, pe)) {
     int local_pe = pe % ipcImpl_.shm_size;
-    uint64_t L_offset =
-        reinterpret_cast<char *>(dest) - ipcImpl_.ipc_bases[my_pe];
-    ipcImpl_.ipcCopy_wave(ipcImpl_.ipc_bases[local_pe] + L_offset,
+    ipcImpl_.ipcCopy_wave(ipcImpl_.ipcTranslate(dest, local_pe),
                           const_cast<void *>(source), nelems);
   } else {
     if (is_thread_zero_in_wave()) {
@@ -334,10 +316,7 @@ __device__ void ROContext::getmem_nbi_wave(void *dest, const void *source,
                                            size_t nelems, int pe) {
   if (ipcImpl_.isIpcAvailable(my_pe, pe)) {
     int local_pe = pe % ipcImpl_.shm_size;
-    const char *src_typed = reinterpret_cast<const char *>(source);
-    uint64_t L_offset =
-        const_cast<char *>(src_typed) - ipcImpl_.ipc_bases[my_pe];
-    ipcImpl_.ipcCopy_wave(dest, ipcImpl_.ipc_bases[local_pe] + L_offset,
+    ipcImpl_.ipcCopy_wave(dest, ipcImpl_.ipcTranslate(source, local_pe),
                           nelems);
   } else {
     if (is_thread_zero_in_wave()) {
@@ -472,7 +451,9 @@ __device__ void build_queue_element(
     ro_net_cmds type, void *dst, void *src, size_t size, int pe,
     int logPE_stride, int PE_size, int PE_root, void *pWrk, long *pSync,
     MPI_Comm team_comm, int ro_net_win_id, BlockHandle *handle,
-    bool blocking, ROCSHMEM_OP op, ro_net_types datatype) {
+    bool blocking, ROCSHMEM_OP op, ro_net_types datatype, int elem_size,
+    ptrdiff_t dst_stride, ptrdiff_t src_stride, const uint64_t *callback_args,
+    uint64_t signal) {
   auto write_slot{next_write_slot(handle)};
   auto queue_element = &handle->queue[write_slot];
 
@@ -537,6 +518,17 @@ __device__ void build_queue_element(
   if (type == RO_NET_SYNC) {
     queue_element->team_comm = team_comm;
   }
+  if (type == RO_NET_IPUT || type == RO_NET_IGET) {
+    queue_element->ol3.strided.elem_size = elem_size;
+    queue_element->ol3.strided.dst_stride = dst_stride;
+    queue_element->ol3.strided.src_stride = src_stride;
+  }
+  if (type == RO_NET_HOST_CALLBACK) {
+    for (size_t i{0}; i < size; i++) {
+      queue_element->ol3.callback_args[i] = callback_args[i];
+    }
+    queue_element->ol2.atomic_cond = signal;
+  }
 
   // Make sure queue element data is visible to CPU
   __threadfence();
@@ -35,7 +35,9 @@ __device__ void build_queue_element(
     int logPE_stride, int PE_size, int PE_root, void *pWrk, long *pSync,
     MPI_Comm team_comm, int ro_net_win_id, BlockHandle *handle,
     bool blocking, ROCSHMEM_OP op = ROCSHMEM_SUM,
-    ro_net_types datatype = RO_NET_INT);
+    ro_net_types datatype = RO_NET_INT, int elem_size = 0,
+    ptrdiff_t dst_stride = 0, ptrdiff_t src_stride = 0,
+    const uint64_t *callback_args = nullptr, uint64_t signal = 0);
 
 class ROContext : public Context {
  public:
@@ -63,6 +65,9 @@ class ROContext : public Context {
 
   __device__ void *shmem_ptr(const void *dest, int pe);
 
+  __device__ void host_callback(int id, const uint64_t *args, int nargs,
+                                uint64_t *sig_addr, uint64_t signal);
+
   __device__ void barrier_all();
 
   __device__ void sync_all();
@@ -96,6 +101,14 @@ class ROContext : public Context {
   template <typename T>
   __device__ void get_nbi(T *dest, const T *source, size_t nelems, int pe);
 
+  template <typename T>
+  __device__ void iput(T *dest, const T *source, ptrdiff_t dst, ptrdiff_t sst,
+                       size_t nelems, int pe);
+
+  template <typename T>
+  __device__ void iget(T *dest, const T *source, ptrdiff_t dst, ptrdiff_t sst,
+                       size_t nelems, int pe);
+
   template <typename T>
   __device__ T amo_fetch_cas(void *dst, T value, T cond, int pe);
 
@@ -181,6 +194,22 @@ class ROContext : public Context {
   __device__ void fcollect_gcen2(rocshmem_team_t team, T *dest,
                                  const T *source, int nelems);
 
+  template <typename T, ROCSHMEM_OP Op>
+  __device__ int reduce_grid(rocshmem_team_t team, T *dest, const T *source,
+                             int nreduce);
+
+  template <typename T>
+  __device__ void broadcast_grid(rocshmem_team_t team, T *dest,
+                                 const T *source, int nelems, int pe_root);
+
+  template <typename T>
+  __device__ void alltoall_grid(rocshmem_team_t team, T *dest,
+                                const T *source, int nelems);
+
+  template <typename T>
+  __device__ void fcollect_grid(rocshmem_team_t team, T *dest,
+                                const T *source, int nelems);
+
   __device__ void putmem_wg(void *dest, const void *source, size_t nelems,
                             int pe);
 
@@ -229,6 +258,14 @@ class ROContext : public Context {
   template <typename T>
   __device__ void get_nbi_wave(T *dest, const T *source, size_t nelems, int pe);
 
+  template <typename T>
+  __device__ void iput_wave(T *dest, const T *source, ptrdiff_t dst,
+                            ptrdiff_t sst, size_t nelems, int pe);
+
+  template <typename T>
+  __device__ void iget_wave(T *dest, const T *source, ptrdiff_t dst,
+                            ptrdiff_t sst, size_t nelems, int pe);
+
  private:
   __device__ uint64_t *get_unused_atomic();
 
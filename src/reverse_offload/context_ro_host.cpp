@@ -38,7 +38,7 @@ __host__ ROHostContext::ROHostContext(Backend *backend, long options)
 
   host_interface = b->host_interface;
 
-  context_window_info = host_interface->acquire_window_context();
+  context_window_info = host_interface->acquire_window_context(options);
 }
 
 __host__ ROHostContext::~ROHostContext() {
@@ -59,6 +59,13 @@ __host__ void ROHostContext::getmem_nbi(void *dest, const void *source,
   host_interface->getmem_nbi(dest, source, nelems, pe, context_window_info);
 }
 
+__host__ void ROHostContext::batch(const rocshmem_batch_op_t *ops,
+                                   size_t nops) {
+  DPRINTF("Function: ro_net_host_batch\n");
+
+  host_interface->batch(ops, nops, context_window_info);
+}
+
 __host__ void ROHostContext::putmem(void *dest, const void *source,
                                     size_t nelems, int pe) {
   DPRINTF("Function: ro_net_host_putmem\n");
@@ -99,4 +106,18 @@ __host__ void ROHostContext::barrier_all() {
   host_interface->barrier_for_sync();
 }
 
+__host__ void ROHostContext::barrier_all_nbi(rocshmem_request_t *request) {
+  DPRINTF("Function: ro_net_host_barrier_all_nbi\n");
+
+  host_interface->barrier_all_nbi(context_window_info, request);
+}
+
+__host__ int ROHostContext::test_request(rocshmem_request_t *request) {
+  return HostInterface::test_request(request);
+}
+
+__host__ void ROHostContext::wait_request(rocshmem_request_t *request) {
+  HostInterface::wait_request(request);
+}
+
 }  // namespace rocshmem
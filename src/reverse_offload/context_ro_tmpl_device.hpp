@@ -159,8 +159,8 @@ __device__ void ROContext::put_nbi(T *dest, const T *source, size_t nelems,
 template <typename T>
 __device__ void ROContext::p(T *dest, T value, int pe) {
   if (ipcImpl_.isIpcAvailable(my_pe, pe)) {
-    long L_offset{reinterpret_cast<char *>(dest) - ipcImpl_.ipc_bases[my_pe]};
-    ipcImpl_.ipcCopy(ipcImpl_.ipc_bases[pe] + L_offset,
+    int local_pe = pe % ipcImpl_.shm_size;
+    ipcImpl_.ipcCopy(ipcImpl_.ipcTranslate(dest, local_pe),
                      reinterpret_cast<void *>(&value), sizeof(T));
   } else {
     build_queue_element(RO_NET_P, dest, &value, sizeof(T), pe, 0, 0, 0, nullptr,
@@ -172,10 +172,10 @@ __device__ void ROContext::p(T *dest, T value, int pe) {
 template <typename T>
 __device__ T ROContext::g(const T *source, int pe) {
   if (ipcImpl_.isIpcAvailable(my_pe, pe)) {
-    const char *src_typed{reinterpret_cast<const char *>(source)};
-    long L_offset{const_cast<char *>(src_typed) - ipcImpl_.ipc_bases[my_pe]};
+    int local_pe = pe % ipcImpl_.shm_size;
     T dest;
-    ipcImpl_.ipcCopy(&dest, ipcImpl_.ipc_bases[pe] + L_offset, sizeof(T));
+    ipcImpl_.ipcCopy(&dest, ipcImpl_.ipcTranslate(source, local_pe),
+                     sizeof(T));
     return dest;
   } else {
     int thread_id{get_flat_block_id()};
@@ -203,6 +203,42 @@ __device__ void ROContext::get_nbi(T *dest, const T *source, size_t nelems,
   getmem_nbi(dest, source, size, pe);
 }
 
+template <typename T>
+__device__ void ROContext::iput(T *dest, const T *source, ptrdiff_t dst,
+                                ptrdiff_t sst, size_t nelems, int pe) {
+  if (ipcImpl_.isIpcAvailable(my_pe, pe)) {
+    int local_pe = pe % ipcImpl_.shm_size;
+    T *remote_dest{
+        reinterpret_cast<T *>(ipcImpl_.ipcTranslate(dest, local_pe))};
+    for (size_t i{0}; i < nelems; i++) {
+      remote_dest[i * dst] = source[i * sst];
+    }
+  } else {
+    build_queue_element(RO_NET_IPUT, dest, const_cast<T *>(source), nelems, pe,
+                        0, 0, 0, nullptr, nullptr, (MPI_Comm)NULL,
+                        ro_net_win_id, block_handle, true, ROCSHMEM_SUM,
+                        RO_NET_CHAR, sizeof(T), dst, sst);
+  }
+}
+
+template <typename T>
+__device__ void ROContext::iget(T *dest, const T *source, ptrdiff_t dst,
+                                ptrdiff_t sst, size_t nelems, int pe) {
+  if (ipcImpl_.isIpcAvailable(my_pe, pe)) {
+    int local_pe = pe % ipcImpl_.shm_size;
+    const T *remote_source{
+        reinterpret_cast<T *>(ipcImpl_.ipcTranslate(source, local_pe))};
+    for (size_t i{0}; i < nelems; i++) {
+      dest[i * dst] = remote_source[i * sst];
+    }
+  } else {
+    build_queue_element(RO_NET_IGET, dest, const_cast<T *>(source), nelems, pe,
+                        0, 0, 0, nullptr, nullptr, (MPI_Comm)NULL,
+                        ro_net_win_id, block_handle, true, ROCSHMEM_SUM,
+                        RO_NET_CHAR, sizeof(T), dst, sst);
+  }
+}
+
 template <typename T>
 __device__ T ROContext::amo_fetch_cas(void *dst, T value, T cond, int pe) {
   auto source{get_unused_atomic()};
@@ -432,6 +468,72 @@ __device__ void ROContext::get_nbi_wave(T *dest, const T *source, size_t nelems,
   getmem_nbi_wave(dest, source, size, pe);
 }
 
+template <typename T>
+__device__ void ROContext::iput_wave(T *dest, const T *source, ptrdiff_t dst,
+                                     ptrdiff_t sst, size_t nelems, int pe) {
+  if (ipcImpl_.isIpcAvailable(my_pe, pe)) {
+    int local_pe = pe % ipcImpl_.shm_size;
+    T *remote_dest{
+        reinterpret_cast<T *>(ipcImpl_.ipcTranslate(dest, local_pe))};
+    size_t wave_tid = get_flat_block_id() % WF_SIZE;
+    size_t wave_size = wave_SZ();
+    for (size_t i{wave_tid}; i < nelems; i += wave_size) {
+      remote_dest[i * dst] = source[i * sst];
+    }
+  } else {
+    if (is_thread_zero_in_wave()) {
+      iput(dest, source, dst, sst, nelems, pe);
+    }
+  }
+}
+
+template <typename T>
+__device__ void ROContext::iget_wave(T *dest, const T *source, ptrdiff_t dst,
+                                     ptrdiff_t sst, size_t nelems, int pe) {
+  if (ipcImpl_.isIpcAvailable(my_pe, pe)) {
+    int local_pe = pe % ipcImpl_.shm_size;
+    const T *remote_source{
+        reinterpret_cast<T *>(ipcImpl_.ipcTranslate(source, local_pe))};
+    size_t wave_tid = get_flat_block_id() % WF_SIZE;
+    size_t wave_size = wave_SZ();
+    for (size_t i{wave_tid}; i < nelems; i += wave_size) {
+      dest[i * dst] = remote_source[i * sst];
+    }
+  } else {
+    if (is_thread_zero_in_wave()) {
+      iget(dest, source, dst, sst, nelems, pe);
+    }
+  }
+}
+
+// Grid collectives are only implemented by the IPC conduit
+template <typename T, ROCSHMEM_OP Op>
+__device__ int ROContext::reduce_grid(rocshmem_team_t team, T *dest,
+                                      const T *source, int nreduce) {
+  GPU_DPRINTF("Grid collectives are not supported by reverse offload.\n");
+  assert(false);
+  return ROCSHMEM_ERROR;
+}
+
+template <typename T>
+__device__ void ROContext::broadcast_grid(rocshmem_team_t team, T *dest,
+                                          const T *source, int nelems,
+                                          int pe_root) {
+  assert(false);
+}
+
+template <typename T>
+__device__ void ROContext::alltoall_grid(rocshmem_team_t team, T *dest,
+                                         const T *source, int nelems) {
+  assert(false);
+}
+
+template <typename T>
+__device__ void ROContext::fcollect_grid(rocshmem_team_t team, T *dest,
+                                         const T *source, int nelems) {
+  assert(false);
+}
+
 }  // namespace rocshmem
 
 #endif  // LIBRARY_SRC_REVERSE_OFFLOAD_RO_NET_GPU_TEMPLATES_HPP_
@@ -73,6 +73,24 @@ __host__ void ROHostContext::get_nbi(T *dest, const T *source, size_t nelems,
   host_interface->get_nbi<T>(dest, source, nelems, pe, context_window_info);
 }
 
+template <typename T>
+__host__ void ROHostContext::iput(T *dest, const T *source, ptrdiff_t dst,
+                                  ptrdiff_t sst, size_t nelems, int pe) {
+  DPRINTF("Function: ro_net_host_iput\n");
+
+  host_interface->iput<T>(dest, source, dst, sst, nelems, pe,
+                          context_window_info);
+}
+
+template <typename T>
+__host__ void ROHostContext::iget(T *dest, const T *source, ptrdiff_t dst,
+                                  ptrdiff_t sst, size_t nelems, int pe) {
+  DPRINTF("Function: ro_net_host_iget\n");
+
+  host_interface->iget<T>(dest, source, dst, sst, nelems, pe,
+                          context_window_info);
+}
+
 template <typename T>
 __host__ void ROHostContext::amo_add(void *dst, T value, int pe) {
   DPRINTF("Function: ro_net_host_amo_add\n");
@@ -140,6 +158,58 @@ __host__ void ROHostContext::to_all(rocshmem_team_t team, T *dest,
   host_interface->to_all<T, Op>(team, dest, source, nreduce);
 }
 
+template <typename T>
+__host__ void ROHostContext::broadcast_nbi(rocshmem_team_t team, T *dest,
+                                           const T *source, int nelems,
+                                           int pe_root,
+                                           rocshmem_request_t *request) {
+  DPRINTF("Function: Team-based ro_net_host_broadcast_nbi\n");
+
+  host_interface->broadcast_nbi<T>(team, dest, source, nelems, pe_root,
+                                   request);
+}
+
+template <typename T, ROCSHMEM_OP Op>
+__host__ int ROHostContext::reduce_nbi(rocshmem_team_t team, T *dest,
+                                       const T *source, int nreduce,
+                                       rocshmem_request_t *request) {
+  DPRINTF("Function: Team-based ro_net_host_reduce_nbi\n");
+
+  return host_interface->reduce_nbi<T, Op>(team, dest, source, nreduce,
+                                            request);
+}
+
+template <typename T>
+__host__ void ROHostContext::alltoall(rocshmem_team_t team, T *dest,
+                                      const T *source, int nelems) {
+  DPRINTF("Function: Team-based ro_net_host_alltoall\n");
+
+  host_interface->alltoall<T>(team, dest, source, nelems,
+                              context_window_info);
+}
+
+template <typename T>
+__host__ void ROHostContext::alltoallv(rocshmem_team_t team, T *dest,
+                                       const int *dest_counts,
+                                       const int *dest_displs,
+                                       const T *source,
+                                       const int *source_counts,
+                                       const int *source_displs) {
+  DPRINTF("Function: Team-based ro_net_host_alltoallv\n");
+
+  host_interface->alltoallv<T>(team, dest, dest_counts, dest_displs, source,
+                               source_counts, source_displs);
+}
+
+template <typename T>
+__host__ void ROHostContext::fcollect(rocshmem_team_t team, T *dest,
+                                      const T *source, int nelems) {
+  DPRINTF("Function: Team-based ro_net_host_fcollect\n");
+
+  host_interface->fcollect<T>(team, dest, source, nelems,
+                              context_window_info);
+}
+
 template <typename T>
 __host__ void ROHostContext::wait_until(T *ivars, int cmp, T val) {
   host_interface->wait_until<T>(ivars, cmp, val, context_window_info);
@@ -0,0 +1,119 @@
+/******************************************************************************
+ * Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+
+#include "host_callbacks.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <utility>
+
+namespace rocshmem {
+
+HostCallbacks::HostCallbacks(SignalFn signal_fn, int num_workers)
+    : signal_fn_{std::move(signal_fn)},
+      num_workers_{std::max(num_workers, 1)} {}
+
+HostCallbacks::~HostCallbacks() { stop(); }
+
+int HostCallbacks::add(rocshmem_host_callback_t fn, void *user_data,
+                       int flags) {
+  std::lock_guard<std::mutex> lock(register_mutex_);
+
+  int id{num_entries_.load(std::memory_order_relaxed)};
+  if (id == MAX_CALLBACKS) {
+    return -1;
+  }
+
+  if (flags == ROCSHMEM_HOST_CALLBACK_HANDOFF && workers_.empty()) {
+    for (int i{0}; i < num_workers_; i++) {
+      workers_.emplace_back(&HostCallbacks::worker, this);
+    }
+  }
+
+  entries_[id] = {fn, user_data, flags};
+  num_entries_.store(id + 1, std::memory_order_release);
+  return id;
+}
+
+void HostCallbacks::run(int id, const uint64_t *args, int nargs,
+                        uint64_t *sig_addr, uint64_t signal, int win_id) {
+  Task task{};
+  task.id = id;
+  task.nargs = std::clamp(nargs, 0, ROCSHMEM_HOST_CALLBACK_MAX_ARGS);
+  std::copy(args, args + task.nargs, task.args);
+  task.sig_addr = sig_addr;
+  task.signal = signal;
+  task.win_id = win_id;
+
+  bool known{id >= 0 && id < num_entries_.load(std::memory_order_acquire)};
+  if (known && entries_[id].flags == ROCSHMEM_HOST_CALLBACK_HANDOFF) {
+    {
+      std::lock_guard<std::mutex> lock(task_mutex_);
+      tasks_.push_back(task);
+    }
+    task_cv_.notify_one();
+    return;
+  }
+  execute(task);
+}
+
+void HostCallbacks::execute(const Task &task) {
+  if (task.id >= 0 && task.id < num_entries_.load(std::memory_order_acquire)) {
+    const Entry &entry{entries_[task.id]};
+    entry.fn(task.args, task.nargs, entry.user_data);
+  } else {
+    fprintf(stderr, "rocSHMEM: unknown host callback id %d\n", task.id);
+  }
+
+  if (task.sig_addr) {
+    signal_fn_(task.sig_addr, task.signal, task.win_id);
+  }
+}
+
+void HostCallbacks::worker() {
+  std::unique_lock<std::mutex> lock(task_mutex_);
+  while (true) {
+    task_cv_.wait(lock, [this] { return stopping_ || !tasks_.empty(); });
+    if (tasks_.empty()) {
+      return;
+    }
+    Task task{tasks_.front()};
+    tasks_.pop_front();
+    lock.unlock();
+    execute(task);
+    lock.lock();
+  }
+}
+
+void HostCallbacks::stop() {
+  {
+    std::lock_guard<std::mutex> lock(task_mutex_);
+    stopping_ = true;
+  }
+  task_cv_.notify_all();
+  for (auto &worker : workers_) {
+    worker.join();
+  }
+  workers_.clear();
+}
+
+}  // namespace rocshmem
@@ -0,0 +1,142 @@
+/******************************************************************************
+ * Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+
+#ifndef LIBRARY_SRC_REVERSE_OFFLOAD_HOST_CALLBACKS_HPP_
+#define LIBRARY_SRC_REVERSE_OFFLOAD_HOST_CALLBACKS_HPP_
+
+#include <array>
+#include <atomic>
+#include <condition_variable>  // NOLINT
+#include <deque>
+#include <functional>
+#include <mutex>  // NOLINT
+#include <thread>  // NOLINT
+#include <vector>
+
+#include "rocshmem/rocshmem.hpp"
+
+namespace rocshmem {
+
+/**
+ * @brief Host functions which device threads trigger with
+ * RO_NET_HOST_CALLBACK requests.
+ *
+ * Ids index a fixed table which is only appended to, so the proxy thread
+ * looks callbacks up without taking a lock. Callbacks registered with
+ * ROCSHMEM_HOST_CALLBACK_HANDOFF run on a worker pool which is started by
+ * the first such registration.
+ */
+class HostCallbacks {
+ public:
+  /**
+   * @brief Delivers the completion signal of a request through the window
+   * of the context which issued it.
+   */
+  using SignalFn =
+      std::function<void(uint64_t *sig_addr, uint64_t signal, int win_id)>;
+
+  /**
+   * @brief Largest number of callbacks which can be registered.
+   */
+  static constexpr int MAX_CALLBACKS{64};
+
+  /**
+   * @param[in] signal_fn Called after a callback returns if the request
+   * carries a signal address.
+   * @param[in] num_workers Size of the handoff worker pool.
+   */
+  HostCallbacks(SignalFn signal_fn, int num_workers);
+
+  ~HostCallbacks();
+
+  /**
+   * @brief Registers a callback.
+   *
+   * @return Callback id, or -1 if the table is full.
+   */
+  int add(rocshmem_host_callback_t fn, void *user_data, int flags);
+
+  /**
+   * @brief Runs a request on the calling thread or hands it off to the
+   * worker pool, depending on how the callback was registered.
+   *
+   * Requests naming an unknown id are reported and only signaled, so the
+   * device never waits forever on them.
+   *
+   * @param[in] win_id Window of the issuing context, passed to the signal
+   * function.
+   */
+  void run(int id, const uint64_t *args, int nargs, uint64_t *sig_addr,
+           uint64_t signal, int win_id);
+
+  /**
+   * @brief Completes the handed off requests and joins the worker pool.
+   */
+  void stop();
+
+ private:
+  struct Entry {
+    rocshmem_host_callback_t fn{nullptr};
+    void *user_data{nullptr};
+    int flags{ROCSHMEM_HOST_CALLBACK_PROXY};
+  };
+
+  struct Task {
+    int id{-1};
+    int nargs{0};
+    uint64_t args[ROCSHMEM_HOST_CALLBACK_MAX_ARGS]{};
+    uint64_t *sig_addr{nullptr};
+    uint64_t signal{0};
+    int win_id{0};
+  };
+
+  void execute(const Task &task);
+
+  void worker();
+
+  std::array<Entry, MAX_CALLBACKS> entries_{};
+
+  /**
+   * @brief Published after the entry it counts has been written.
+   */
+  std::atomic<int> num_entries_{0};
+
+  std::mutex register_mutex_{};
+
+  SignalFn signal_fn_{};
+
+  int num_workers_{1};
+
+  std::vector<std::thread> workers_{};
+
+  std::deque<Task> tasks_{};
+
+  std::mutex task_mutex_{};
+
+  std::condition_variable task_cv_{};
+
+  bool stopping_{false};
+};
+
+}  // namespace rocshmem
+
+#endif  // LIBRARY_SRC_REVERSE_OFFLOAD_HOST_CALLBACKS_HPP_
@@ -137,6 +137,30 @@ void MPITransport::submitRequestsToMPI() {
               next_element.dst, next_element.src, next_element.ol1.size,
               next_element.PE);
       break;
+    case RO_NET_IPUT: {
+      const auto &strided{next_element.ol3.strided};
+      iputMem(next_element.dst, next_element.src, next_element.ol1.size,
+              strided.elem_size, strided.dst_stride, strided.src_stride,
+              next_element.PE, next_element.ro_net_win_id, queue_idx,
+              next_element.threadId, true);
+      DPRINTF("Received IPUT dst %p src %p nelems %lu dst_stride %td "
+              "src_stride %td pe %d\n",
+              next_element.dst, next_element.src, next_element.ol1.size,
+              strided.dst_stride, strided.src_stride, next_element.PE);
+      break;
+    }
+    case RO_NET_IGET: {
+      const auto &strided{next_element.ol3.strided};
+      igetMem(next_element.dst, next_element.src, next_element.ol1.size,
+              strided.elem_size, strided.dst_stride, strided.src_stride,
+              next_element.PE, next_element.ro_net_win_id, queue_idx,
+              next_element.threadId, true);
+      DPRINTF("Received IGET dst %p src %p nelems %lu dst_stride %td "
+              "src_stride %td pe %d\n",
+              next_element.dst, next_element.src, next_element.ol1.size,
+              strided.dst_stride, strided.src_stride, next_element.PE);
+      break;
+    }
     case RO_NET_AMO_FOP:
       amoFOP(next_element.dst, next_element.src,
              const_cast<unsigned long long *>(&next_element.ol1.atomic_value),
@@ -231,6 +255,15 @@ void MPITransport::submitRequestsToMPI() {
               next_element.dst, next_element.src, next_element.ol1.size,
               next_element.team_comm);
       break;
+    case RO_NET_HOST_CALLBACK:
+      host_callbacks->run(next_element.PE, next_element.ol3.callback_args,
+                          next_element.ol1.size,
+                          static_cast<uint64_t *>(next_element.dst),
+                          next_element.ol2.atomic_cond,
+                          next_element.ro_net_win_id);
+      DPRINTF("Received HOST_CALLBACK id %d nargs %lu sig_addr %p\n",
+              next_element.PE, next_element.ol1.size, next_element.dst);
+      break;
     case RO_NET_BARRIER_ALL:
       barrier(queue_idx, next_element.threadId, true, ro_net_comm_world);
       DPRINTF("Received Barrier_all\n");
@@ -265,6 +298,18 @@ void MPITransport::initTransport(int num_queues, BackendProxyT *proxy) {
 
   host_interface =
       new HostInterface(bp->hdp_policy, ro_net_comm_world, bp->heap_ptr);
+
+  int callback_threads{1};
+  char *value{nullptr};
+  if ((value = getenv("ROCSHMEM_HOST_CALLBACK_THREADS"))) {
+    callback_threads = atoi(value);
+  }
+  host_callbacks = std::make_unique<HostCallbacks>(
+      [this](uint64_t *sig_addr, uint64_t signal, int win_id) {
+        hostCallbackSignal(sig_addr, signal, win_id);
+      },
+      callback_threads);
+
   progress_thread = std::thread(&MPITransport::threadProgressEngine, this);
   while (!transport_up) {
   }
@@ -272,6 +317,7 @@ void MPITransport::initTransport(int num_queues, BackendProxyT *proxy) {
 
 void MPITransport::finalizeTransport() {
   progress_thread.join();
+  host_callbacks->stop();
   delete host_interface;
 }
 
@@ -548,12 +594,14 @@ void MPITransport::alltoall_broadcast(void *dst, void *src, int size,
     NET_CHECK(MPI_Rput(reinterpret_cast<char *>(src) + src_offset, size,
                        mpi_type, world_ranks[i],
                        bp->heap_window_info[win_id]->get_offset(
-                           reinterpret_cast<char *>(dst) + dst_offset),
-                       size, mpi_type, bp->heap_window_info[win_id]->get_win(),
+                           reinterpret_cast<char *>(dst) + dst_offset,
+                           world_ranks[i]),
+                       size, mpi_type,
+                       bp->heap_window_info[win_id]->get_win(dst),
                        &pe_req[i]));
   }
   NET_CHECK(MPI_Waitall(pe_size, pe_req.data(), MPI_STATUSES_IGNORE));
-  NET_CHECK(MPI_Win_flush_all(bp->heap_window_info[win_id]->get_win()));
+  NET_CHECK(MPI_Win_flush_all(bp->heap_window_info[win_id]->get_win(dst)));
 
   barrier(blockId, threadId, blocking, comm);
 }
@@ -623,9 +671,10 @@ void MPITransport::alltoall_gcen(void *dst, void *src, int size, int win_id,
         reinterpret_cast<void *>(
             (reinterpret_cast<char *>(ata_buffptr) + dst_offset)),
         size, mpi_type, world_ranks[clust_id * clust_size + (i % clust_size)],
-        bp->heap_window_info[win_id]->get_offset(reinterpret_cast<char *>(src) +
-                                                 src_offset),
-        size, mpi_type, bp->heap_window_info[win_id]->get_win(),
+        bp->heap_window_info[win_id]->get_offset(
+            reinterpret_cast<char *>(src) + src_offset,
+            world_ranks[clust_id * clust_size + (i % clust_size)]),
+        size, mpi_type, bp->heap_window_info[win_id]->get_win(src),
         &clust_req[i]));
   }
 
@@ -640,14 +689,17 @@ void MPITransport::alltoall_gcen(void *dst, void *src, int size, int win_id,
             (reinterpret_cast<char *>(ata_buffptr) + src_offset)),
         size * clust_size, mpi_type,
         world_ranks[(new_rank % clust_size) + i * clust_size],
-        bp->heap_window_info[win_id]->get_offset(dst) + dst_offset,
-        size * clust_size, mpi_type, bp->heap_window_info[win_id]->get_win()));
+        bp->heap_window_info[win_id]->get_offset(
+            dst, world_ranks[(new_rank % clust_size) + i * clust_size]) +
+            dst_offset,
+        size * clust_size, mpi_type,
+        bp->heap_window_info[win_id]->get_win(dst)));
 
     // Since MPI makes puts as complete as soon as the local buffer is free,
     // we need a flush to satisfy quiet.
     NET_CHECK(
         MPI_Win_flush(world_ranks[(new_rank % clust_size) + i * clust_size],
-                      bp->heap_window_info[win_id]->get_win()));
+                      bp->heap_window_info[win_id]->get_win(dst)));
   }
 
   int stride{world_ranks[1] - world_ranks[0]};
@@ -716,8 +768,11 @@ void MPITransport::alltoall_gcen2(void *dst, void *src, int size, int win_id,
                        size, mpi_type,
                        world_ranks[clust_id * clust_size + (i % clust_size)],
                        bp->heap_window_info[win_id]->get_offset(
-                           reinterpret_cast<char *>(src) + src_offset),
-                       size, mpi_type, bp->heap_window_info[win_id]->get_win(),
+                           reinterpret_cast<char *>(src) + src_offset,
+                           world_ranks[clust_id * clust_size +
+                                       (i % clust_size)]),
+                       size, mpi_type,
+                       bp->heap_window_info[win_id]->get_win(src),
                        &clust_req[i]));
   }
 
@@ -738,14 +793,17 @@ void MPITransport::alltoall_gcen2(void *dst, void *src, int size, int win_id,
                                  src_offset),
         size * clust_size, mpi_type,
         world_ranks[(new_rank % clust_size) + i * clust_size],
-        bp->heap_window_info[win_id]->get_offset(dst) + dst_offset,
-        size * clust_size, mpi_type, bp->heap_window_info[win_id]->get_win()));
+        bp->heap_window_info[win_id]->get_offset(
+            dst, world_ranks[(new_rank % clust_size) + i * clust_size]) +
+            dst_offset,
+        size * clust_size, mpi_type,
+        bp->heap_window_info[win_id]->get_win(dst)));
 
     // Since MPI makes puts as complete as soon as the local buffer is free,
     // we need a flush to satisfy quiet.
     NET_CHECK(
         MPI_Win_flush(world_ranks[(new_rank % clust_size) + i * clust_size],
-                      bp->heap_window_info[win_id]->get_win()));
+                      bp->heap_window_info[win_id]->get_win(dst)));
   }
 
   MPI_Comm comm_ring = createComm(world_ranks[new_rank % clust_size],
@@ -821,12 +879,13 @@ void MPITransport::fcollect_broadcast(void *dst, void *src, int size,
     int dst_offset = new_rank * type_size * size;
     NET_CHECK(MPI_Rput(
         reinterpret_cast<char *>(src), size, mpi_type, world_ranks[i],
-        bp->heap_window_info[win_id]->get_offset(reinterpret_cast<char *>(dst) +
-                                                 dst_offset),
-        size, mpi_type, bp->heap_window_info[win_id]->get_win(), &pe_req[i]));
+        bp->heap_window_info[win_id]->get_offset(
+            reinterpret_cast<char *>(dst) + dst_offset, world_ranks[i]),
+        size, mpi_type, bp->heap_window_info[win_id]->get_win(dst),
+        &pe_req[i]));
   }
   NET_CHECK(MPI_Waitall(pe_size, pe_req.data(), MPI_STATUSES_IGNORE));
-  NET_CHECK(MPI_Win_flush_all(bp->heap_window_info[win_id]->get_win()));
+  NET_CHECK(MPI_Win_flush_all(bp->heap_window_info[win_id]->get_win(dst)));
 
   // Now wait for completion
   barrier(blockId, threadId, blocking, comm);
@@ -900,8 +959,10 @@ void MPITransport::fcollect_gcen(void *dst, void *src, int size, int win_id,
         reinterpret_cast<void *>(reinterpret_cast<char *>(ata_buffptr) +
                                  dst_offset),
         size, mpi_type, world_ranks[clust_id * clust_size + (i % clust_size)],
-        bp->heap_window_info[win_id]->get_offset(src), size, mpi_type,
-        bp->heap_window_info[win_id]->get_win(), &clust_req[i]));
+        bp->heap_window_info[win_id]->get_offset(
+            src, world_ranks[clust_id * clust_size + (i % clust_size)]),
+        size, mpi_type,
+        bp->heap_window_info[win_id]->get_win(src), &clust_req[i]));
   }
 
   NET_CHECK(MPI_Waitall(clust_size, clust_req.data(), MPI_STATUSES_IGNORE));
@@ -913,15 +974,17 @@ void MPITransport::fcollect_gcen(void *dst, void *src, int size, int win_id,
     NET_CHECK(MPI_Put(ata_buffptr, size * clust_size, mpi_type,
                       world_ranks[(new_rank % clust_size) + i * clust_size],
                       bp->heap_window_info[win_id]->get_offset(
-                          reinterpret_cast<char *>(dst) + dst_offset),
+                          reinterpret_cast<char *>(dst) + dst_offset,
+                          world_ranks[(new_rank % clust_size) +
+                                      i * clust_size]),
                       size * clust_size, mpi_type,
-                      bp->heap_window_info[win_id]->get_win()));
+                      bp->heap_window_info[win_id]->get_win(dst)));
 
     // Since MPI makes puts as complete as soon as the local buffer is free,
     // we need a flush to satisfy quiet.
     NET_CHECK(
         MPI_Win_flush(world_ranks[(new_rank % clust_size) + i * clust_size],
-                      bp->heap_window_info[win_id]->get_win()));
+                      bp->heap_window_info[win_id]->get_win(dst)));
   }
 
   int stride = world_ranks[1] - world_ranks[0];
@@ -987,8 +1050,10 @@ void MPITransport::fcollect_gcen2(void *dst, void *src, int size, int win_id,
         reinterpret_cast<void *>(reinterpret_cast<char *>(ata_buffptr) +
                                  dst_offset),
         size, mpi_type, world_ranks[clust_id * clust_size + (i % clust_size)],
-        bp->heap_window_info[win_id]->get_offset(src), size, mpi_type,
-        bp->heap_window_info[win_id]->get_win(), &clust_req[i]));
+        bp->heap_window_info[win_id]->get_offset(
+            src, world_ranks[clust_id * clust_size + (i % clust_size)]),
+        size, mpi_type,
+        bp->heap_window_info[win_id]->get_win(src), &clust_req[i]));
   }
 
   NET_CHECK(MPI_Waitall(clust_size, clust_req.data(), MPI_STATUSES_IGNORE));
@@ -1005,15 +1070,17 @@ void MPITransport::fcollect_gcen2(void *dst, void *src, int size, int win_id,
     NET_CHECK(MPI_Put(ata_buffptr, size * clust_size, mpi_type,
                       world_ranks[(new_rank % clust_size) + i * clust_size],
                       bp->heap_window_info[win_id]->get_offset(
-                          reinterpret_cast<char *>(dst) + dst_offset),
+                          reinterpret_cast<char *>(dst) + dst_offset,
+                          world_ranks[(new_rank % clust_size) +
+                                      i * clust_size]),
                       size * clust_size, mpi_type,
-                      bp->heap_window_info[win_id]->get_win()));
+                      bp->heap_window_info[win_id]->get_win(dst)));
 
     // Since MPI makes puts as complete as soon as the local buffer is free,
     // we need a flush to satisfy quiet.
     NET_CHECK(
         MPI_Win_flush(world_ranks[(new_rank % clust_size) + i * clust_size],
-                      bp->heap_window_info[win_id]->get_win()));
+                      bp->heap_window_info[win_id]->get_win(dst)));
   }
 
   MPI_Comm comm_ring = createComm(world_ranks[new_rank % clust_size],
@@ -1031,13 +1098,14 @@ void MPITransport::putMem(void *dst, void *src, int size, int pe, int win_id,
   MPI_Request request{};
 
   NET_CHECK(MPI_Rput(
-      src, size, MPI_CHAR, pe, bp->heap_window_info[win_id]->get_offset(dst),
-      size, MPI_CHAR, bp->heap_window_info[win_id]->get_win(), &request));
+      src, size, MPI_CHAR, pe,
+      bp->heap_window_info[win_id]->get_offset(dst, pe), size, MPI_CHAR,
+      bp->heap_window_info[win_id]->get_win(dst), &request));
 
   // Since MPI makes puts as complete as soon as the local buffer is free,
   // we need a flush to satisfy quiet.  Put it here as a hack for now even
   // though it should be in the progress loop.
-  NET_CHECK(MPI_Win_flush_all(bp->heap_window_info[win_id]->get_win()));
+  NET_CHECK(MPI_Win_flush_all(bp->heap_window_info[win_id]->get_win(dst)));
 
   requests.push_back({request, {threadId, blockId, blocking}});
 
@@ -1052,14 +1120,15 @@ void MPITransport::amoFOP(void *dst, void *src, void *val, int pe, int win_id,
   auto *bp{backend_proxy->get()};
   MPI_Datatype mpi_type{convertType(type)};
   NET_CHECK(MPI_Fetch_and_op(reinterpret_cast<void *>(val), src, mpi_type, pe,
-                             bp->heap_window_info[win_id]->get_offset(dst),
+                             bp->heap_window_info[win_id]->get_offset(dst, pe),
                              get_mpi_op(op),
-                             bp->heap_window_info[win_id]->get_win()));
+                             bp->heap_window_info[win_id]->get_win(dst)));
 
   // Since MPI makes puts as complete as soon as the local buffer is free,
   // we need a flush to satisfy quiet.  Put it here as a hack for now even
   // though it should be in the progress loop.
-  NET_CHECK(MPI_Win_flush_local(pe, bp->heap_window_info[win_id]->get_win()));
+  NET_CHECK(
+      MPI_Win_flush_local(pe, bp->heap_window_info[win_id]->get_win(dst)));
 
   queue->notify(blockId, threadId);
 
@@ -1075,13 +1144,15 @@ void MPITransport::amoFCAS(void *dst, void *src, void *val, int pe,
   MPI_Datatype mpi_type{convertType(type)};
   NET_CHECK(MPI_Compare_and_swap((const void *)val, (const void *)cond, src,
                                  mpi_type, pe,
-                                 bp->heap_window_info[win_id]->get_offset(dst),
-                                 bp->heap_window_info[win_id]->get_win()));
+                                 bp->heap_window_info[win_id]->get_offset(
+                                     dst, pe),
+                                 bp->heap_window_info[win_id]->get_win(dst)));
 
   // Since MPI makes puts as complete as soon as the local buffer is free,
   // we need a flush to satisfy quiet.  Put it here as a hack for now even
   // though it should be in the progress loop.
-  NET_CHECK(MPI_Win_flush_local(pe, bp->heap_window_info[win_id]->get_win()));
+  NET_CHECK(
+      MPI_Win_flush_local(pe, bp->heap_window_info[win_id]->get_win(dst)));
 
   queue->notify(blockId, threadId);
 
@@ -1095,12 +1166,94 @@ void MPITransport::getMem(void *dst, void *src, int size, int pe, int win_id,
   auto *bp{backend_proxy->get()};
   MPI_Request request{};
   NET_CHECK(MPI_Rget(
-      dst, size, MPI_CHAR, pe, bp->heap_window_info[win_id]->get_offset(src),
-      size, MPI_CHAR, bp->heap_window_info[win_id]->get_win(), &request));
+      dst, size, MPI_CHAR, pe,
+      bp->heap_window_info[win_id]->get_offset(src, pe), size, MPI_CHAR,
+      bp->heap_window_info[win_id]->get_win(src), &request));
 
   requests.push_back({request, {threadId, blockId, blocking}});
 }
 
+/*
+ * Describes nelems elements of elem_size bytes spaced stride elements apart,
+ * so a whole strided transfer is a single MPI RMA operation.
+ */
+static MPI_Datatype stridedType(int nelems, int elem_size, ptrdiff_t stride) {
+  MPI_Datatype type{};
+  NET_CHECK(MPI_Type_vector(nelems, elem_size, stride * elem_size, MPI_CHAR,
+                            &type));
+  NET_CHECK(MPI_Type_commit(&type));
+  return type;
+}
+
+void MPITransport::iputMem(void *dst, void *src, int nelems, int elem_size,
+                             ptrdiff_t dst_stride, ptrdiff_t src_stride,
+                             int pe, int win_id, int blockId, int threadId,
+                             bool blocking) {
+  queue->flush_hdp();
+
+  auto *bp{backend_proxy->get()};
+  MPI_Datatype origin_type{stridedType(nelems, elem_size, src_stride)};
+  MPI_Datatype target_type{stridedType(nelems, elem_size, dst_stride)};
+  MPI_Request request{};
+
+  NET_CHECK(MPI_Rput(src, 1, origin_type, pe,
+                     bp->heap_window_info[win_id]->get_offset(dst, pe), 1,
+                     target_type, bp->heap_window_info[win_id]->get_win(dst),
+                     &request));
+
+  // Same as putMem: quiet needs remote completion, not just local.
+  NET_CHECK(MPI_Win_flush_all(bp->heap_window_info[win_id]->get_win(dst)));
+
+  // The pending operation keeps its own reference to the datatypes.
+  NET_CHECK(MPI_Type_free(&target_type));
+  NET_CHECK(MPI_Type_free(&origin_type));
+
+  requests.push_back({request, {threadId, blockId, blocking}});
+
+  outstanding[blockId]++;
+}
+
+void MPITransport::igetMem(void *dst, void *src, int nelems, int elem_size,
+                             ptrdiff_t dst_stride, ptrdiff_t src_stride,
+                             int pe, int win_id, int blockId, int threadId,
+                             bool blocking) {
+  outstanding[blockId]++;
+
+  auto *bp{backend_proxy->get()};
+  MPI_Datatype origin_type{stridedType(nelems, elem_size, dst_stride)};
+  MPI_Datatype target_type{stridedType(nelems, elem_size, src_stride)};
+  MPI_Request request{};
+
+  NET_CHECK(MPI_Rget(dst, 1, origin_type, pe,
+                     bp->heap_window_info[win_id]->get_offset(src, pe), 1,
+                     target_type, bp->heap_window_info[win_id]->get_win(src),
+                     &request));
+
+  NET_CHECK(MPI_Type_free(&target_type));
+  NET_CHECK(MPI_Type_free(&origin_type));
+
+  requests.push_back({request, {threadId, blockId, blocking}});
+}
+
+/*
+ * Handed off callbacks finish on worker threads, so the signal is an MPI
+ * accumulate to the calling PE which stays atomic with respect to device
+ * and remote updates of the same word.
+ */
+void MPITransport::hostCallbackSignal(uint64_t *sig_addr, uint64_t signal,
+                                      int win_id) {
+  auto *bp{backend_proxy->get()};
+  auto *window_info{bp->heap_window_info[win_id]};
+
+  NET_CHECK(MPI_Accumulate(&signal, 1, MPI_UINT64_T, my_pe,
+                           window_info->get_offset(sig_addr, my_pe), 1,
+                           MPI_UINT64_T, MPI_REPLACE,
+                           window_info->get_win(sig_addr)));
+  NET_CHECK(MPI_Win_flush(my_pe, window_info->get_win(sig_addr)));
+
+  queue->sfence_flush_hdp();
+}
+
 std::unique_ptr<MPI_Request[]> MPITransport::raw_requests() {
   auto uptr_arr = std::make_unique<MPI_Request[]>(requests.size());
   for (size_t i{0}; i < requests.size(); i++) {
@@ -28,6 +28,7 @@
 #include <queue>
 #include <vector>
 
+#include "host_callbacks.hpp"
 #include "queue.hpp"
 #include "transport.hpp"
 
@@ -126,6 +127,16 @@ class MPITransport : public Transport {
   void getMem(void *dst, void *src, int size, int pe, int win_id, int blockId,
                 int threadId, bool blocking) override;
 
+  void iputMem(void *dst, void *src, int nelems, int elem_size,
+                 ptrdiff_t dst_stride, ptrdiff_t src_stride, int pe,
+                 int win_id, int blockId, int threadId,
+                 bool blocking) override;
+
+  void igetMem(void *dst, void *src, int nelems, int elem_size,
+                 ptrdiff_t dst_stride, ptrdiff_t src_stride, int pe,
+                 int win_id, int blockId, int threadId,
+                 bool blocking) override;
+
   void quiet(int blockId, int threadId) override;
 
   void progress() override;
@@ -142,6 +153,11 @@ class MPITransport : public Transport {
 
   HostInterface *host_interface{nullptr};
 
+  /**
+   * @brief Host functions run for RO_NET_HOST_CALLBACK requests.
+   */
+  std::unique_ptr<HostCallbacks> host_callbacks{};
+
  private:
   struct CommKey {
     CommKey(int _start, int _logPstride, int _size)
@@ -195,6 +211,8 @@ class MPITransport : public Transport {
 
   MPI_Op get_mpi_op(ROCSHMEM_OP op);
 
+  void hostCallbackSignal(uint64_t *sig_addr, uint64_t signal, int win_id);
+
   Queue *queue{nullptr};
 
   std::unique_ptr<MPI_Request[]> raw_requests();
@@ -25,6 +25,7 @@
 
 #include <mpi.h>
 
+#include "rocshmem/rocshmem.hpp"
 #include "../atomic_return.hpp"
 #include "../device_proxy.hpp"
 #include "../hdp_policy.hpp"
@@ -75,6 +76,22 @@ typedef struct queue_element {
     void *pWrk;
     unsigned long long atomic_cond;
   } ol2;
+  /**
+   * RO_NET_IPUT and RO_NET_IGET carry the element size in bytes and the
+   * element strides in strided; the element count is in ol1.size.
+   *
+   * RO_NET_HOST_CALLBACK carries its inline arguments in callback_args.
+   * The callback id is in PE, the argument count in ol1.size, the
+   * completion signal address in dst and its value in ol2.atomic_cond.
+   */
+  union {
+    struct {
+      int elem_size;
+      ptrdiff_t dst_stride;
+      ptrdiff_t src_stride;
+    } strided;
+    uint64_t callback_args[ROCSHMEM_HOST_CALLBACK_MAX_ARGS];
+  } ol3;
 } __attribute__((__aligned__(64))) queue_element_t;
 
 template <typename ALLOCATOR>
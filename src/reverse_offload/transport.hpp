@@ -88,6 +88,16 @@ class Transport {
   virtual void getMem(void *dst, void *src, int size, int pe, int win_id,
                         int wg_id, int threadId, bool blocking) = 0;
 
+  virtual void iputMem(void *dst, void *src, int nelems, int elem_size,
+                         ptrdiff_t dst_stride, ptrdiff_t src_stride, int pe,
+                         int win_id, int wg_id, int threadId,
+                         bool blocking) = 0;
+
+  virtual void igetMem(void *dst, void *src, int nelems, int elem_size,
+                         ptrdiff_t dst_stride, ptrdiff_t src_stride, int pe,
+                         int win_id, int wg_id, int threadId,
+                         bool blocking) = 0;
+
   virtual void amoFOP(void *dst, void *src, void *val, int pe, int win_id,
                         int wg_id, int threadId, bool blocking, ROCSHMEM_OP op,
                         ro_net_types type) = 0;
@@ -45,8 +45,7 @@ class WindowProxy {
     auto *window_info{proxy_.get()};
 
     for (size_t i{0}; i < MAX_NUM_WINDOWS; i++) {
-      window_info[i] =
-          new WindowInfo(comm, heap->get_local_heap_base(), heap->get_size());
+      window_info[i] = heap->create_window_info(comm);
     }
   }
 
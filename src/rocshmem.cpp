@@ -33,6 +33,7 @@
 
 #include <cstdlib>
 #include <functional>
+#include <limits>
 
 #include "backend_bc.hpp"
 #include "context_incl.hpp"
@@ -126,6 +127,18 @@ rocshmem_ctx_t ROCSHMEM_HOST_CTX_DEFAULT;
   void *ptr;
   backend->heap.malloc(&ptr, size);
 
+  /*
+   * Symmetric allocations are made in the same order with the same
+   * sizes on every processing element, so an exhausted heap is seen by
+   * all of them and the growth below is entered collectively.
+   */
+  if (!ptr && size && backend->grow_heap(size)) {
+    backend->heap.malloc(&ptr, size);
+  }
+  if (!ptr && size) {
+    backend->heap.note_failed_alloc();
+  }
+
   rocshmem_barrier_all();
 
   return ptr;
@@ -139,11 +152,84 @@ rocshmem_ctx_t ROCSHMEM_HOST_CTX_DEFAULT;
   backend->heap.free(ptr);
 }
 
+[[maybe_unused]] __host__ void *rocshmem_calloc(size_t count, size_t size) {
+  VERIFY_BACKEND();
+
+  /* An overflowing request can never be satisfied, so do not grow for it */
+  if (count && size > std::numeric_limits<size_t>::max() / count) {
+    backend->heap.note_failed_alloc();
+    rocshmem_barrier_all();
+    return nullptr;
+  }
+
+  void *ptr{backend->heap.calloc(count, size)};
+
+  if (!ptr && count && size && backend->grow_heap(count * size)) {
+    ptr = backend->heap.calloc(count, size);
+  }
+  if (!ptr && count && size) {
+    backend->heap.note_failed_alloc();
+  }
+
+  rocshmem_barrier_all();
+
+  return ptr;
+}
+
+[[maybe_unused]] __host__ void *rocshmem_align(size_t alignment, size_t size) {
+  VERIFY_BACKEND();
+
+  void *ptr{backend->heap.malign(alignment, size)};
+
+  /*
+   * Request enough slack in the new segment to carve an aligned block.
+   */
+  if (!ptr && size && backend->grow_heap(size + alignment)) {
+    ptr = backend->heap.malign(alignment, size);
+  }
+  if (!ptr && size) {
+    backend->heap.note_failed_alloc();
+  }
+
+  rocshmem_barrier_all();
+
+  return ptr;
+}
+
+[[maybe_unused]] __host__ void *rocshmem_realloc(void *ptr, size_t size) {
+  VERIFY_BACKEND();
+
+  /*
+   * Other PEs may still access the old allocation until all PEs reach
+   * this call.
+   */
+  rocshmem_barrier_all();
+
+  void *new_ptr{backend->heap.realloc(ptr, size)};
+
+  if (!new_ptr && size && backend->grow_heap(size)) {
+    new_ptr = backend->heap.realloc(ptr, size);
+  }
+  if (!new_ptr && size) {
+    backend->heap.note_failed_alloc();
+  }
+
+  rocshmem_barrier_all();
+
+  return new_ptr;
+}
+
 [[maybe_unused]] __host__ void rocshmem_reset_stats() {
   VERIFY_BACKEND();
   backend->reset_stats();
 }
 
+[[maybe_unused]] __host__ void rocshmem_heap_stats(
+    rocshmem_heap_stats_t *stats) {
+  VERIFY_BACKEND();
+  backend->heap.get_stats(stats);
+}
+
 [[maybe_unused]] __host__ void rocshmem_dump_stats() {
   /** TODO: Many stats are backend independent! **/
   VERIFY_BACKEND();
@@ -186,6 +272,17 @@ __host__ void rocshmem_global_exit(int status) {
   backend->global_exit(status);
 }
 
+__host__ int rocshmem_register_host_callback(rocshmem_host_callback_t fn,
+                                             void *user_data, int flags) {
+  VERIFY_BACKEND();
+  DPRINTF("Host function: rocshmem_register_host_callback\n");
+
+  if (!fn) {
+    return -1;
+  }
+  return backend->register_host_callback(fn, user_data, flags);
+}
+
 /******************************************************************************
  ****************************** Teams Interface *******************************
  *****************************************************************************/
@@ -220,8 +317,8 @@ __host__ inline int pe_in_active_set(int start, int stride, int size, int pe) {
 
 __host__ int rocshmem_team_split_strided(
     rocshmem_team_t parent_team, int start, int stride, int size,
-    [[maybe_unused]] const rocshmem_team_config_t *config,
-    [[maybe_unused]] long config_mask, rocshmem_team_t *new_team) {
+    const rocshmem_team_config_t *config, long config_mask,
+    rocshmem_team_t *new_team) {
   VERIFY_BACKEND();
 
   *new_team = ROCSHMEM_TEAM_INVALID;
@@ -244,6 +341,10 @@ __host__ int rocshmem_team_split_strided(
     return -1;
   }
 
+  if (config_mask != 0 && config == nullptr) {
+    return -1;
+  }
+
   /* Calculate pe_start, stride, and pe_end wrt team world */
   int pe_start_in_world = parent_team_obj->get_pe_in_world(start);
   int stride_in_world = stride * parent_team_obj->tinfo_wrt_world->stride;
@@ -291,7 +392,7 @@ __host__ int rocshmem_team_split_strided(
   } else {
     backend->create_new_team(parent_team_obj, team_info_wrt_parent,
                              team_info_wrt_world, size, my_pe_in_new_team,
-                             team_comm, new_team);
+                             team_comm, config, config_mask, new_team);
 
     /* Track the newly created team to destroy it in finalize if the user does
      * not */
@@ -369,6 +470,18 @@ __host__ void rocshmem_get_nbi(T *dest, const T *source, size_t nelems,
   rocshmem_get_nbi(ROCSHMEM_HOST_CTX_DEFAULT, dest, source, nelems, pe);
 }
 
+template <typename T>
+__host__ void rocshmem_iput(T *dest, const T *source, ptrdiff_t dst,
+                             ptrdiff_t sst, size_t nelems, int pe) {
+  rocshmem_iput(ROCSHMEM_HOST_CTX_DEFAULT, dest, source, dst, sst, nelems, pe);
+}
+
+template <typename T>
+__host__ void rocshmem_iget(T *dest, const T *source, ptrdiff_t dst,
+                             ptrdiff_t sst, size_t nelems, int pe) {
+  rocshmem_iget(ROCSHMEM_HOST_CTX_DEFAULT, dest, source, dst, sst, nelems, pe);
+}
+
 __host__ void rocshmem_getmem_nbi(void *dest, const void *source,
                                    size_t nelems, int pe) {
   rocshmem_ctx_getmem_nbi(ROCSHMEM_HOST_CTX_DEFAULT, dest, source, nelems,
@@ -456,6 +569,10 @@ __host__ void rocshmem_quiet() {
   rocshmem_ctx_quiet(ROCSHMEM_HOST_CTX_DEFAULT);
 }
 
+__host__ void rocshmem_batch(const rocshmem_batch_op_t *ops, size_t nops) {
+  rocshmem_ctx_batch(ROCSHMEM_HOST_CTX_DEFAULT, ops, nops);
+}
+
 /******************************************************************************
  ************************* Private Context Interfaces *************************
  *****************************************************************************/
@@ -560,6 +677,24 @@ __host__ void rocshmem_get_nbi(rocshmem_ctx_t ctx, T *dest, const T *source,
   get_internal_ctx(ctx)->get_nbi(dest, source, nelems, pe);
 }
 
+template <typename T>
+__host__ void rocshmem_iput(rocshmem_ctx_t ctx, T *dest, const T *source,
+                             ptrdiff_t dst, ptrdiff_t sst, size_t nelems,
+                             int pe) {
+  DPRINTF("Host function: rocshmem_iput\n");
+
+  get_internal_ctx(ctx)->iput(dest, source, dst, sst, nelems, pe);
+}
+
+template <typename T>
+__host__ void rocshmem_iget(rocshmem_ctx_t ctx, T *dest, const T *source,
+                             ptrdiff_t dst, ptrdiff_t sst, size_t nelems,
+                             int pe) {
+  DPRINTF("Host function: rocshmem_iget\n");
+
+  get_internal_ctx(ctx)->iget(dest, source, dst, sst, nelems, pe);
+}
+
 __host__ void rocshmem_ctx_getmem_nbi(rocshmem_ctx_t ctx, void *dest,
                                        const void *source, size_t nelems,
                                        int pe) {
@@ -687,6 +822,13 @@ __host__ void rocshmem_ctx_quiet(rocshmem_ctx_t ctx) {
   get_internal_ctx(ctx)->quiet();
 }
 
+__host__ void rocshmem_ctx_batch(rocshmem_ctx_t ctx,
+                                 const rocshmem_batch_op_t *ops, size_t nops) {
+  DPRINTF("Host function: rocshmem_ctx_batch\n");
+
+  get_internal_ctx(ctx)->batch(ops, nops);
+}
+
 __host__ void rocshmem_barrier_all() {
   DPRINTF("Host function: rocshmem_barrier_all\n");
 
@@ -699,6 +841,24 @@ __host__ void rocshmem_sync_all() {
   get_internal_ctx(ROCSHMEM_HOST_CTX_DEFAULT)->sync_all();
 }
 
+__host__ void rocshmem_barrier_all_nbi(rocshmem_request_t *request) {
+  DPRINTF("Host function: rocshmem_barrier_all_nbi\n");
+
+  get_internal_ctx(ROCSHMEM_HOST_CTX_DEFAULT)->barrier_all_nbi(request);
+}
+
+__host__ int rocshmem_test(rocshmem_request_t *request) {
+  DPRINTF("Host function: rocshmem_test\n");
+
+  return get_internal_ctx(ROCSHMEM_HOST_CTX_DEFAULT)->test_request(request);
+}
+
+__host__ void rocshmem_wait(rocshmem_request_t *request) {
+  DPRINTF("Host function: rocshmem_wait\n");
+
+  get_internal_ctx(ROCSHMEM_HOST_CTX_DEFAULT)->wait_request(request);
+}
+
 template <typename T>
 __host__ void rocshmem_broadcast([[maybe_unused]] rocshmem_ctx_t ctx, T *dest,
                                   const T *source, int nelem, int pe_root,
@@ -721,6 +881,51 @@ __host__ void rocshmem_broadcast([[maybe_unused]] rocshmem_ctx_t ctx,
       ->broadcast<T>(team, dest, source, nelem, pe_root);
 }
 
+template <typename T>
+__host__ void rocshmem_broadcast_nbi([[maybe_unused]] rocshmem_ctx_t ctx,
+                                      rocshmem_team_t team, T *dest,
+                                      const T *source, int nelem, int pe_root,
+                                      rocshmem_request_t *request) {
+  DPRINTF("Host function: Team-based rocshmem_broadcast_nbi\n");
+
+  get_internal_ctx(ROCSHMEM_HOST_CTX_DEFAULT)
+      ->broadcast_nbi<T>(team, dest, source, nelem, pe_root, request);
+}
+
+template <typename T>
+__host__ void rocshmem_alltoall([[maybe_unused]] rocshmem_ctx_t ctx,
+                                 rocshmem_team_t team, T *dest,
+                                 const T *source, int nelems) {
+  DPRINTF("Host function: rocshmem_alltoall\n");
+
+  get_internal_ctx(ROCSHMEM_HOST_CTX_DEFAULT)
+      ->alltoall<T>(team, dest, source, nelems);
+}
+
+template <typename T>
+__host__ void rocshmem_alltoallv([[maybe_unused]] rocshmem_ctx_t ctx,
+                                  rocshmem_team_t team, T *dest,
+                                  const int *dest_counts,
+                                  const int *dest_displs, const T *source,
+                                  const int *source_counts,
+                                  const int *source_displs) {
+  DPRINTF("Host function: rocshmem_alltoallv\n");
+
+  get_internal_ctx(ROCSHMEM_HOST_CTX_DEFAULT)
+      ->alltoallv<T>(team, dest, dest_counts, dest_displs, source,
+                     source_counts, source_displs);
+}
+
+template <typename T>
+__host__ void rocshmem_fcollect([[maybe_unused]] rocshmem_ctx_t ctx,
+                                 rocshmem_team_t team, T *dest,
+                                 const T *source, int nelems) {
+  DPRINTF("Host function: rocshmem_fcollect\n");
+
+  get_internal_ctx(ROCSHMEM_HOST_CTX_DEFAULT)
+      ->fcollect<T>(team, dest, source, nelems);
+}
+
 template <typename T, ROCSHMEM_OP Op>
 __host__ void rocshmem_to_all([[maybe_unused]] rocshmem_ctx_t ctx, T *dest,
                                const T *source, int nreduce, int PE_start,
@@ -743,6 +948,17 @@ __host__ int rocshmem_reduce([[maybe_unused]] rocshmem_ctx_t ctx,
               ->reduce<T, Op>(team, dest, source, nreduce);
 }
 
+template <typename T, ROCSHMEM_OP Op>
+__host__ int rocshmem_reduce_nbi([[maybe_unused]] rocshmem_ctx_t ctx,
+                                   rocshmem_team_t team, T *dest,
+                                   const T *source, int nreduce,
+                                   rocshmem_request_t *request) {
+  DPRINTF("Host function: Team-based rocshmem_reduce_nbi\n");
+
+  return get_internal_ctx(ROCSHMEM_HOST_CTX_DEFAULT)
+              ->reduce_nbi<T, Op>(team, dest, source, nreduce, request);
+}
+
 template <typename T>
 __host__ void rocshmem_wait_until(T *ivars, int cmp, T val) {
   DPRINTF("Host function: rocshmem_wait_until\n");
@@ -823,7 +1039,10 @@ __host__ int rocshmem_test(T *ivars, int cmp, T val) {
       int PE_start, int logPE_stride, int PE_size, T *pWrk, long *pSync);     \
   template __host__ int rocshmem_reduce<T, Op>(                               \
       rocshmem_ctx_t ctx, rocshmem_team_t team, T * dest, const T *source,    \
-      int nreduce);
+      int nreduce);                                                           \
+  template __host__ int rocshmem_reduce_nbi<T, Op>(                           \
+      rocshmem_ctx_t ctx, rocshmem_team_t team, T * dest, const T *source,    \
+      int nreduce, rocshmem_request_t *request);
 
 #define ARITH_REDUCTION_GEN(T)    \
   REDUCTION_GEN(T, ROCSHMEM_SUM) \
@@ -868,12 +1087,37 @@ __host__ int rocshmem_test(T *ivars, int cmp, T val) {
   template __host__ void rocshmem_get_nbi<T>(T * dest, const T *source,       \
                                               size_t nelems, int pe);         \
   template __host__ T rocshmem_g<T>(const T *source, int pe);                 \
+  template __host__ void rocshmem_iput<T>(                                    \
+      rocshmem_ctx_t ctx, T * dest, const T *source, ptrdiff_t dst,           \
+      ptrdiff_t sst, size_t nelems, int pe);                                  \
+  template __host__ void rocshmem_iget<T>(                                    \
+      rocshmem_ctx_t ctx, T * dest, const T *source, ptrdiff_t dst,           \
+      ptrdiff_t sst, size_t nelems, int pe);                                  \
+  template __host__ void rocshmem_iput<T>(T * dest, const T *source,          \
+                                           ptrdiff_t dst, ptrdiff_t sst,      \
+                                           size_t nelems, int pe);            \
+  template __host__ void rocshmem_iget<T>(T * dest, const T *source,          \
+                                           ptrdiff_t dst, ptrdiff_t sst,      \
+                                           size_t nelems, int pe);            \
   template __host__ void rocshmem_broadcast<T>(                               \
       rocshmem_ctx_t ctx, T * dest, const T *source, int nelem, int pe_root,  \
       int pe_start, int log_pe_stride, int pe_size, long *p_sync);            \
   template __host__ void rocshmem_broadcast<T>(                               \
       rocshmem_ctx_t ctx, rocshmem_team_t team, T * dest, const T *source,    \
-      int nelem, int pe_root);
+      int nelem, int pe_root);                                                \
+  template __host__ void rocshmem_broadcast_nbi<T>(                           \
+      rocshmem_ctx_t ctx, rocshmem_team_t team, T * dest, const T *source,    \
+      int nelem, int pe_root, rocshmem_request_t *request);                   \
+  template __host__ void rocshmem_alltoall<T>(                                \
+      rocshmem_ctx_t ctx, rocshmem_team_t team, T * dest, const T *source,    \
+      int nelems);                                                            \
+  template __host__ void rocshmem_alltoallv<T>(                               \
+      rocshmem_ctx_t ctx, rocshmem_team_t team, T * dest,                     \
+      const int *dest_counts, const int *dest_displs, const T *source,        \
+      const int *source_counts, const int *source_displs);                    \
+  template __host__ void rocshmem_fcollect<T>(                                \
+      rocshmem_ctx_t ctx, rocshmem_team_t team, T * dest, const T *source,    \
+      int nelems);
 
 /**
  * Declare templates for the standard amo types
@@ -981,6 +1225,12 @@ __host__ int rocshmem_test(T *ivars, int cmp, T val) {
       rocshmem_ctx_t ctx, rocshmem_team_t team, T *dest, const T *source,     \
       int nreduce) {                                                          \
     return rocshmem_reduce<T, Op>(ctx, team, dest, source, nreduce);          \
+  }                                                                           \
+  __host__ int rocshmem_ctx_##TNAME##_##Op_API##_reduce_nbi(                  \
+      rocshmem_ctx_t ctx, rocshmem_team_t team, T *dest, const T *source,     \
+      int nreduce, rocshmem_request_t *request) {                             \
+    return rocshmem_reduce_nbi<T, Op>(ctx, team, dest, source, nreduce,       \
+                                      request);                               \
   }
 
 #define ARITH_REDUCTION_DEF_GEN(T, TNAME)                                     \
@@ -1047,6 +1297,26 @@ __host__ int rocshmem_test(T *ivars, int cmp, T val) {
   __host__ T rocshmem_##TNAME##_g(const T *source, int pe) {                  \
     return rocshmem_g<T>(source, pe);                                         \
   }                                                                           \
+  __host__ void rocshmem_ctx_##TNAME##_iput(                                  \
+      rocshmem_ctx_t ctx, T *dest, const T *source, ptrdiff_t dst,            \
+      ptrdiff_t sst, size_t nelems, int pe) {                                 \
+    rocshmem_iput<T>(ctx, dest, source, dst, sst, nelems, pe);                \
+  }                                                                           \
+  __host__ void rocshmem_ctx_##TNAME##_iget(                                  \
+      rocshmem_ctx_t ctx, T *dest, const T *source, ptrdiff_t dst,            \
+      ptrdiff_t sst, size_t nelems, int pe) {                                 \
+    rocshmem_iget<T>(ctx, dest, source, dst, sst, nelems, pe);                \
+  }                                                                           \
+  __host__ void rocshmem_##TNAME##_iput(T *dest, const T *source,             \
+                                         ptrdiff_t dst, ptrdiff_t sst,        \
+                                         size_t nelems, int pe) {             \
+    rocshmem_iput<T>(dest, source, dst, sst, nelems, pe);                     \
+  }                                                                           \
+  __host__ void rocshmem_##TNAME##_iget(T *dest, const T *source,             \
+                                         ptrdiff_t dst, ptrdiff_t sst,        \
+                                         size_t nelems, int pe) {             \
+    rocshmem_iget<T>(dest, source, dst, sst, nelems, pe);                     \
+  }                                                                           \
   __host__ void rocshmem_ctx_##TNAME##_broadcast(                             \
       rocshmem_ctx_t ctx, T *dest, const T *source, int nelem, int pe_root,   \
       int pe_start, int log_pe_stride, int pe_size, long *p_sync) {           \
@@ -1057,6 +1327,29 @@ __host__ int rocshmem_test(T *ivars, int cmp, T val) {
       rocshmem_ctx_t ctx, rocshmem_team_t team, T *dest, const T *source,     \
       int nelem, int pe_root) {                                               \
     rocshmem_broadcast<T>(ctx, team, dest, source, nelem, pe_root);           \
+  }                                                                           \
+  __host__ void rocshmem_ctx_##TNAME##_broadcast_nbi(                         \
+      rocshmem_ctx_t ctx, rocshmem_team_t team, T *dest, const T *source,     \
+      int nelem, int pe_root, rocshmem_request_t *request) {                  \
+    rocshmem_broadcast_nbi<T>(ctx, team, dest, source, nelem, pe_root,        \
+                              request);                                       \
+  }                                                                           \
+  __host__ void rocshmem_ctx_##TNAME##_alltoall(                              \
+      rocshmem_ctx_t ctx, rocshmem_team_t team, T *dest, const T *source,     \
+      int nelems) {                                                           \
+    rocshmem_alltoall<T>(ctx, team, dest, source, nelems);                    \
+  }                                                                           \
+  __host__ void rocshmem_ctx_##TNAME##_alltoallv(                             \
+      rocshmem_ctx_t ctx, rocshmem_team_t team, T *dest,                      \
+      const int *dest_counts, const int *dest_displs, const T *source,        \
+      const int *source_counts, const int *source_displs) {                   \
+    rocshmem_alltoallv<T>(ctx, team, dest, dest_counts, dest_displs, source,  \
+                          source_counts, source_displs);                      \
+  }                                                                           \
+  __host__ void rocshmem_ctx_##TNAME##_fcollect(                              \
+      rocshmem_ctx_t ctx, rocshmem_team_t team, T *dest, const T *source,     \
+      int nelems) {                                                           \
+    rocshmem_fcollect<T>(ctx, team, dest, source, nelems);                    \
   }
 
 #define AMO_STANDARD_DEF_GEN(T, TNAME)                                        \
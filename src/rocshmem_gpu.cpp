@@ -148,6 +148,18 @@ __device__ void rocshmem_get_nbi(T *dest, const T *source, size_t nelems,
   rocshmem_get_nbi(ROCSHMEM_CTX_DEFAULT, dest, source, nelems, pe);
 }
 
+template <typename T>
+__device__ void rocshmem_iput(T *dest, const T *source, ptrdiff_t dst,
+                               ptrdiff_t sst, size_t nelems, int pe) {
+  rocshmem_iput(ROCSHMEM_CTX_DEFAULT, dest, source, dst, sst, nelems, pe);
+}
+
+template <typename T>
+__device__ void rocshmem_iget(T *dest, const T *source, ptrdiff_t dst,
+                               ptrdiff_t sst, size_t nelems, int pe) {
+  rocshmem_iget(ROCSHMEM_CTX_DEFAULT, dest, source, dst, sst, nelems, pe);
+}
+
 __device__ void rocshmem_fence() {
   rocshmem_ctx_fence(ROCSHMEM_CTX_DEFAULT);
 }
@@ -164,6 +176,13 @@ __device__ void rocshmem_threadfence_system() {
   rocshmem_ctx_threadfence_system(ROCSHMEM_CTX_DEFAULT);
 }
 
+__device__ void rocshmem_host_callback(int id, const uint64_t *args,
+                                        int nargs, uint64_t *sig_addr,
+                                        uint64_t signal) {
+  rocshmem_ctx_host_callback(ROCSHMEM_CTX_DEFAULT, id, args, nargs, sig_addr,
+                             signal);
+}
+
 template <typename T>
 __device__ T rocshmem_atomic_fetch_add(T *dest, T val, int pe) {
   return rocshmem_atomic_fetch_add(ROCSHMEM_CTX_DEFAULT, dest, val, pe);
@@ -418,6 +437,28 @@ __device__ void rocshmem_ctx_getmem_nbi(rocshmem_ctx_t ctx, void *dest,
   get_internal_ctx(ctx)->getmem_nbi(dest, source, nelems, pe_in_world);
 }
 
+template <typename T>
+__device__ void rocshmem_iput(rocshmem_ctx_t ctx, T *dest, const T *source,
+                               ptrdiff_t dst, ptrdiff_t sst, size_t nelems,
+                               int pe) {
+  GPU_DPRINTF("Function: rocshmem_iput\n");
+
+  int pe_in_world = translate_pe(ctx, pe);
+
+  get_internal_ctx(ctx)->iput(dest, source, dst, sst, nelems, pe_in_world);
+}
+
+template <typename T>
+__device__ void rocshmem_iget(rocshmem_ctx_t ctx, T *dest, const T *source,
+                               ptrdiff_t dst, ptrdiff_t sst, size_t nelems,
+                               int pe) {
+  GPU_DPRINTF("Function: rocshmem_iget\n");
+
+  int pe_in_world = translate_pe(ctx, pe);
+
+  get_internal_ctx(ctx)->iget(dest, source, dst, sst, nelems, pe_in_world);
+}
+
 template <typename T>
 __device__ void rocshmem_get_nbi(rocshmem_ctx_t ctx, T *dest, const T *source,
                                   size_t nelems, int pe) {
@@ -454,6 +495,15 @@ __device__ void *rocshmem_ptr(const void *dest, int pe) {
   return get_internal_ctx(ROCSHMEM_CTX_DEFAULT)->shmem_ptr(dest, pe);
 }
 
+__device__ void rocshmem_ctx_host_callback(rocshmem_ctx_t ctx, int id,
+                                            const uint64_t *args, int nargs,
+                                            uint64_t *sig_addr,
+                                            uint64_t signal) {
+  GPU_DPRINTF("Function: rocshmem_ctx_host_callback\n");
+
+  get_internal_ctx(ctx)->host_callback(id, args, nargs, sig_addr, signal);
+}
+
 template <typename T, ROCSHMEM_OP Op>
 __device__ int rocshmem_wg_reduce(rocshmem_ctx_t ctx, rocshmem_team_t team,
                                    T *dest, const T *source, int nreduce) {
@@ -490,6 +540,43 @@ __device__ void rocshmem_wg_fcollect(rocshmem_ctx_t ctx,
   get_internal_ctx(ctx)->fcollect<T>(team, dest, source, nelem);
 }
 
+template <typename T, ROCSHMEM_OP Op>
+__device__ int rocshmem_grid_reduce(rocshmem_ctx_t ctx, rocshmem_team_t team,
+                                     T *dest, const T *source, int nreduce) {
+  GPU_DPRINTF("Function: rocshmem_grid_reduce\n");
+
+  return get_internal_ctx(ctx)->reduce_grid<T, Op>(team, dest, source,
+                                                    nreduce);
+}
+
+template <typename T>
+__device__ void rocshmem_grid_broadcast(rocshmem_ctx_t ctx,
+                                         rocshmem_team_t team, T *dest,
+                                         const T *source, int nelem,
+                                         int pe_root) {
+  GPU_DPRINTF("Function: rocshmem_grid_broadcast\n");
+
+  get_internal_ctx(ctx)->broadcast_grid<T>(team, dest, source, nelem, pe_root);
+}
+
+template <typename T>
+__device__ void rocshmem_grid_alltoall(rocshmem_ctx_t ctx,
+                                        rocshmem_team_t team, T *dest,
+                                        const T *source, int nelem) {
+  GPU_DPRINTF("Function: rocshmem_grid_alltoall\n");
+
+  get_internal_ctx(ctx)->alltoall_grid<T>(team, dest, source, nelem);
+}
+
+template <typename T>
+__device__ void rocshmem_grid_fcollect(rocshmem_ctx_t ctx,
+                                        rocshmem_team_t team, T *dest,
+                                        const T *source, int nelem) {
+  GPU_DPRINTF("Function: rocshmem_grid_fcollect\n");
+
+  get_internal_ctx(ctx)->fcollect_grid<T>(team, dest, source, nelem);
+}
+
 template <typename T>
 __device__ void rocshmem_wait_until(T *ivars, int cmp, T val) {
   GPU_DPRINTF("Function: rocshmem_wait_until\n");
@@ -871,6 +958,30 @@ __device__ void rocshmem_get_nbi_wave(rocshmem_ctx_t ctx, T *dest,
   get_internal_ctx(ctx)->get_nbi_wave(dest, source, nelems, pe);
 }
 
+template <typename T>
+__device__ void rocshmem_iput_wave(rocshmem_ctx_t ctx, T *dest,
+                                    const T *source, ptrdiff_t dst,
+                                    ptrdiff_t sst, size_t nelems, int pe) {
+  GPU_DPRINTF("Function: rocshmem_iput_wave\n");
+
+  int pe_in_world = translate_pe(ctx, pe);
+
+  get_internal_ctx(ctx)->iput_wave(dest, source, dst, sst, nelems,
+                                   pe_in_world);
+}
+
+template <typename T>
+__device__ void rocshmem_iget_wave(rocshmem_ctx_t ctx, T *dest,
+                                    const T *source, ptrdiff_t dst,
+                                    ptrdiff_t sst, size_t nelems, int pe) {
+  GPU_DPRINTF("Function: rocshmem_iget_wave\n");
+
+  int pe_in_world = translate_pe(ctx, pe);
+
+  get_internal_ctx(ctx)->iget_wave(dest, source, dst, sst, nelems,
+                                   pe_in_world);
+}
+
 #define ROCSHMEM_CTX_PUTMEM_SIGNAL_DEF(SUFFIX)                                            \
   __device__ void rocshmem_ctx_putmem_signal##SUFFIX(rocshmem_ctx_t ctx,                 \
                                                       void *dest, const void *source,      \
@@ -931,6 +1042,9 @@ __device__ int rocshmem_team_translate_pe(rocshmem_team_t src_team,
  */
 #define REDUCTION_GEN(T, Op)                                                   \
   template __device__ int rocshmem_wg_reduce<T, Op>(                           \
+      rocshmem_ctx_t ctx, rocshmem_team_t team, T * dest, const T *source,     \
+      int nreduce);                                                            \
+  template __device__ int rocshmem_grid_reduce<T, Op>(                         \
       rocshmem_ctx_t ctx, rocshmem_team_t team, T * dest, const T *source,     \
       int nreduce);
 
@@ -969,6 +1083,15 @@ __device__ int rocshmem_team_translate_pe(rocshmem_team_t src_team,
   template __device__ void rocshmem_wg_fcollect<T>(                            \
       rocshmem_ctx_t ctx, rocshmem_team_t team, T * dest, const T *source,     \
       int nelem);                                                              \
+  template __device__ void rocshmem_grid_broadcast<T>(                         \
+      rocshmem_ctx_t ctx, rocshmem_team_t team, T * dest, const T *source,     \
+      int nelem, int pe_root);                                                 \
+  template __device__ void rocshmem_grid_alltoall<T>(                          \
+      rocshmem_ctx_t ctx, rocshmem_team_t team, T * dest, const T *source,     \
+      int nelem);                                                              \
+  template __device__ void rocshmem_grid_fcollect<T>(                          \
+      rocshmem_ctx_t ctx, rocshmem_team_t team, T * dest, const T *source,     \
+      int nelem);                                                              \
   template __device__ void rocshmem_put_wave<T>(                               \
       rocshmem_ctx_t ctx, T * dest, const T *source, size_t nelems, int pe);   \
   template __device__ void rocshmem_put_wg<T>(                                 \
@@ -1000,7 +1123,31 @@ __device__ int rocshmem_team_translate_pe(rocshmem_team_t src_team,
   template __device__ void rocshmem_get_nbi_wave<T>(                           \
       T * dest, const T *source, size_t nelems, int pe);                       \
   template __device__ void rocshmem_get_nbi_wg<T>(T * dest, const T *source,   \
-                                                   size_t nelems, int pe);
+                                                   size_t nelems, int pe);     \
+  template __device__ void rocshmem_iput<T>(                                   \
+      rocshmem_ctx_t ctx, T * dest, const T *source, ptrdiff_t dst,            \
+      ptrdiff_t sst, size_t nelems, int pe);                                   \
+  template __device__ void rocshmem_iget<T>(                                   \
+      rocshmem_ctx_t ctx, T * dest, const T *source, ptrdiff_t dst,            \
+      ptrdiff_t sst, size_t nelems, int pe);                                   \
+  template __device__ void rocshmem_iput<T>(T * dest, const T *source,         \
+                                             ptrdiff_t dst, ptrdiff_t sst,     \
+                                             size_t nelems, int pe);           \
+  template __device__ void rocshmem_iget<T>(T * dest, const T *source,         \
+                                             ptrdiff_t dst, ptrdiff_t sst,     \
+                                             size_t nelems, int pe);           \
+  template __device__ void rocshmem_iput_wave<T>(                              \
+      rocshmem_ctx_t ctx, T * dest, const T *source, ptrdiff_t dst,            \
+      ptrdiff_t sst, size_t nelems, int pe);                                   \
+  template __device__ void rocshmem_iget_wave<T>(                              \
+      rocshmem_ctx_t ctx, T * dest, const T *source, ptrdiff_t dst,            \
+      ptrdiff_t sst, size_t nelems, int pe);                                   \
+  template __device__ void rocshmem_iput_wave<T>(                              \
+      T * dest, const T *source, ptrdiff_t dst, ptrdiff_t sst, size_t nelems,  \
+      int pe);                                                                 \
+  template __device__ void rocshmem_iget_wave<T>(                              \
+      T * dest, const T *source, ptrdiff_t dst, ptrdiff_t sst, size_t nelems,  \
+      int pe);
 
 /**
  * Declare templates for the standard amo types
@@ -1142,6 +1289,11 @@ __device__ int rocshmem_team_translate_pe(rocshmem_team_t src_team,
       rocshmem_ctx_t ctx, rocshmem_team_t team, T *dest, const T *source,     \
       int nreduce) {                                                          \
     return rocshmem_wg_reduce<T, Op>(ctx, team, dest, source, nreduce);       \
+  }                                                                           \
+  __device__ int rocshmem_ctx_##TNAME##_##Op_API##_grid_reduce(               \
+      rocshmem_ctx_t ctx, rocshmem_team_t team, T *dest, const T *source,     \
+      int nreduce) {                                                          \
+    return rocshmem_grid_reduce<T, Op>(ctx, team, dest, source, nreduce);     \
   }
 
 #define ARITH_REDUCTION_DEF_GEN(T, TNAME)         \
@@ -1272,6 +1424,46 @@ __device__ int rocshmem_team_translate_pe(rocshmem_team_t src_team,
                                                  size_t nelems, int pe) {     \
     rocshmem_get_nbi_wg<T>(dest, source, nelems, pe);                         \
   }                                                                           \
+  __device__ void rocshmem_ctx_##TNAME##_iput(                                \
+      rocshmem_ctx_t ctx, T *dest, const T *source, ptrdiff_t dst,            \
+      ptrdiff_t sst, size_t nelems, int pe) {                                 \
+    rocshmem_iput<T>(ctx, dest, source, dst, sst, nelems, pe);                \
+  }                                                                           \
+  __device__ void rocshmem_ctx_##TNAME##_iget(                                \
+      rocshmem_ctx_t ctx, T *dest, const T *source, ptrdiff_t dst,            \
+      ptrdiff_t sst, size_t nelems, int pe) {                                 \
+    rocshmem_iget<T>(ctx, dest, source, dst, sst, nelems, pe);                \
+  }                                                                           \
+  __device__ void rocshmem_##TNAME##_iput(T *dest, const T *source,           \
+                                           ptrdiff_t dst, ptrdiff_t sst,      \
+                                           size_t nelems, int pe) {           \
+    rocshmem_iput<T>(dest, source, dst, sst, nelems, pe);                     \
+  }                                                                           \
+  __device__ void rocshmem_##TNAME##_iget(T *dest, const T *source,           \
+                                           ptrdiff_t dst, ptrdiff_t sst,      \
+                                           size_t nelems, int pe) {           \
+    rocshmem_iget<T>(dest, source, dst, sst, nelems, pe);                     \
+  }                                                                           \
+  __device__ void rocshmem_ctx_##TNAME##_iput_wave(                           \
+      rocshmem_ctx_t ctx, T *dest, const T *source, ptrdiff_t dst,            \
+      ptrdiff_t sst, size_t nelems, int pe) {                                 \
+    rocshmem_iput_wave<T>(ctx, dest, source, dst, sst, nelems, pe);           \
+  }                                                                           \
+  __device__ void rocshmem_ctx_##TNAME##_iget_wave(                           \
+      rocshmem_ctx_t ctx, T *dest, const T *source, ptrdiff_t dst,            \
+      ptrdiff_t sst, size_t nelems, int pe) {                                 \
+    rocshmem_iget_wave<T>(ctx, dest, source, dst, sst, nelems, pe);           \
+  }                                                                           \
+  __device__ void rocshmem_##TNAME##_iput_wave(                               \
+      T *dest, const T *source, ptrdiff_t dst, ptrdiff_t sst, size_t nelems,  \
+      int pe) {                                                               \
+    rocshmem_iput_wave<T>(dest, source, dst, sst, nelems, pe);                \
+  }                                                                           \
+  __device__ void rocshmem_##TNAME##_iget_wave(                               \
+      T *dest, const T *source, ptrdiff_t dst, ptrdiff_t sst, size_t nelems,  \
+      int pe) {                                                               \
+    rocshmem_iget_wave<T>(dest, source, dst, sst, nelems, pe);                \
+  }                                                                           \
   __device__ void rocshmem_ctx_##TNAME##_wg_broadcast(                        \
       rocshmem_ctx_t ctx, rocshmem_team_t team, T *dest, const T *source,     \
       int nelem, int pe_root) {                                               \
@@ -1286,6 +1478,21 @@ __device__ int rocshmem_team_translate_pe(rocshmem_team_t src_team,
       rocshmem_ctx_t ctx, rocshmem_team_t team, T *dest, const T *source,     \
       int nelem) {                                                            \
     rocshmem_wg_fcollect<T>(ctx, team, dest, source, nelem);                  \
+  }                                                                           \
+  __device__ void rocshmem_ctx_##TNAME##_grid_broadcast(                      \
+      rocshmem_ctx_t ctx, rocshmem_team_t team, T *dest, const T *source,     \
+      int nelem, int pe_root) {                                               \
+    rocshmem_grid_broadcast<T>(ctx, team, dest, source, nelem, pe_root);      \
+  }                                                                           \
+  __device__ void rocshmem_ctx_##TNAME##_grid_alltoall(                       \
+      rocshmem_ctx_t ctx, rocshmem_team_t team, T *dest, const T *source,     \
+      int nelem) {                                                            \
+    rocshmem_grid_alltoall<T>(ctx, team, dest, source, nelem);                \
+  }                                                                           \
+  __device__ void rocshmem_ctx_##TNAME##_grid_fcollect(                       \
+      rocshmem_ctx_t ctx, rocshmem_team_t team, T *dest, const T *source,     \
+      int nelem) {                                                            \
+    rocshmem_grid_fcollect<T>(ctx, team, dest, source, nelem);                \
   }
 
 #define AMO_STANDARD_DEF_GEN(T, TNAME)                                        \
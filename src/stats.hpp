@@ -88,6 +88,11 @@ enum rocshmem_stats {
   NUM_PUT_SIGNAL_NBI,
   NUM_PUT_SIGNAL_NBI_WG,
   NUM_PUT_SIGNAL_NBI_WAVE,
+  NUM_IPUT,
+  NUM_IGET,
+  NUM_IPUT_WAVE,
+  NUM_IGET_WAVE,
+  NUM_HOST_CALLBACK,
   NUM_STATS
 };
 
@@ -129,6 +134,12 @@ enum rocshmem_host_stats {
   NUM_HOST_SHMEM_PTR,
   NUM_HOST_SYNC_ALL,
   NUM_HOST_BROADCAST,
+  NUM_HOST_ALLTOALL,
+  NUM_HOST_ALLTOALLV,
+  NUM_HOST_FCOLLECT,
+  NUM_HOST_IPUT,
+  NUM_HOST_IGET,
+  NUM_HOST_BATCH,
   NUM_HOST_STATS
 };
 
@@ -0,0 +1,344 @@
+/******************************************************************************
+ * Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+
+#ifndef LIBRARY_SRC_SYNC_ALLREDUCE_SCHEDULE_HPP_
+#define LIBRARY_SRC_SYNC_ALLREDUCE_SCHEDULE_HPP_
+
+#include <hip/hip_runtime.h>
+
+#include <cstddef>
+
+/**
+ * @file allreduce_schedule.hpp
+ *
+ * @brief Algorithm choice and step schedules of the device allreduce
+ *
+ * Ranks are positions in the team (0 .. n_pes - 1). Non-power-of-two teams
+ * are folded: with pof2 the largest power of two not above n_pes and
+ * rem = n_pes - pof2, the first 2 * rem ranks pair up, the even rank of
+ * each pair hands its vector to the odd one in the first step and gets the
+ * result back in the last step, and the remaining pof2 ranks run the power
+ * of two algorithm:
+ *  - RECURSIVE_DOUBLING: log2(pof2) exchanges of the whole vector.
+ *  - RABENSEIFNER: a recursive-halving reduce-scatter leaves rank r with
+ *    block r of pof2 blocks, then a recursive-doubling allgather.
+ *
+ * A vector is processed in passes of at most allreduce_pass_elems
+ * elements. Every step of a pass that combines data receives it into its
+ * own workspace slot, and consecutive passes alternate between two
+ * workspace halves and two sets of flags, so a peer running a pass ahead
+ * never overwrites data that is still being combined.
+ */
+
+namespace rocshmem {
+
+enum class AllreduceAlgorithm {
+  NONE,
+  DIRECT,
+  RING,
+  RECURSIVE_DOUBLING,
+  RABENSEIFNER,
+};
+
+/**
+ * @brief Cost of one synchronized step, in bytes moved
+ *
+ * Used by allreduce_select to weigh the number of flag round trips of an
+ * algorithm against the volume of data each PE sends.
+ */
+constexpr size_t ALLREDUCE_STEP_COST_BYTES = 32768;
+
+/**
+ * @brief One step of a rank's allreduce schedule
+ *
+ * The rank sends [send_offset, send_offset + send_count) of its vector to
+ * peer and/or receives [recv_offset, recv_offset + recv_count) from it.
+ * When reduce is set, the data lands in workspace slot wrk_offset of the
+ * receiver and is combined into its vector; otherwise it lands directly in
+ * the receiver's vector. Both sides of a step compute the same wrk_offset.
+ */
+struct AllreduceStep {
+  int peer{-1};
+  bool sends{false};
+  bool recvs{false};
+  bool reduce{false};
+  int send_offset{0};
+  int send_count{0};
+  int recv_offset{0};
+  int recv_count{0};
+  int wrk_offset{0};
+};
+
+__host__ __device__ inline int allreduce_pof2(int n_pes) {
+  int pof2{1};
+  while (pof2 * 2 <= n_pes) {
+    pof2 *= 2;
+  }
+  return pof2;
+}
+
+__host__ __device__ inline int allreduce_log2(int pof2) {
+  int log{0};
+  while ((1 << log) < pof2) {
+    log++;
+  }
+  return log;
+}
+
+/**
+ * @brief Steps of one pass, including the fold and unfold steps
+ *
+ * The fold and unfold steps are idle for every rank of a power-of-two
+ * team.
+ */
+__host__ __device__ inline int allreduce_num_steps(AllreduceAlgorithm algo,
+                                                   int n_pes) {
+  int log{allreduce_log2(allreduce_pof2(n_pes))};
+  if (algo == AllreduceAlgorithm::RECURSIVE_DOUBLING) {
+    return log + 2;
+  }
+  return 2 * log + 2;
+}
+
+/**
+ * @brief Rank among the pof2 ranks of the core algorithm, -1 if folded
+ */
+__host__ __device__ inline int allreduce_core_rank(int rank, int n_pes) {
+  int rem{n_pes - allreduce_pof2(n_pes)};
+  if (rank < 2 * rem) {
+    return (rank & 1) ? rank / 2 : -1;
+  }
+  return rank - rem;
+}
+
+__host__ __device__ inline int allreduce_team_rank(int core_rank,
+                                                   int n_pes) {
+  int rem{n_pes - allreduce_pof2(n_pes)};
+  return (core_rank < rem) ? 2 * core_rank + 1 : core_rank + rem;
+}
+
+/**
+ * @brief First element of block @p block when @p count elements are split
+ * into @p pof2 blocks
+ */
+__host__ __device__ inline int allreduce_block_offset(int block, int count,
+                                                      int pof2) {
+  return static_cast<int>(static_cast<long long>(block) * count / pof2);
+}
+
+/**
+ * @brief Workspace elements one pass of @p count elements needs
+ */
+__host__ __device__ inline int allreduce_pass_wrk_elems(
+    AllreduceAlgorithm algo, int n_pes, int count) {
+  int pof2{allreduce_pof2(n_pes)};
+  if (algo == AllreduceAlgorithm::RECURSIVE_DOUBLING) {
+    return count * (allreduce_log2(pof2) + 1);
+  }
+  int block{(count + pof2 - 1) / pof2};
+  return count + block * (pof2 - 1);
+}
+
+/**
+ * @brief Largest pass which fits twice in @p wrk_elems workspace elements
+ *
+ * @return Elements per pass, 0 if not even one element per block fits
+ */
+__host__ __device__ inline int allreduce_pass_elems(AllreduceAlgorithm algo,
+                                                    int n_pes,
+                                                    int wrk_elems) {
+  int half{wrk_elems / 2};
+  int pof2{allreduce_pof2(n_pes)};
+  int count{0};
+  if (algo == AllreduceAlgorithm::RECURSIVE_DOUBLING) {
+    count = half / (allreduce_log2(pof2) + 1);
+  } else {
+    count = (half - (pof2 - 1)) / 2;
+  }
+  return (count > 0) ? count : 0;
+}
+
+/**
+ * @brief Step @p step of @p rank for a pass of @p count elements
+ */
+__host__ __device__ inline AllreduceStep allreduce_step(
+    AllreduceAlgorithm algo, int rank, int n_pes, int count, int step) {
+  AllreduceStep s;
+  int pof2{allreduce_pof2(n_pes)};
+  int rem{n_pes - pof2};
+  int log{allreduce_log2(pof2)};
+  int last{allreduce_num_steps(algo, n_pes) - 1};
+
+  if (step == 0 || step == last) {
+    if (rank >= 2 * rem) {
+      return s;
+    }
+    bool odd{(rank & 1) != 0};
+    s.peer = odd ? rank - 1 : rank + 1;
+    s.reduce = (step == 0);
+    /* Fold: even to odd; unfold: odd to even */
+    s.sends = (step == 0) ? !odd : odd;
+    s.recvs = !s.sends;
+    if (s.sends) {
+      s.send_count = count;
+    } else {
+      s.recv_count = count;
+    }
+    return s;
+  }
+
+  int core{allreduce_core_rank(rank, n_pes)};
+  if (core < 0) {
+    return s;
+  }
+  s.sends = true;
+  s.recvs = true;
+
+  if (algo == AllreduceAlgorithm::RECURSIVE_DOUBLING) {
+    int k{step - 1};
+    s.peer = allreduce_team_rank(core ^ (1 << k), n_pes);
+    s.reduce = true;
+    s.send_count = count;
+    s.recv_count = count;
+    s.wrk_offset = count * (k + 1);
+    return s;
+  }
+
+  int block{(count + pof2 - 1) / pof2};
+  if (step <= log) {
+    /* Reduce-scatter: halve the window, keep the half holding core */
+    int k{step - 1};
+    int dist{pof2 >> (k + 1)};
+    int lo{core & ~(2 * dist - 1)};
+    int keep{(core & dist) ? lo + dist : lo};
+    int give{(core & dist) ? lo : lo + dist};
+    s.peer = allreduce_team_rank(core ^ dist, n_pes);
+    s.reduce = true;
+    s.send_offset = allreduce_block_offset(give, count, pof2);
+    s.send_count = allreduce_block_offset(give + dist, count, pof2) -
+                   s.send_offset;
+    s.recv_offset = allreduce_block_offset(keep, count, pof2);
+    s.recv_count = allreduce_block_offset(keep + dist, count, pof2) -
+                   s.recv_offset;
+    s.wrk_offset = count + block * (pof2 - 2 * dist);
+    return s;
+  }
+
+  /* Allgather: swap the owned windows, doubling them */
+  int k{step - 1 - log};
+  int dist{1 << k};
+  int partner{core ^ dist};
+  int mine{core & ~(dist - 1)};
+  int theirs{partner & ~(dist - 1)};
+  s.peer = allreduce_team_rank(partner, n_pes);
+  s.send_offset = allreduce_block_offset(mine, count, pof2);
+  s.send_count = allreduce_block_offset(mine + dist, count, pof2) -
+                 s.send_offset;
+  s.recv_offset = allreduce_block_offset(theirs, count, pof2);
+  s.recv_count = allreduce_block_offset(theirs + dist, count, pof2) -
+                 s.recv_offset;
+  return s;
+}
+
+/**
+ * @brief Modeled cost of an allreduce, in bytes moved
+ *
+ * @return 0 if the algorithm does not fit in the work and sync arrays
+ */
+__host__ __device__ inline size_t allreduce_cost(AllreduceAlgorithm algo,
+                                                 int n_pes, size_t nelems,
+                                                 size_t elem_size,
+                                                 size_t wrk_elems,
+                                                 size_t sync_slots) {
+  size_t bytes{nelems * elem_size};
+  size_t pes{static_cast<size_t>(n_pes)};
+  size_t pof2{static_cast<size_t>(allreduce_pof2(n_pes))};
+  size_t fold{(pes > pof2) ? 2 * bytes : 0};
+
+  switch (algo) {
+    case AllreduceAlgorithm::DIRECT:
+      if (pes * nelems > wrk_elems || pes > sync_slots) {
+        return 0;
+      }
+      return ALLREDUCE_STEP_COST_BYTES + (pes - 1) * bytes;
+    case AllreduceAlgorithm::RING: {
+      size_t seg{(wrk_elems / pes) * pes};
+      if (2 * pes > sync_slots || seg == 0) {
+        return 0;
+      }
+      size_t segs{(nelems + seg - 1) / seg};
+      return segs * 2 * (pes - 1) * ALLREDUCE_STEP_COST_BYTES +
+             2 * bytes * (pes - 1) / pes;
+    }
+    case AllreduceAlgorithm::RECURSIVE_DOUBLING:
+    case AllreduceAlgorithm::RABENSEIFNER: {
+      size_t steps{static_cast<size_t>(allreduce_num_steps(algo, n_pes))};
+      size_t pass{static_cast<size_t>(
+          allreduce_pass_elems(algo, n_pes, static_cast<int>(wrk_elems)))};
+      if (2 * steps > sync_slots || pass == 0) {
+        return 0;
+      }
+      size_t passes{(nelems + pass - 1) / pass};
+      size_t active{(pes > pof2) ? steps : steps - 2};
+      size_t log{static_cast<size_t>(allreduce_log2(static_cast<int>(pof2)))};
+      size_t volume{(algo == AllreduceAlgorithm::RECURSIVE_DOUBLING)
+                        ? log * bytes
+                        : 2 * bytes * (pof2 - 1) / pof2};
+      return passes * active * ALLREDUCE_STEP_COST_BYTES + volume + fold;
+    }
+    default:
+      return 0;
+  }
+}
+
+/**
+ * @brief Cheapest allreduce algorithm which fits in the work and sync
+ * arrays
+ *
+ * @param[in] wrk_elems  Elements of the work array.
+ * @param[in] sync_slots Entries of the sync array.
+ *
+ * @return NONE if no algorithm fits
+ */
+__host__ __device__ inline AllreduceAlgorithm allreduce_select(
+    int n_pes, size_t nelems, size_t elem_size, size_t wrk_elems,
+    size_t sync_slots) {
+  const AllreduceAlgorithm candidates[]{
+      AllreduceAlgorithm::DIRECT, AllreduceAlgorithm::RECURSIVE_DOUBLING,
+      AllreduceAlgorithm::RABENSEIFNER, AllreduceAlgorithm::RING};
+
+  AllreduceAlgorithm best{AllreduceAlgorithm::NONE};
+  size_t best_cost{0};
+  for (AllreduceAlgorithm algo : candidates) {
+    size_t cost{allreduce_cost(algo, n_pes, nelems, elem_size, wrk_elems,
+                               sync_slots)};
+    if (cost && (best == AllreduceAlgorithm::NONE || cost < best_cost)) {
+      best = algo;
+      best_cost = cost;
+    }
+  }
+  return best;
+}
+
+}  // namespace rocshmem
+
+#endif  // LIBRARY_SRC_SYNC_ALLREDUCE_SCHEDULE_HPP_
@@ -0,0 +1,100 @@
+/******************************************************************************
+ * Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+
+#ifndef LIBRARY_SRC_SYNC_ALLTOALL_SCHEDULE_HPP_
+#define LIBRARY_SRC_SYNC_ALLTOALL_SCHEDULE_HPP_
+
+#include <hip/hip_runtime.h>
+
+#include <cstddef>
+
+/**
+ * @file alltoall_schedule.hpp
+ *
+ * @brief Peer order of the alltoall and fcollect exchanges
+ *
+ * With the linear order every PE writes to team rank 0 first, then rank 1,
+ * and so on, so all traffic of a step converges on one PE. The pairwise
+ * order has rank r write to alltoall_peer(r, step) in step step, which is
+ * a permutation of the team for every step: each PE receives from exactly
+ * one peer per step and every link carries traffic at the same time.
+ */
+
+namespace rocshmem {
+
+enum class AlltoallSchedule {
+  AUTO,
+  LINEAR,
+  PAIRWISE,
+  /**
+   * Pairwise order with the steps spread across the wavefronts of the
+   * workgroup, so several peers are written to concurrently.
+   */
+  PAIRWISE_WAVE,
+};
+
+/**
+ * @brief Largest per-peer block for which PAIRWISE_WAVE is chosen
+ *
+ * Larger blocks keep the whole workgroup on one copy at a time.
+ */
+constexpr size_t ALLTOALL_WAVE_MAX_BYTES = 16384;
+
+/**
+ * @brief Peer of @p rank in step @p step (0 .. n_pes - 1)
+ *
+ * XOR pairing for power-of-two teams, so the two PEs of a step exchange
+ * with each other; a cyclic shift otherwise. Step 0 is the PE itself.
+ */
+__host__ __device__ inline int alltoall_peer(int rank, int step, int n_pes) {
+  if ((n_pes & (n_pes - 1)) == 0) {
+    return rank ^ step;
+  }
+  return (rank + step) % n_pes;
+}
+
+/**
+ * @brief Schedule for blocks of @p bytes_per_peer on a workgroup of
+ * @p num_waves wavefronts
+ *
+ * @param[in] forced Schedule requested through ROCSHMEM_ALLTOALL_SCHEDULE,
+ *                   AUTO to let the size decide.
+ */
+__host__ __device__ inline AlltoallSchedule alltoall_select(
+    AlltoallSchedule forced, int n_pes, size_t bytes_per_peer,
+    int num_waves) {
+  if (forced == AlltoallSchedule::PAIRWISE_WAVE && num_waves < 2) {
+    return AlltoallSchedule::PAIRWISE;
+  }
+  if (forced != AlltoallSchedule::AUTO) {
+    return forced;
+  }
+  if (n_pes > 2 && num_waves > 1 &&
+      bytes_per_peer <= ALLTOALL_WAVE_MAX_BYTES) {
+    return AlltoallSchedule::PAIRWISE_WAVE;
+  }
+  return AlltoallSchedule::PAIRWISE;
+}
+
+}  // namespace rocshmem
+
+#endif  // LIBRARY_SRC_SYNC_ALLTOALL_SCHEDULE_HPP_
@@ -0,0 +1,180 @@
+/******************************************************************************
+ * Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+
+#ifndef LIBRARY_SRC_SYNC_BARRIER_SCHEDULE_HPP_
+#define LIBRARY_SRC_SYNC_BARRIER_SCHEDULE_HPP_
+
+#include <hip/hip_runtime.h>
+
+#include "rocshmem/rocshmem_common.hpp"
+
+/**
+ * @file barrier_schedule.hpp
+ *
+ * @brief Communication schedules of the device team barriers
+ *
+ * The functions only do rank arithmetic, so the same schedule drives the
+ * device barriers and the host simulation in the unit tests. Ranks are
+ * positions in the team (0 .. n_pes - 1); callers translate them to world
+ * PEs with PE_start + rank * stride.
+ */
+
+namespace rocshmem {
+
+/**
+ * @brief Barrier algorithms for team synchronization
+ *
+ * DIRECT: rank 0 waits on a flag per PE, then releases every PE.
+ * TREE: arrivals are gathered and releases fanned out along a
+ *       BARRIER_TREE_RADIX-ary tree rooted at rank 0.
+ * DISSEMINATION: in round r every rank signals rank + 2^r and waits for
+ *                rank - 2^r, for ceil(log2(n_pes)) rounds.
+ * AUTO: only requested, never selected; the team size decides.
+ */
+enum class BarrierKind {
+  AUTO,
+  DIRECT,
+  TREE,
+  DISSEMINATION,
+};
+
+/**
+ * @brief Smallest team which uses the tree barrier
+ */
+constexpr int BARRIER_TREE_MIN_PES = 16;
+
+/**
+ * @brief Smallest team which uses the dissemination barrier
+ */
+constexpr int BARRIER_DISSEMINATION_MIN_PES = 64;
+
+/**
+ * @brief Number of children of an interior node of the tree barrier
+ */
+constexpr int BARRIER_TREE_RADIX = 4;
+
+/**
+ * @brief pSync slot of the tree barrier's release flag
+ *
+ * The arrival flag of child i lives in slot BARRIER_TREE_ARRIVAL_SLOT + i.
+ */
+constexpr int BARRIER_TREE_RELEASE_SLOT = 0;
+constexpr int BARRIER_TREE_ARRIVAL_SLOT = 1;
+
+static_assert(BARRIER_TREE_ARRIVAL_SLOT + BARRIER_TREE_RADIX <=
+                  static_cast<int>(ROCSHMEM_BARRIER_SYNC_SIZE),
+              "tree barrier flags do not fit in pSync");
+static_assert(BARRIER_TREE_MIN_PES <=
+                  static_cast<int>(ROCSHMEM_BARRIER_SYNC_SIZE),
+              "direct barrier flags do not fit in pSync");
+
+__host__ __device__ inline BarrierKind barrier_kind(int n_pes) {
+  if (n_pes < BARRIER_TREE_MIN_PES) {
+    return BarrierKind::DIRECT;
+  }
+  if (n_pes < BARRIER_DISSEMINATION_MIN_PES) {
+    return BarrierKind::TREE;
+  }
+  return BarrierKind::DISSEMINATION;
+}
+
+/**
+ * @brief Barrier for a team of @p n_pes
+ *
+ * @param[in] forced Barrier requested through ROCSHMEM_BARRIER_KIND,
+ *                   AUTO to let the team size decide. DIRECT is ignored
+ *                   for teams whose flags do not fit in pSync.
+ */
+__host__ __device__ inline BarrierKind barrier_select(BarrierKind forced,
+                                                      int n_pes) {
+  if (forced == BarrierKind::DIRECT &&
+      n_pes > static_cast<int>(ROCSHMEM_BARRIER_SYNC_SIZE)) {
+    return barrier_kind(n_pes);
+  }
+  if (forced != BarrierKind::AUTO) {
+    return forced;
+  }
+  return barrier_kind(n_pes);
+}
+
+/**
+ * @brief Number of dissemination rounds, ceil(log2(n_pes))
+ *
+ * Round r uses pSync slot r, so at most 31 slots are needed.
+ */
+__host__ __device__ inline int dissemination_rounds(int n_pes) {
+  int rounds{0};
+  while ((1 << rounds) < n_pes) {
+    rounds++;
+  }
+  return rounds;
+}
+
+/**
+ * @brief Rank signaled by @p rank in @p round
+ */
+__host__ __device__ inline int dissemination_to(int rank, int round,
+                                                int n_pes) {
+  return (rank + (1 << round)) % n_pes;
+}
+
+/**
+ * @brief Rank which signals @p rank in @p round
+ */
+__host__ __device__ inline int dissemination_from(int rank, int round,
+                                                  int n_pes) {
+  return (rank + n_pes - (1 << round)) % n_pes;
+}
+
+/**
+ * @brief Parent of a non-root @p rank in the tree barrier
+ */
+__host__ __device__ inline int tree_parent(int rank, int radix) {
+  return (rank - 1) / radix;
+}
+
+/**
+ * @brief Position of a non-root @p rank among its parent's children
+ */
+__host__ __device__ inline int tree_child_index(int rank, int radix) {
+  return (rank - 1) % radix;
+}
+
+/**
+ * @brief First child of @p rank; the children are consecutive ranks
+ */
+__host__ __device__ inline int tree_first_child(int rank, int radix) {
+  return rank * radix + 1;
+}
+
+__host__ __device__ inline int tree_num_children(int rank, int radix,
+                                                 int n_pes) {
+  int first{tree_first_child(rank, radix)};
+  if (first >= n_pes) {
+    return 0;
+  }
+  return (n_pes - first < radix) ? n_pes - first : radix;
+}
+
+}  // namespace rocshmem
+
+#endif  // LIBRARY_SRC_SYNC_BARRIER_SCHEDULE_HPP_
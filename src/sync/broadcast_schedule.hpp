@@ -0,0 +1,112 @@
+/******************************************************************************
+ * Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+
+#ifndef LIBRARY_SRC_SYNC_BROADCAST_SCHEDULE_HPP_
+#define LIBRARY_SRC_SYNC_BROADCAST_SCHEDULE_HPP_
+
+#include <hip/hip_runtime.h>
+
+#include "rocshmem/rocshmem_common.hpp"
+
+/**
+ * @file broadcast_schedule.hpp
+ *
+ * @brief Forwarding topologies of the pipelined broadcast
+ *
+ * Ranks are virtual: vrank 0 is the root and the others follow it around
+ * the team. The buffer is cut into chunks, and every PE forwards each
+ * chunk to its children as soon as it has arrived from its parent.
+ *  - CHAIN: vrank v forwards to v + 1. Every PE sends each chunk once, so
+ *    the bandwidth is the link rate, after n_pes - 2 chunks of fill.
+ *  - BINARY_TREE: vrank v forwards to 2v + 1 and 2v + 2. Interior PEs send
+ *    each chunk twice, but the fill is only the depth of the tree.
+ */
+
+namespace rocshmem {
+
+enum class BroadcastTopology {
+  CHAIN,
+  BINARY_TREE,
+};
+
+/**
+ * @brief pSync slot holding the number of chunks received
+ *
+ * The last slot is clear of the barrier closing the broadcast.
+ */
+constexpr int BROADCAST_FLAG_SLOT = ROCSHMEM_BCAST_SYNC_SIZE - 1;
+
+/**
+ * @brief Default bytes per chunk (ROCSHMEM_BCAST_CHUNK_SIZE)
+ */
+constexpr size_t BROADCAST_DEFAULT_CHUNK_SIZE = 1 << 16;
+
+__host__ __device__ inline int broadcast_tree_depth(int n_pes) {
+  int depth{0};
+  while ((2 << depth) - 1 < n_pes) {
+    depth++;
+  }
+  return depth;
+}
+
+/**
+ * @brief Topology with the lower modeled time, in chunk transfers
+ *
+ * The chain takes n_pes - 2 + num_chunks transfers, the tree about
+ * 2 * (num_chunks + depth - 1).
+ */
+__host__ __device__ inline BroadcastTopology broadcast_topology(
+    int n_pes, int num_chunks) {
+  int chain{n_pes - 2 + num_chunks};
+  int tree{2 * (num_chunks + broadcast_tree_depth(n_pes) - 1)};
+  return (chain <= tree) ? BroadcastTopology::CHAIN
+                         : BroadcastTopology::BINARY_TREE;
+}
+
+__host__ __device__ inline int broadcast_parent(int vrank,
+                                                BroadcastTopology topo) {
+  if (vrank == 0) {
+    return -1;
+  }
+  return (topo == BroadcastTopology::CHAIN) ? vrank - 1 : (vrank - 1) / 2;
+}
+
+__host__ __device__ inline int broadcast_num_children(int vrank, int n_pes,
+                                                      BroadcastTopology topo) {
+  int first{(topo == BroadcastTopology::CHAIN) ? vrank + 1 : 2 * vrank + 1};
+  int fanout{(topo == BroadcastTopology::CHAIN) ? 1 : 2};
+  int children{n_pes - first};
+  if (children < 0) {
+    return 0;
+  }
+  return (children < fanout) ? children : fanout;
+}
+
+__host__ __device__ inline int broadcast_child(int vrank, int index,
+                                               BroadcastTopology topo) {
+  return (topo == BroadcastTopology::CHAIN) ? vrank + 1
+                                            : 2 * vrank + 1 + index;
+}
+
+}  // namespace rocshmem
+
+#endif  // LIBRARY_SRC_SYNC_BROADCAST_SCHEDULE_HPP_
@@ -0,0 +1,92 @@
+/******************************************************************************
+ * Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+
+#ifndef LIBRARY_SRC_SYNC_GRID_PARTITION_HPP_
+#define LIBRARY_SRC_SYNC_GRID_PARTITION_HPP_
+
+#include <hip/hip_runtime.h>
+
+#include <cstddef>
+
+/**
+ * @file grid_partition.hpp
+ *
+ * @brief Split of a buffer across the workgroups of a grid collective
+ *
+ * The grid collectives hand every workgroup one contiguous slice of the
+ * buffer. Slices are whole multiples of GRID_SLICE_BYTES, except for the
+ * one holding the end of the buffer, so no two workgroups write the same
+ * cache line and every slice starts aligned for the vectorized copies.
+ */
+
+namespace rocshmem {
+
+/**
+ * @brief Granularity of the slices in bytes
+ */
+constexpr size_t GRID_SLICE_BYTES = 256;
+
+/**
+ * @brief Elements [offset, offset + count) of a buffer
+ */
+struct GridSlice {
+  size_t offset;
+  size_t count;
+};
+
+/**
+ * @brief Slice @p part of @p num_parts of a buffer of @p nelems elements
+ * of @p elem_size bytes
+ *
+ * The slices are in order, disjoint and cover the buffer. Their sizes
+ * differ by at most one granule; parts past the end of a short buffer
+ * get an empty slice.
+ */
+__host__ __device__ inline GridSlice grid_slice(size_t part,
+                                                size_t num_parts,
+                                                size_t nelems,
+                                                size_t elem_size) {
+  size_t granule = GRID_SLICE_BYTES / elem_size;
+  if (granule == 0) {
+    granule = 1;
+  }
+  size_t num_granules = (nelems + granule - 1) / granule;
+  size_t per_part = num_granules / num_parts;
+  size_t extra = num_granules % num_parts;
+
+  size_t first = part * per_part + (part < extra ? part : extra);
+  size_t granules = per_part + (part < extra ? 1 : 0);
+
+  size_t begin = first * granule;
+  size_t end = (first + granules) * granule;
+  if (begin > nelems) {
+    begin = nelems;
+  }
+  if (end > nelems) {
+    end = nelems;
+  }
+  return {begin, end - begin};
+}
+
+}  // namespace rocshmem
+
+#endif  // LIBRARY_SRC_SYNC_GRID_PARTITION_HPP_
@@ -202,6 +202,65 @@ template <typename T>
 __device__ void rocshmem_get_nbi(T *dest, const T *source, size_t nelems,
                                   int pe);
 
+/**
+ * @brief Writes \p nelems elements from \p source, read with a stride of
+ * \p sst elements, to \p dest on \p pe, written with a stride of \p dst
+ * elements. The operation is blocking: the caller returns once \p source
+ * may be reused.
+ *
+ * This function can be called from divergent control paths at per-thread
+ * granularity.
+ *
+ * @param[in] ctx     Context with which to perform this operation.
+ * @param[in] dest    Destination address. Must be an address on the symmetric
+ *                    heap.
+ * @param[in] source  Source address. Must be an address on the symmetric heap.
+ * @param[in] dst     Stride between consecutive elements of \p dest.
+ * @param[in] sst     Stride between consecutive elements of \p source.
+ * @param[in] nelems  Number of elements to transfer.
+ * @param[in] pe      PE of the remote process.
+ *
+ * @return void.
+ *
+ */
+template <typename T>
+__device__ void rocshmem_iput(rocshmem_ctx_t ctx, T *dest, const T *source,
+                               ptrdiff_t dst, ptrdiff_t sst, size_t nelems,
+                               int pe);
+
+template <typename T>
+__device__ void rocshmem_iput(T *dest, const T *source, ptrdiff_t dst,
+                               ptrdiff_t sst, size_t nelems, int pe);
+
+/**
+ * @brief Reads \p nelems elements from \p source on \p pe, read with a
+ * stride of \p sst elements, into \p dest on the calling PE, written with a
+ * stride of \p dst elements. The operation is blocking.
+ *
+ * This function can be called from divergent control paths at per-thread
+ * granularity.
+ *
+ * @param[in] ctx     Context with which to perform this operation.
+ * @param[in] dest    Destination address. Must be an address on the symmetric
+ *                    heap.
+ * @param[in] source  Source address. Must be an address on the symmetric heap.
+ * @param[in] dst     Stride between consecutive elements of \p dest.
+ * @param[in] sst     Stride between consecutive elements of \p source.
+ * @param[in] nelems  Number of elements to transfer.
+ * @param[in] pe      PE of the remote process.
+ *
+ * @return void.
+ *
+ */
+template <typename T>
+__device__ void rocshmem_iget(rocshmem_ctx_t ctx, T *dest, const T *source,
+                               ptrdiff_t dst, ptrdiff_t sst, size_t nelems,
+                               int pe);
+
+template <typename T>
+__device__ void rocshmem_iget(T *dest, const T *source, ptrdiff_t dst,
+                               ptrdiff_t sst, size_t nelems, int pe);
+
 /**
  * @brief Atomically add the value \p val to \p dest on \p pe. The operation
  * returns the older value of \p dest to the calling PE.
@@ -661,6 +720,62 @@ template <typename T>
 __device__ void rocshmem_get_nbi_wave(T *dest, const T *source, size_t nelems,
                                         int pe);
 
+/**
+ * @brief Strided put like rocshmem_iput, with the elements spread across
+ * the lanes of the calling wavefront.
+ *
+ * This function can be called from divergent control paths at per-wave
+ * granularity. However, all threads in the wave must call in with the same args
+ *
+ * @param[in] ctx     Context with which to perform this operation.
+ * @param[in] dest    Destination address. Must be an address on the symmetric
+ *                    heap.
+ * @param[in] source  Source address. Must be an address on the symmetric heap.
+ * @param[in] dst     Stride between consecutive elements of \p dest.
+ * @param[in] sst     Stride between consecutive elements of \p source.
+ * @param[in] nelems  Number of elements to transfer.
+ * @param[in] pe      PE of the remote process.
+ *
+ * @return void.
+ *
+ */
+template <typename T>
+__device__ void rocshmem_iput_wave(rocshmem_ctx_t ctx, T *dest,
+                                    const T *source, ptrdiff_t dst,
+                                    ptrdiff_t sst, size_t nelems, int pe);
+
+template <typename T>
+__device__ void rocshmem_iput_wave(T *dest, const T *source, ptrdiff_t dst,
+                                    ptrdiff_t sst, size_t nelems, int pe);
+
+/**
+ * @brief Strided get like rocshmem_iget, with the elements spread across
+ * the lanes of the calling wavefront.
+ *
+ * This function can be called from divergent control paths at per-wave
+ * granularity. However, all threads in the wave must call in with the same args
+ *
+ * @param[in] ctx     Context with which to perform this operation.
+ * @param[in] dest    Destination address. Must be an address on the symmetric
+ *                    heap.
+ * @param[in] source  Source address. Must be an address on the symmetric heap.
+ * @param[in] dst     Stride between consecutive elements of \p dest.
+ * @param[in] sst     Stride between consecutive elements of \p source.
+ * @param[in] nelems  Number of elements to transfer.
+ * @param[in] pe      PE of the remote process.
+ *
+ * @return void.
+ *
+ */
+template <typename T>
+__device__ void rocshmem_iget_wave(rocshmem_ctx_t ctx, T *dest,
+                                    const T *source, ptrdiff_t dst,
+                                    ptrdiff_t sst, size_t nelems, int pe);
+
+template <typename T>
+__device__ void rocshmem_iget_wave(T *dest, const T *source, ptrdiff_t dst,
+                                    ptrdiff_t sst, size_t nelems, int pe);
+
 /**
  * @brief Reads contiguous data of \p nelems elements from \p source on \p pe
  * to \p dest on the calling PE. The operation is not blocking. The caller will
@@ -779,6 +894,18 @@ __device__ void rocshmem_get_nbi_wave(T *dest, const T *source, size_t nelems,
   rocshmem_get_nbi_wave(ROCSHMEM_CTX_DEFAULT, dest, source, nelems, pe);
 }
 
+template <typename T>
+__device__ void rocshmem_iput_wave(T *dest, const T *source, ptrdiff_t dst,
+                                    ptrdiff_t sst, size_t nelems, int pe) {
+  rocshmem_iput_wave(ROCSHMEM_CTX_DEFAULT, dest, source, dst, sst, nelems, pe);
+}
+
+template <typename T>
+__device__ void rocshmem_iget_wave(T *dest, const T *source, ptrdiff_t dst,
+                                    ptrdiff_t sst, size_t nelems, int pe) {
+  rocshmem_iget_wave(ROCSHMEM_CTX_DEFAULT, dest, source, dst, sst, nelems, pe);
+}
+
 }  // namespace rocshmem
 
 #endif  // LIBRARY_SRC_TEMPLATES_HPP_
@@ -81,6 +81,24 @@ template <typename T>
 __host__ void rocshmem_get_nbi(T *dest, const T *source, size_t nelems,
                                 int pe);
 
+template <typename T>
+__host__ void rocshmem_iput(rocshmem_ctx_t ctx, T *dest, const T *source,
+                             ptrdiff_t dst, ptrdiff_t sst, size_t nelems,
+                             int pe);
+
+template <typename T>
+__host__ void rocshmem_iput(T *dest, const T *source, ptrdiff_t dst,
+                             ptrdiff_t sst, size_t nelems, int pe);
+
+template <typename T>
+__host__ void rocshmem_iget(rocshmem_ctx_t ctx, T *dest, const T *source,
+                             ptrdiff_t dst, ptrdiff_t sst, size_t nelems,
+                             int pe);
+
+template <typename T>
+__host__ void rocshmem_iget(T *dest, const T *source, ptrdiff_t dst,
+                             ptrdiff_t sst, size_t nelems, int pe);
+
 template <typename T>
 __host__ T rocshmem_atomic_fetch_add(rocshmem_ctx_t ctx, T *dest, T val,
                                       int pe);
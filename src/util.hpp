@@ -32,6 +32,7 @@
 #include "assembly.hpp"
 #include "rocshmem_config.h"  // NOLINT(build/include_subdir)
 #include "constants.hpp"
+#include "memory/vector_copy.hpp"
 
 namespace rocshmem {
 
@@ -126,6 +127,13 @@ __device__ __forceinline__ int get_flat_grid_id() {
          hipBlockIdx_z * hipGridDim_x * hipGridDim_y;
 }
 
+/*
+ * Returns the number of thread blocks in the caller's grid.
+ */
+__device__ __forceinline__ int get_flat_grid_num_blocks() {
+  return hipGridDim_x * hipGridDim_y * hipGridDim_z;
+}
+
 /*
  * Returns the flattened thread index of the calling thread within the grid.
  */
@@ -261,6 +269,91 @@ __device__ __forceinline__ void memcpy_wave(void* dst, void* src, size_t size) {
   }
 }
 
+/*
+ * Copies split.body bytes of 16-byte vectors starting at dst and src, which
+ * must be 16-byte aligned. The calling lane is lane of num_lanes.
+ */
+__device__ __forceinline__ void memcpy_dwordx4(uint8_t* dst, uint8_t* src,
+                                               size_t body, size_t lane,
+                                               size_t num_lanes) {
+  dwordx4_t* src_vec{reinterpret_cast<dwordx4_t*>(src)};
+  for_each_vector_group(
+      lane, num_lanes, body / VECTOR_COPY_WIDTH,
+      [&](size_t first, size_t stride, int count) {
+        dwordx4_t vals[VECTOR_COPY_UNROLL];
+#pragma unroll
+        for (int k{0}; k < VECTOR_COPY_UNROLL; k++) {
+          if (k < count) {
+            vals[k] = src_vec[first + k * stride];
+          }
+        }
+#pragma unroll
+        for (int k{0}; k < VECTOR_COPY_UNROLL; k++) {
+          if (k < count) {
+            store_dwordx4_asm(
+                vals[k], dst + (first + k * stride) * VECTOR_COPY_WIDTH);
+          }
+        }
+      });
+}
+
+/*
+ * The memcpy_vec routines take the 16-byte path for copies of at least
+ * VECTOR_COPY_MIN_BYTES whose source and destination can be aligned
+ * together, and fall back to the scalar routines otherwise. The head and
+ * tail are copied by a single lane.
+ */
+__device__ __forceinline__ void memcpy_vec(void* dst, void* src, size_t size) {
+  CopySplit split{copy_split(dst, src, size)};
+  if (split.body == 0) {
+    memcpy(dst, src, size);
+    return;
+  }
+  uint8_t* dst_bytes{static_cast<uint8_t*>(dst)};
+  uint8_t* src_bytes{static_cast<uint8_t*>(src)};
+  memcpy(dst_bytes, src_bytes, split.head);
+  memcpy_dwordx4(dst_bytes + split.head, src_bytes + split.head, split.body,
+                 0, 1);
+  size_t done{split.head + split.body};
+  memcpy(dst_bytes + done, src_bytes + done, split.tail);
+}
+
+__device__ __forceinline__ void memcpy_vec_wg(void* dst, void* src,
+                                              size_t size) {
+  CopySplit split{copy_split(dst, src, size)};
+  if (split.body == 0) {
+    memcpy_wg(dst, src, size);
+    return;
+  }
+  uint8_t* dst_bytes{static_cast<uint8_t*>(dst)};
+  uint8_t* src_bytes{static_cast<uint8_t*>(src)};
+  size_t done{split.head + split.body};
+  if (is_thread_zero_in_block()) {
+    memcpy(dst_bytes, src_bytes, split.head);
+    memcpy(dst_bytes + done, src_bytes + done, split.tail);
+  }
+  memcpy_dwordx4(dst_bytes + split.head, src_bytes + split.head, split.body,
+                 get_flat_block_id(), get_flat_block_size());
+}
+
+__device__ __forceinline__ void memcpy_vec_wave(void* dst, void* src,
+                                                size_t size) {
+  CopySplit split{copy_split(dst, src, size)};
+  if (split.body == 0) {
+    memcpy_wave(dst, src, size);
+    return;
+  }
+  uint8_t* dst_bytes{static_cast<uint8_t*>(dst)};
+  uint8_t* src_bytes{static_cast<uint8_t*>(src)};
+  size_t done{split.head + split.body};
+  if (is_thread_zero_in_wave()) {
+    memcpy(dst_bytes, src_bytes, split.head);
+    memcpy(dst_bytes + done, src_bytes + done, split.tail);
+  }
+  memcpy_dwordx4(dst_bytes + split.head, src_bytes + split.head, split.body,
+                 get_flat_block_id() % WF_SIZE, wave_SZ());
+}
+
 int rocm_init();
 
 void rocm_memory_lock_to_fine_grain(void* ptr, size_t size, void** gpu_ptr,
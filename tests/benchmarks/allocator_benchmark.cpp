@@ -0,0 +1,584 @@
+/******************************************************************************
+ * Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+
+
+/**
+ * @file allocator_benchmark.cpp
+ *
+ * @brief Host-only benchmark for the symmetric heap allocator strategies.
+ *
+ * Replays allocation traces against the strategies used by the heaps:
+ *  - pow2_bins: Pow2Bins (SingleHeap's strategy)
+ *  - dev_mono_linear: DevMonoLinear (SlabHeap's strategy)
+ * Both run on HeapMemory<HostAllocator>, so no device is touched. The Binner
+ * is measured separately by timing bin construction for several heap sizes.
+ *
+ * Traces are either synthetic (uniform, pow2, small, churn) or recorded in a
+ * text file with one operation per line:
+ *
+ *     a <id> <size>     allocate <size> bytes and name the block <id>
+ *     f <id>            free the block named <id>
+ *
+ * For each strategy and trace the benchmark reports ns/op, the peak external
+ * fragmentation (1 - largest free block / free bytes), the peak fraction of
+ * consumed memory not backing a live request, and the first failed
+ * allocation. Results are written as JSON.
+ *
+ * Usage:
+ *     rocshmem_allocator_benchmark [--heap-size bytes] [--ops n]
+ *         [--seed n] [--trace file] [--sample-interval n] [--output file]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "memory/address_record.hpp"
+#include "memory/dev_mono_linear.hpp"
+#include "memory/heap_memory.hpp"
+#include "memory/hip_allocator.hpp"
+#include "memory/pow2_bins.hpp"
+
+using namespace rocshmem;
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+
+using HEAP_T = HeapMemory<HostAllocator>;
+
+/**
+ * @brief One operation of an allocation trace
+ */
+struct TraceOp {
+  bool is_alloc;
+  uint64_t id;
+  size_t size;
+};
+
+struct Trace {
+  std::string name;
+  std::vector<TraceOp> ops;
+};
+
+struct Options {
+  size_t heap_size{1ULL << 30};
+  size_t num_ops{1000000};
+  uint64_t seed{1};
+  size_t sample_interval{1000};
+  std::string trace_file;
+  std::string output_file;
+};
+
+/**
+ * @brief Memory accounting reported by a strategy adaptor
+ */
+struct Occupancy {
+  size_t free_bytes{0};
+  size_t largest_free{0};
+};
+
+/**
+ * @brief Adaptor giving the strategies a common interface
+ */
+class Pow2BinsAdaptor {
+ public:
+  explicit Pow2BinsAdaptor(size_t heap_size)
+      : heap_mem_{heap_size}, strat_{&heap_mem_} {}
+
+  static const char* name() { return "pow2_bins"; }
+
+  char* alloc(size_t size) {
+    char* ptr{nullptr};
+    strat_.alloc(&ptr, size);
+    return ptr;
+  }
+
+  void free(char* ptr) { strat_.free(ptr); }
+
+  Occupancy occupancy() {
+    rocshmem_heap_stats_t stats{};
+    strat_.accumulate_stats(&stats);
+    return {stats.free_bytes, stats.largest_free_block};
+  }
+
+ private:
+  HEAP_T heap_mem_;
+  Pow2Bins<AddressRecord, HEAP_T> strat_;
+};
+
+class DevMonoLinearAdaptor {
+ public:
+  explicit DevMonoLinearAdaptor(size_t heap_size)
+      : heap_mem_{heap_size}, strat_{&heap_mem_} {}
+
+  static const char* name() { return "dev_mono_linear"; }
+
+  char* alloc(size_t size) {
+    char* ptr{nullptr};
+    strat_.alloc(&ptr, size);
+    return ptr;
+  }
+
+  void free(char* ptr) { strat_.free(ptr); }
+
+  Occupancy occupancy() {
+    char* heap_end{heap_mem_.get_ptr() + heap_mem_.get_size()};
+    size_t remaining = heap_end - strat_.current();
+    return {remaining, remaining};
+  }
+
+ private:
+  HEAP_T heap_mem_;
+  DevMonoLinear<HEAP_T> strat_;
+};
+
+struct Result {
+  std::string strategy;
+  std::string trace;
+  size_t num_ops{0};
+  size_t num_allocs{0};
+  size_t num_frees{0};
+  size_t num_failed_allocs{0};
+  double ns_per_op{0};
+  double alloc_ns{0};
+  double free_ns{0};
+  double peak_external_fragmentation{0};
+  double peak_overhead{0};
+  bool failed{false};
+  size_t first_failure_op{0};
+  size_t first_failure_size{0};
+  size_t first_failure_live_bytes{0};
+};
+
+/*****************************************************************************
+ * Trace generation
+ *****************************************************************************/
+
+/**
+ * @brief Builds a synthetic trace
+ *
+ * Each step allocates with probability @p alloc_probability (always when
+ * nothing is live) and otherwise frees a random live block. Sizes are drawn
+ * by @p draw_size.
+ */
+template <typename DRAW_T>
+Trace synthetic_trace(const char* name, size_t num_ops, uint64_t seed,
+                      double alloc_probability, DRAW_T draw_size) {
+  Trace trace{name, {}};
+  trace.ops.reserve(num_ops);
+
+  std::mt19937_64 rng{seed};
+  std::uniform_real_distribution<double> coin{0.0, 1.0};
+  std::vector<uint64_t> live;
+  uint64_t next_id{0};
+
+  for (size_t i{0}; i < num_ops; i++) {
+    if (live.empty() || coin(rng) < alloc_probability) {
+      trace.ops.push_back({true, next_id, draw_size(rng)});
+      live.push_back(next_id++);
+    } else {
+      std::uniform_int_distribution<size_t> pick{0, live.size() - 1};
+      size_t index{pick(rng)};
+      trace.ops.push_back({false, live[index], 0});
+      live[index] = live.back();
+      live.pop_back();
+    }
+  }
+  return trace;
+}
+
+std::vector<Trace> synthetic_traces(const Options& opts) {
+  std::vector<Trace> traces;
+
+  traces.push_back(synthetic_trace(
+      "uniform", opts.num_ops, opts.seed, 0.5, [](std::mt19937_64& rng) {
+        return std::uniform_int_distribution<size_t>{1, 1 << 20}(rng);
+      }));
+
+  traces.push_back(synthetic_trace(
+      "pow2", opts.num_ops, opts.seed, 0.5, [](std::mt19937_64& rng) {
+        return size_t{1} << std::uniform_int_distribution<int>{7, 20}(rng);
+      }));
+
+  traces.push_back(synthetic_trace(
+      "small", opts.num_ops, opts.seed, 0.5, [](std::mt19937_64& rng) {
+        return std::uniform_int_distribution<size_t>{8, 512}(rng);
+      }));
+
+  /*
+   * Allocation-heavy mix with large requests: the live set keeps growing
+   * so every strategy eventually fails.
+   */
+  size_t max_churn_size{std::max<size_t>(opts.heap_size >> 10, 4096)};
+  traces.push_back(synthetic_trace(
+      "churn", opts.num_ops, opts.seed, 0.6,
+      [max_churn_size](std::mt19937_64& rng) {
+        return std::uniform_int_distribution<size_t>{1, max_churn_size}(rng);
+      }));
+
+  return traces;
+}
+
+bool load_trace(const std::string& path, Trace* trace) {
+  std::ifstream in{path};
+  if (!in) {
+    std::cerr << "cannot open trace file " << path << std::endl;
+    return false;
+  }
+
+  trace->name = path;
+  std::string line;
+  size_t line_number{0};
+  while (std::getline(in, line)) {
+    line_number++;
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    std::istringstream fields{line};
+    char op{0};
+    TraceOp trace_op{};
+    fields >> op >> trace_op.id;
+    trace_op.is_alloc = (op == 'a');
+    if (trace_op.is_alloc) {
+      fields >> trace_op.size;
+    }
+    if (fields.fail() || (op != 'a' && op != 'f')) {
+      std::cerr << path << ":" << line_number << ": malformed trace line"
+                << std::endl;
+      return false;
+    }
+    trace->ops.push_back(trace_op);
+  }
+  return true;
+}
+
+/*****************************************************************************
+ * Replay
+ *****************************************************************************/
+
+/**
+ * @brief Replays a trace once without instrumentation
+ *
+ * @return Elapsed time in nanoseconds
+ */
+template <typename ADAPTOR_T>
+double timed_replay(const Trace& trace, size_t heap_size) {
+  ADAPTOR_T adaptor{heap_size};
+  std::unordered_map<uint64_t, char*> blocks;
+  blocks.reserve(trace.ops.size());
+
+  auto start{clock_type::now()};
+  for (const auto& op : trace.ops) {
+    if (op.is_alloc) {
+      blocks[op.id] = adaptor.alloc(op.size);
+    } else {
+      auto it{blocks.find(op.id)};
+      if (it != blocks.end()) {
+        if (it->second) {
+          adaptor.free(it->second);
+        }
+        blocks.erase(it);
+      }
+    }
+  }
+  auto stop{clock_type::now()};
+  return std::chrono::duration<double, std::nano>(stop - start).count();
+}
+
+double timer_overhead_ns() {
+  constexpr int iterations{100000};
+  double total{0};
+  for (int i{0}; i < iterations; i++) {
+    auto start{clock_type::now()};
+    auto stop{clock_type::now()};
+    total += std::chrono::duration<double, std::nano>(stop - start).count();
+  }
+  return total / iterations;
+}
+
+/**
+ * @brief Replays a trace with per-operation timers and occupancy sampling
+ */
+template <typename ADAPTOR_T>
+Result instrumented_replay(const Trace& trace, const Options& opts,
+                           double overhead_ns) {
+  ADAPTOR_T adaptor{opts.heap_size};
+  Result result;
+  result.strategy = ADAPTOR_T::name();
+  result.trace = trace.name;
+  result.num_ops = trace.ops.size();
+
+  struct Block {
+    char* ptr;
+    size_t size;
+  };
+  std::unordered_map<uint64_t, Block> blocks;
+  blocks.reserve(trace.ops.size());
+
+  size_t live_bytes{0};
+  double alloc_total{0};
+  double free_total{0};
+
+  auto sample = [&]() {
+    Occupancy occ{adaptor.occupancy()};
+    if (occ.free_bytes) {
+      double external{1.0 - static_cast<double>(occ.largest_free) /
+                                static_cast<double>(occ.free_bytes)};
+      result.peak_external_fragmentation =
+          std::max(result.peak_external_fragmentation, external);
+    }
+    size_t consumed{opts.heap_size - std::min(opts.heap_size, occ.free_bytes)};
+    if (consumed) {
+      double overhead{1.0 - static_cast<double>(std::min(live_bytes, consumed)) /
+                                static_cast<double>(consumed)};
+      result.peak_overhead = std::max(result.peak_overhead, overhead);
+    }
+  };
+
+  for (size_t i{0}; i < trace.ops.size(); i++) {
+    const auto& op{trace.ops[i]};
+    if (op.is_alloc) {
+      auto start{clock_type::now()};
+      char* ptr{adaptor.alloc(op.size)};
+      auto stop{clock_type::now()};
+      alloc_total += std::chrono::duration<double, std::nano>(stop - start)
+                         .count();
+      result.num_allocs++;
+      if (ptr) {
+        live_bytes += op.size;
+      } else if (op.size) {
+        if (!result.failed) {
+          result.failed = true;
+          result.first_failure_op = i;
+          result.first_failure_size = op.size;
+          result.first_failure_live_bytes = live_bytes;
+        }
+        result.num_failed_allocs++;
+      }
+      blocks[op.id] = {ptr, op.size};
+    } else {
+      auto it{blocks.find(op.id)};
+      if (it == blocks.end()) {
+        continue;
+      }
+      if (it->second.ptr) {
+        auto start{clock_type::now()};
+        adaptor.free(it->second.ptr);
+        auto stop{clock_type::now()};
+        free_total += std::chrono::duration<double, std::nano>(stop - start)
+                          .count();
+        live_bytes -= it->second.size;
+      }
+      result.num_frees++;
+      blocks.erase(it);
+    }
+    if (opts.sample_interval && (i % opts.sample_interval) == 0) {
+      sample();
+    }
+  }
+  sample();
+
+  if (result.num_allocs) {
+    result.alloc_ns =
+        std::max(0.0, alloc_total / result.num_allocs - overhead_ns);
+  }
+  if (result.num_frees) {
+    result.free_ns = std::max(0.0, free_total / result.num_frees - overhead_ns);
+  }
+  return result;
+}
+
+template <typename ADAPTOR_T>
+Result run(const Trace& trace, const Options& opts, double overhead_ns) {
+  Result result{instrumented_replay<ADAPTOR_T>(trace, opts, overhead_ns)};
+  if (result.num_ops) {
+    result.ns_per_op = timed_replay<ADAPTOR_T>(trace, opts.heap_size) /
+                       static_cast<double>(result.num_ops);
+  }
+  return result;
+}
+
+/**
+ * @brief Times Pow2Bins construction, which is dominated by the Binner
+ * assigning the heap to bins
+ */
+std::vector<std::pair<size_t, double>> binner_construction(size_t heap_size) {
+  std::vector<std::pair<size_t, double>> timings;
+  for (size_t size{1ULL << 20}; size <= heap_size; size <<= 2) {
+    HEAP_T heap_mem{size};
+    auto start{clock_type::now()};
+    Pow2Bins<AddressRecord, HEAP_T> strat{&heap_mem};
+    auto stop{clock_type::now()};
+    timings.push_back(
+        {size, std::chrono::duration<double, std::nano>(stop - start).count()});
+  }
+  return timings;
+}
+
+/*****************************************************************************
+ * Output
+ *****************************************************************************/
+
+std::string json_string(const std::string& s) {
+  std::string out{"\""};
+  for (char c : s) {
+    if (c == '"' || c == '\\') {
+      out += '\\';
+    }
+    out += c;
+  }
+  return out + "\"";
+}
+
+void write_json(std::ostream& out, const Options& opts,
+                const std::vector<std::pair<size_t, double>>& binner,
+                const std::vector<Result>& results) {
+  out << "{\n";
+  out << "  \"heap_size\": " << opts.heap_size << ",\n";
+  out << "  \"seed\": " << opts.seed << ",\n";
+  out << "  \"binner\": [\n";
+  for (size_t i{0}; i < binner.size(); i++) {
+    out << "    {\"heap_size\": " << binner[i].first
+        << ", \"construct_ns\": " << binner[i].second << "}"
+        << (i + 1 < binner.size() ? "," : "") << "\n";
+  }
+  out << "  ],\n";
+  out << "  \"results\": [\n";
+  for (size_t i{0}; i < results.size(); i++) {
+    const Result& r{results[i]};
+    out << "    {\n";
+    out << "      \"strategy\": " << json_string(r.strategy) << ",\n";
+    out << "      \"trace\": " << json_string(r.trace) << ",\n";
+    out << "      \"ops\": " << r.num_ops << ",\n";
+    out << "      \"allocs\": " << r.num_allocs << ",\n";
+    out << "      \"frees\": " << r.num_frees << ",\n";
+    out << "      \"failed_allocs\": " << r.num_failed_allocs << ",\n";
+    out << "      \"ns_per_op\": " << r.ns_per_op << ",\n";
+    out << "      \"alloc_ns\": " << r.alloc_ns << ",\n";
+    out << "      \"free_ns\": " << r.free_ns << ",\n";
+    out << "      \"peak_external_fragmentation\": "
+        << r.peak_external_fragmentation << ",\n";
+    out << "      \"peak_overhead\": " << r.peak_overhead << ",\n";
+    out << "      \"first_failure\": ";
+    if (r.failed) {
+      out << "{\"op\": " << r.first_failure_op
+          << ", \"size\": " << r.first_failure_size
+          << ", \"live_bytes\": " << r.first_failure_live_bytes << "}\n";
+    } else {
+      out << "null\n";
+    }
+    out << "    }" << (i + 1 < results.size() ? "," : "") << "\n";
+  }
+  out << "  ]\n";
+  out << "}\n";
+}
+
+void usage(const char* program) {
+  std::cerr << "usage: " << program
+            << " [--heap-size bytes] [--ops n] [--seed n] [--trace file]"
+               " [--sample-interval n] [--output file]"
+            << std::endl;
+}
+
+bool parse_options(int argc, char** argv, Options* opts) {
+  for (int i{1}; i < argc; i++) {
+    std::string arg{argv[i]};
+    if (i + 1 >= argc) {
+      return false;
+    }
+    const char* value{argv[++i]};
+    if (arg == "--heap-size") {
+      opts->heap_size = std::strtoull(value, nullptr, 0);
+    } else if (arg == "--ops") {
+      opts->num_ops = std::strtoull(value, nullptr, 0);
+    } else if (arg == "--seed") {
+      opts->seed = std::strtoull(value, nullptr, 0);
+    } else if (arg == "--sample-interval") {
+      opts->sample_interval = std::strtoull(value, nullptr, 0);
+    } else if (arg == "--trace") {
+      opts->trace_file = value;
+    } else if (arg == "--output") {
+      opts->output_file = value;
+    } else {
+      return false;
+    }
+  }
+  /*
+   * The Binner only handles power-of-two heaps no smaller than ALIGNMENT.
+   */
+  return opts->heap_size >= ALIGNMENT &&
+         (opts->heap_size & (opts->heap_size - 1)) == 0;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  Options opts;
+  if (!parse_options(argc, argv, &opts)) {
+    usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  std::vector<Trace> traces;
+  if (opts.trace_file.empty()) {
+    traces = synthetic_traces(opts);
+  } else {
+    Trace trace;
+    if (!load_trace(opts.trace_file, &trace)) {
+      return EXIT_FAILURE;
+    }
+    traces.push_back(std::move(trace));
+  }
+
+  double overhead_ns{timer_overhead_ns()};
+
+  std::vector<Result> results;
+  for (const auto& trace : traces) {
+    results.push_back(run<Pow2BinsAdaptor>(trace, opts, overhead_ns));
+    results.push_back(run<DevMonoLinearAdaptor>(trace, opts, overhead_ns));
+  }
+
+  auto binner{binner_construction(opts.heap_size)};
+
+  if (opts.output_file.empty()) {
+    write_json(std::cout, opts, binner, results);
+  } else {
+    std::ofstream out{opts.output_file};
+    if (!out) {
+      std::cerr << "cannot open output file " << opts.output_file << std::endl;
+      return EXIT_FAILURE;
+    }
+    write_json(out, opts, binner, results);
+  }
+  return EXIT_SUCCESS;
+}
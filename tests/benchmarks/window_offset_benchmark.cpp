@@ -0,0 +1,285 @@
+/******************************************************************************
+ * Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+
+
+/**
+ * @file window_offset_benchmark.cpp
+ *
+ * @brief Host-only benchmark for the window displacement computation.
+ *
+ * Every host RMA and AMO, and every request the reverse offload proxy hands
+ * to MPI, turns a symmetric address into a displacement with
+ * WindowInfo::get_offset. The benchmark compares it with the former
+ * implementation (an MPI_Get_address pair and MPI_Aint_diff per call):
+ *  - offset: the displacement computation alone
+ *  - put, get, p, g: MPI_Put / MPI_Get plus MPI_Win_flush_local
+ *  - amo_fetch_add, amo_add, amo_set, amo_cas: the MPI atomics plus
+ *    MPI_Win_flush
+ * The operations target the calling process through a window on
+ * MPI_COMM_SELF over host memory, so the MPI cost is a lower bound and the
+ * reported saving is an upper bound of its share of an operation.
+ * Results are written as JSON.
+ *
+ * Usage:
+ *     rocshmem_window_offset_benchmark [--ops n] [--heap-size bytes]
+ *         [--output file]
+ */
+
+#include <mpi.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "memory/window_info.hpp"
+
+using namespace rocshmem;
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+
+struct Options {
+  size_t num_ops{1000000};
+  size_t heap_size{1ULL << 26};
+  std::string output_file;
+};
+
+struct Result {
+  std::string op;
+  double legacy_ns{0};
+  double current_ns{0};
+};
+
+/**
+ * @brief Former WindowInfo::get_offset body
+ */
+MPI_Aint legacy_offset(const WindowInfo& window, const void* dest) {
+  MPI_Aint dest_disp;
+  MPI_Get_address(dest, &dest_disp);
+  MPI_Aint start_disp;
+  MPI_Get_address(window.get_start(), &start_disp);
+  return MPI_Aint_diff(dest_disp, start_disp);
+}
+
+MPI_Aint current_offset(const WindowInfo& window, const void* dest) {
+  return window.get_offset(dest, 0);
+}
+
+/**
+ * @brief Times @p op over every address
+ *
+ * @return Mean nanoseconds per call
+ */
+template <typename OFFSET_T, typename OP_T>
+double time_op(const WindowInfo& window, const std::vector<char*>& addrs,
+               OFFSET_T offset, OP_T op) {
+  auto start{clock_type::now()};
+  for (char* addr : addrs) {
+    op(addr, offset(window, addr));
+  }
+  auto stop{clock_type::now()};
+  return std::chrono::duration<double, std::nano>(stop - start).count() /
+         static_cast<double>(addrs.size());
+}
+
+/**
+ * @brief Times @p op with both offset computations
+ *
+ * The two variants are interleaved over several repetitions and the
+ * fastest repetition of each is kept, so neither benefits from running
+ * second.
+ */
+template <typename OP_T>
+Result run(const char* name, const WindowInfo& window,
+           const std::vector<char*>& addrs, OP_T op) {
+  constexpr int repetitions{5};
+
+  /* Warm up the window and the caches before timing */
+  time_op(window, addrs, current_offset, op);
+
+  Result result;
+  result.op = name;
+  for (int i{0}; i < repetitions; i++) {
+    double legacy{time_op(window, addrs, legacy_offset, op)};
+    double current{time_op(window, addrs, current_offset, op)};
+    if (i == 0 || legacy < result.legacy_ns) {
+      result.legacy_ns = legacy;
+    }
+    if (i == 0 || current < result.current_ns) {
+      result.current_ns = current;
+    }
+  }
+  return result;
+}
+
+std::vector<Result> run_all(const Options& opts, char* heap) {
+  WindowInfo window{MPI_COMM_SELF, heap, opts.heap_size};
+  MPI_Win win{window.get_win()};
+
+  /* Random 8-byte aligned symmetric addresses */
+  std::mt19937_64 rng{1};
+  std::uniform_int_distribution<size_t> pick{0, opts.heap_size / 8 - 1};
+  std::vector<char*> addrs(opts.num_ops);
+  for (auto& addr : addrs) {
+    addr = heap + pick(rng) * 8;
+  }
+
+  /* A small count keeps the transfers from dominating the comparison */
+  std::vector<char*> rma_addrs(addrs.begin(),
+                               addrs.begin() + addrs.size() / 10 + 1);
+
+  int64_t value{1};
+  int64_t result{0};
+  int64_t compare{0};
+  volatile MPI_Aint sink{0};
+
+  std::vector<Result> results;
+  results.push_back(run("offset", window, addrs,
+                        [&](char*, MPI_Aint offset) { sink = offset; }));
+  results.push_back(run("put", window, rma_addrs, [&](char*, MPI_Aint offset) {
+    MPI_Put(&value, 8, MPI_CHAR, 0, offset, 8, MPI_CHAR, win);
+    MPI_Win_flush_local(0, win);
+  }));
+  results.push_back(run("get", window, rma_addrs, [&](char*, MPI_Aint offset) {
+    MPI_Get(&result, 8, MPI_CHAR, 0, offset, 8, MPI_CHAR, win);
+    MPI_Win_flush_local(0, win);
+  }));
+  results.push_back(run("p", window, rma_addrs, [&](char*, MPI_Aint offset) {
+    MPI_Put(&value, 1, MPI_INT64_T, 0, offset, 1, MPI_INT64_T, win);
+    MPI_Win_flush_local(0, win);
+  }));
+  results.push_back(run("g", window, rma_addrs, [&](char*, MPI_Aint offset) {
+    MPI_Get(&result, 1, MPI_INT64_T, 0, offset, 1, MPI_INT64_T, win);
+    MPI_Win_flush_local(0, win);
+  }));
+  results.push_back(
+      run("amo_fetch_add", window, rma_addrs, [&](char*, MPI_Aint offset) {
+        MPI_Fetch_and_op(&value, &result, MPI_INT64_T, 0, offset, MPI_SUM,
+                         win);
+        MPI_Win_flush(0, win);
+      }));
+  results.push_back(
+      run("amo_add", window, rma_addrs, [&](char*, MPI_Aint offset) {
+        MPI_Accumulate(&value, 1, MPI_INT64_T, 0, offset, 1, MPI_INT64_T,
+                       MPI_SUM, win);
+        MPI_Win_flush(0, win);
+      }));
+  results.push_back(
+      run("amo_set", window, rma_addrs, [&](char*, MPI_Aint offset) {
+        MPI_Accumulate(&value, 1, MPI_INT64_T, 0, offset, 1, MPI_INT64_T,
+                       MPI_REPLACE, win);
+        MPI_Win_flush(0, win);
+      }));
+  results.push_back(
+      run("amo_cas", window, rma_addrs, [&](char*, MPI_Aint offset) {
+        MPI_Compare_and_swap(&value, &compare, &result, MPI_INT64_T, 0, offset,
+                             win);
+        MPI_Win_flush(0, win);
+      }));
+
+  return results;
+}
+
+/*****************************************************************************
+ * Output
+ *****************************************************************************/
+
+void write_json(std::ostream& out, const Options& opts,
+                const std::vector<Result>& results) {
+  out << "{\n";
+  out << "  \"ops\": " << opts.num_ops << ",\n";
+  out << "  \"heap_size\": " << opts.heap_size << ",\n";
+  out << "  \"results\": [\n";
+  for (size_t i{0}; i < results.size(); i++) {
+    const Result& r{results[i]};
+    double saved{r.legacy_ns - r.current_ns};
+    out << "    {\"op\": \"" << r.op << "\", \"legacy_ns\": " << r.legacy_ns
+        << ", \"current_ns\": " << r.current_ns << ", \"saved_ns\": " << saved
+        << ", \"saved_fraction\": "
+        << (r.legacy_ns > 0 ? saved / r.legacy_ns : 0) << "}"
+        << (i + 1 < results.size() ? "," : "") << "\n";
+  }
+  out << "  ]\n";
+  out << "}\n";
+}
+
+void usage(const char* program) {
+  std::cerr << "usage: " << program
+            << " [--ops n] [--heap-size bytes] [--output file]" << std::endl;
+}
+
+bool parse_options(int argc, char** argv, Options* opts) {
+  for (int i{1}; i < argc; i++) {
+    std::string arg{argv[i]};
+    if (i + 1 >= argc) {
+      return false;
+    }
+    const char* value{argv[++i]};
+    if (arg == "--ops") {
+      opts->num_ops = std::strtoull(value, nullptr, 0);
+    } else if (arg == "--heap-size") {
+      opts->heap_size = std::strtoull(value, nullptr, 0);
+    } else if (arg == "--output") {
+      opts->output_file = value;
+    } else {
+      return false;
+    }
+  }
+  return opts->num_ops > 0 && opts->heap_size >= 8;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  Options opts;
+  if (!parse_options(argc, argv, &opts)) {
+    usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  MPI_Init(&argc, &argv);
+
+  std::vector<char> heap(opts.heap_size);
+  std::vector<Result> results{run_all(opts, heap.data())};
+
+  int rc{EXIT_SUCCESS};
+  if (opts.output_file.empty()) {
+    write_json(std::cout, opts, results);
+  } else {
+    std::ofstream out{opts.output_file};
+    if (!out) {
+      std::cerr << "cannot open output file " << opts.output_file << std::endl;
+      rc = EXIT_FAILURE;
+    } else {
+      write_json(out, opts, results);
+    }
+  }
+
+  MPI_Finalize();
+  return rc;
+}
@@ -0,0 +1,129 @@
+/******************************************************************************
+ * Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+
+#include "host_callback_tester.hpp"
+
+#include <rocshmem/rocshmem.hpp>
+
+using namespace rocshmem;
+
+/******************************************************************************
+ * DEVICE TEST KERNEL
+ *****************************************************************************/
+__global__ void HostCallbackTest(int loop, int skip, uint64_t *timer,
+                                 uint64_t *sig, int proxy_id, int handoff_id) {
+  __shared__ rocshmem_ctx_t ctx;
+
+  rocshmem_wg_init();
+  rocshmem_wg_ctx_create(ROCSHMEM_CTX_WG_PRIVATE, &ctx);
+
+  if (hipThreadIdx_x == 0) {
+    uint64_t start;
+    uint64_t args[2];
+    args[0] = hipBlockIdx_x;
+
+    for (int i = 0; i < loop + skip; i++) {
+      if (i == skip) {
+        start = rocshmem_timer();
+      }
+      args[1] = i;
+      int id = (i % 2) ? handoff_id : proxy_id;
+      rocshmem_ctx_host_callback(ctx, id, args, 2, &sig[hipBlockIdx_x],
+                                 i + 1);
+      rocshmem_ulong_wait_until((unsigned long *)&sig[hipBlockIdx_x],
+                                ROCSHMEM_CMP_EQ, i + 1);
+    }
+
+    timer[hipBlockIdx_x] = rocshmem_timer() - start;
+  }
+
+  rocshmem_wg_ctx_destroy(&ctx);
+  rocshmem_wg_finalize();
+}
+
+/******************************************************************************
+ * HOST TESTER CLASS METHODS
+ *****************************************************************************/
+HostCallbackTester::HostCallbackTester(TesterArguments args)
+    : Tester(args), calls(args.num_wgs) {
+  sig = (uint64_t *)rocshmem_malloc(sizeof(uint64_t) * args.num_wgs);
+  proxy_id = rocshmem_register_host_callback(countCallback, this,
+                                             ROCSHMEM_HOST_CALLBACK_PROXY);
+  handoff_id = rocshmem_register_host_callback(countCallback, this,
+                                               ROCSHMEM_HOST_CALLBACK_HANDOFF);
+  if (args.myid == 0 && (proxy_id < 0 || handoff_id < 0)) {
+    fprintf(stderr, "Host callbacks are not supported by this backend\n");
+  }
+}
+
+HostCallbackTester::~HostCallbackTester() { rocshmem_free(sig); }
+
+void HostCallbackTester::countCallback(const uint64_t *args, int nargs,
+                                       void *user_data) {
+  auto *tester = static_cast<HostCallbackTester *>(user_data);
+
+  // Each block waits for its previous callback, so its calls are in order
+  int block = args[0];
+  if (nargs != 2 || tester->calls[block]++ != (int)args[1]) {
+    tester->errors++;
+  }
+}
+
+void HostCallbackTester::resetBuffers(uint64_t size) {
+  memset(sig, 0, sizeof(uint64_t) * args.num_wgs);
+  for (auto &count : calls) {
+    count = 0;
+  }
+  expected_calls = 0;
+}
+
+void HostCallbackTester::launchKernel(dim3 gridSize, dim3 blockSize, int loop,
+                                      uint64_t size) {
+  num_msgs = 0;
+  num_timed_msgs = 0;
+
+  if (proxy_id < 0 || handoff_id < 0) {
+    return;
+  }
+
+  size_t shared_bytes = 0;
+
+  hipLaunchKernelGGL(HostCallbackTest, gridSize, blockSize, shared_bytes,
+                     stream, loop, args.skip, timer, sig, proxy_id,
+                     handoff_id);
+
+  expected_calls = loop + args.skip;
+  num_msgs = (loop + args.skip) * gridSize.x;
+  num_timed_msgs = loop;
+}
+
+void HostCallbackTester::verifyResults(uint64_t size) {
+  if (errors) {
+    fprintf(stderr, "%d host callbacks ran out of order\n", errors.load());
+  }
+  for (int i = 0; i < args.num_wgs; i++) {
+    if (calls[i] != expected_calls) {
+      fprintf(stderr, "Block %d: %d host callbacks ran, expected %d\n", i,
+              calls[i].load(), expected_calls);
+    }
+  }
+}
@@ -25,21 +25,40 @@
 
 using namespace rocshmem;
 
+/*
+ * Every PE stores its tag into byte my_pe of r_buf on each PE it gets a
+ * pointer to, then loads the byte back through the same pointer. The
+ * pointer to the PE itself must be r_buf, and an address outside the
+ * symmetric heap must not translate.
+ */
+__host__ __device__ static char pe_tag(int pe) { return 'a' + pe % 26; }
+
 /******************************************************************************
  * DEVICE TEST KERNEL
  *****************************************************************************/
-__global__ void ShmemPtrTest(char *r_buf, int *available) {
+__global__ void ShmemPtrTest(char *r_buf, int *available, int *errors,
+                             int my_pe, int n_pes) {
   rocshmem_wg_init();
 
-  if (hipThreadIdx_x == 0) {
-    char *local_addr = r_buf + 4;
-    void *remote_addr = rocshmem_ptr((void *)local_addr, 1);
+  for (int pe = hipThreadIdx_x; pe < n_pes; pe += hipBlockDim_x) {
+    char *remote_addr = (char *)rocshmem_ptr((void *)r_buf, pe);
+    if (pe == my_pe && remote_addr != r_buf) {
+      atomicAdd(errors, 1);
+    }
     if (remote_addr != NULL) {
-      *available = 1;
-      ((char *)remote_addr)[0] = '1';
+      available[pe] = 1;
+      remote_addr[my_pe] = pe_tag(my_pe);
+      __threadfence_system();
+      if (remote_addr[my_pe] != pe_tag(my_pe)) {
+        atomicAdd(errors, 1);
+      }
     }
   }
 
+  if (hipThreadIdx_x == 0 && rocshmem_ptr((void *)available, 0) != NULL) {
+    atomicAdd(errors, 1);
+  }
+
   rocshmem_wg_finalize();
 }
 
@@ -47,18 +66,21 @@ __global__ void ShmemPtrTest(char *r_buf, int *available) {
  * HOST TESTER CLASS METHODS
  *****************************************************************************/
 ShmemPtrTester::ShmemPtrTester(TesterArguments args) : Tester(args) {
-  CHECK_HIP(hipMalloc((void **)&_available, sizeof(int)));
-  r_buf = (char *)rocshmem_malloc(args.max_msg_size);
+  CHECK_HIP(hipMalloc((void **)&_available, sizeof(int) * args.numprocs));
+  CHECK_HIP(hipMalloc((void **)&_errors, sizeof(int)));
+  r_buf = (char *)rocshmem_malloc(args.numprocs);
 }
 
 ShmemPtrTester::~ShmemPtrTester() {
   CHECK_HIP(hipFree(_available));
+  CHECK_HIP(hipFree(_errors));
   rocshmem_free(r_buf);
 }
 
 void ShmemPtrTester::resetBuffers(uint64_t size) {
-  memset(r_buf, '0', args.max_msg_size);
-  memset(_available, 0, sizeof(int));
+  memset(r_buf, '0', args.numprocs);
+  memset(_available, 0, sizeof(int) * args.numprocs);
+  memset(_errors, 0, sizeof(int));
 }
 
 void ShmemPtrTester::launchKernel(dim3 gridSize, dim3 blockSize, int loop,
@@ -66,21 +88,35 @@ void ShmemPtrTester::launchKernel(dim3 gridSize, dim3 blockSize, int loop,
   size_t shared_bytes = 0;
 
   hipLaunchKernelGGL(ShmemPtrTest, gridSize, blockSize, shared_bytes, stream,
-                     r_buf, _available);
+                     r_buf, _available, _errors, args.myid, args.numprocs);
 
   num_msgs = 0;
   num_timed_msgs = 0;
 }
 
 void ShmemPtrTester::verifyResults(uint64_t size) {
-  if (args.myid == 0) {
-    if (*_available == 0) {
-      fprintf(stderr, "SHMEM_PTR NOT AVAILBLE \n");
+  if (*_errors) {
+    fprintf(stderr, "PE %d: %d shmem_ptr translation errors\n", args.myid,
+            *_errors);
+    exit(-1);
+  }
+
+  /* Reachability is symmetric: peer j wrote here iff we reach j */
+  int reachable = 0;
+  for (int pe = 0; pe < args.numprocs; pe++) {
+    if (!_available[pe]) {
+      continue;
     }
-  } else {
-    if (r_buf[4] != '1') {
+    reachable++;
+    if (r_buf[pe] != pe_tag(pe)) {
       fprintf(stderr, "Data validation error \n");
-      fprintf(stderr, "Got %c, Expected %c\n", r_buf[4], '1');
+      fprintf(stderr, "PE %d: got %c from PE %d, expected %c\n", args.myid,
+              r_buf[pe], pe, pe_tag(pe));
+      exit(-1);
     }
   }
+  if (reachable < args.numprocs) {
+    fprintf(stderr, "PE %d: SHMEM_PTR NOT AVAILABLE for %d PEs\n", args.myid,
+            args.numprocs - reachable);
+  }
 }
@@ -43,6 +43,7 @@ class ShmemPtrTester : public Tester {
 
   char *r_buf = nullptr;
   int *_available = nullptr;
+  int *_errors = nullptr;
 };
 
 #endif
@@ -29,6 +29,12 @@ __device__ int wg_team_reduce(rocshmem_ctx_t ctx, rocshmem_team_t, T *dest,
   return ROCSHMEM_SUCCESS;
 }
 
+template <typename T, ROCSHMEM_OP Op>
+__device__ int grid_team_reduce(rocshmem_ctx_t ctx, rocshmem_team_t, T *dest,
+                                const T *source, int nreduce) {
+  return ROCSHMEM_SUCCESS;
+}
+
 /* Define templates to call rocSHMEM */
 #define TEAM_REDUCTION_DEF_GEN(T, TNAME, Op_API, Op)                      \
   template <>                                                             \
@@ -37,6 +43,13 @@ __device__ int wg_team_reduce(rocshmem_ctx_t ctx, rocshmem_team_t, T *dest,
                                        const T *source, int nreduce) {    \
     return rocshmem_ctx_##TNAME##_##Op_API##_wg_reduce(ctx, team, dest,  \
                                                         source, nreduce); \
+  }                                                                       \
+  template <>                                                             \
+  __device__ int grid_team_reduce<T, Op>(rocshmem_ctx_t ctx,             \
+                                         rocshmem_team_t team, T * dest, \
+                                         const T *source, int nreduce) {  \
+    return rocshmem_ctx_##TNAME##_##Op_API##_grid_reduce(                 \
+        ctx, team, dest, source, nreduce);                                \
   }
 
 #define TEAM_ARITH_REDUCTION_DEF_GEN(T, TNAME)         \
@@ -91,8 +104,13 @@ __global__ void TeamReductionTest(int loop, int skip, uint64_t *timer,
     if (i == skip && hipThreadIdx_x == 0) {
       start = rocshmem_timer();
     }
-    wg_team_reduce<T1, T2>(ctx, team, r_buf, s_buf, size);
-    rocshmem_ctx_wg_barrier_all(ctx);
+    if (type == GridReductionTestType) {
+      /* Returns once every PE has the result, no barrier needed */
+      grid_team_reduce<T1, T2>(ctx, team, r_buf, s_buf, size);
+    } else {
+      wg_team_reduce<T1, T2>(ctx, team, r_buf, s_buf, size);
+      rocshmem_ctx_wg_barrier_all(ctx);
+    }
   }
 
   __syncthreads();
@@ -127,8 +145,13 @@ template <typename T1, ROCSHMEM_OP T2>
 void TeamReductionTester<T1, T2>::preLaunchKernel() {
   int n_pes = rocshmem_team_n_pes(ROCSHMEM_TEAM_WORLD);
 
+  /* A work array of its own lets large reductions run in fewer passes */
+  rocshmem_team_config_t config{};
+  config.reduce_wrk_size = 64 * ROCSHMEM_REDUCE_MIN_WRKDATA_SIZE;
+
   team_reduce_world_dup = ROCSHMEM_TEAM_INVALID;
-  rocshmem_team_split_strided(ROCSHMEM_TEAM_WORLD, 0, 1, n_pes, nullptr, 0,
+  rocshmem_team_split_strided(ROCSHMEM_TEAM_WORLD, 0, 1, n_pes, &config,
+                               ROCSHMEM_TEAM_REDUCE_WRK_SIZE,
                                &team_reduce_world_dup);
 }
 
@@ -137,10 +160,22 @@ void TeamReductionTester<T1, T2>::launchKernel(dim3 gridSize, dim3 blockSize,
                                                int loop, uint64_t size) {
   size_t shared_bytes = 0;
 
-  hipLaunchKernelGGL(HIP_KERNEL_NAME(TeamReductionTest<T1, T2>), gridSize,
-                     blockSize, shared_bytes, stream, loop, args.skip, timer,
-                     s_buf, r_buf, size, _type, _shmem_context,
-                     team_reduce_world_dup);
+  if (_type == GridReductionTestType) {
+    /* The workgroups wait for each other, so all must be resident */
+    int skip = args.skip;
+    int nreduce = size;
+    void *kernel_args[] = {&loop,  &skip,    &timer, &s_buf,
+                           &r_buf, &nreduce, &_type, &_shmem_context,
+                           &team_reduce_world_dup};
+    CHECK_HIP(hipLaunchCooperativeKernel(TeamReductionTest<T1, T2>, gridSize,
+                                         blockSize, kernel_args, shared_bytes,
+                                         stream));
+  } else {
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(TeamReductionTest<T1, T2>), gridSize,
+                       blockSize, shared_bytes, stream, loop, args.skip,
+                       timer, s_buf, r_buf, size, _type, _shmem_context,
+                       team_reduce_world_dup);
+  }
 
   num_msgs = loop + args.skip;
   num_timed_msgs = loop;
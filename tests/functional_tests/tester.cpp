@@ -38,6 +38,7 @@
 #include "empty_tester.hpp"
 #include "extended_primitives.hpp"
 #include "fcollect_tester.hpp"
+#include "host_callback_tester.hpp"
 #include "ping_all_tester.hpp"
 #include "ping_pong_tester.hpp"
 #include "primitive_mr_tester.hpp"
@@ -155,6 +156,23 @@ std::vector<Tester*> Tester::create(TesterArguments args) {
                                                    std::to_string(n_pes));
           }));
       return testers;
+    case GridReductionTestType:
+      if (rank == 0)
+        std::cout << "All-to-All Grid Reduction ###" << std::endl;
+      testers.push_back(new TeamReductionTester<float, ROCSHMEM_SUM>(
+          args,
+          [](float& f1, float& f2) {
+            f1 = 1;
+            f2 = 1;
+          },
+          [](float v, float n_pes) {
+            return (v == n_pes)
+                       ? std::make_pair(true, "")
+                       : std::make_pair(false, "Got " + std::to_string(v) +
+                                                   ", Expect " +
+                                                   std::to_string(n_pes));
+          }));
+      return testers;
     case TeamBroadcastTestType:
       if (rank == 0) {
         std::cout << "Team Broadcast Test ###" << std::endl;
@@ -456,6 +474,10 @@ std::vector<Tester*> Tester::create(TesterArguments args) {
       if (rank == 0) std::cout << "Wave Signal Fetch ###" << std::endl;
       testers.push_back(new SignalingOperationsTester(args));
       return testers;
+    case HostCallbackTestType:
+      if (rank == 0) std::cout << "Host Callback ###" << std::endl;
+      testers.push_back(new HostCallbackTester(args));
+      return testers;
     default:
       if (rank == 0) std::cout << "Unknown ###" << std::endl;
       testers.push_back(new PrimitiveTester(args));
@@ -570,6 +592,7 @@ bool Tester::peLaunchesKernel() {
    * Some test types are active on both sides.
    */
   is_launcher = is_launcher || (_type == TeamReductionTestType) ||
+                (_type == GridReductionTestType) ||
                 (_type == TeamBroadcastTestType) ||
                 (_type == AllToAllTestType) || (_type == FCollectTestType) ||
                 (_type == PingPongTestType) || (_type == BarrierAllTestType) ||
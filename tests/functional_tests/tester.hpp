@@ -94,6 +94,8 @@ enum TestType {
   SignalFetchTestType = 59,
   WGSignalFetchTestType = 60,
   WAVESignalFetchTestType = 61,
+  HostCallbackTestType = 62,
+  GridReductionTestType = 63,
 };
 
 enum OpType { PutType = 0, GetType = 1 };
@@ -87,6 +87,7 @@ TesterArguments::TesterArguments(int argc, char *argv[]) {
     case BarrierAllTestType:
     case SyncTestType:
     case ShmemPtrTestType:
+    case HostCallbackTestType:
       min_msg_size = 8;
       max_msg_size = 8;
       break;
@@ -139,6 +140,7 @@ void TesterArguments::get_rocshmem_arguments() {
   if ((type != BarrierAllTestType) && (type != SyncAllTestType) &&
       (type != SyncTestType) && (type != AllToAllTestType) &&
       (type != FCollectTestType) && (type != TeamReductionTestType) &&
+      (type != GridReductionTestType) &&
       (type != TeamBroadcastTestType) && (type != PingAllTestType)) {
     if (numprocs != 2) {
       if (myid == 0) {
@@ -0,0 +1,188 @@
+#include <getopt.h>
+#include <omp.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <rocshmem/rocshmem.hpp>
+
+using namespace rocshmem;
+
+#define CACHE_LINE_SIZE 64
+#define DEF_MAX_THREADS 8
+#define DEF_MESSAGE_SIZE 8
+#define DEF_NUM_MESSAGES 64000
+#define WINDOW_SIZE 64
+
+/* A host put/get message-rate scaling benchmark.
+ *
+ * For 1, 2, 4, ... max_threads threads, every thread of the even PE creates
+ * its own context inside the parallel region, then issues putmem_nbi
+ * windows (completed with quiet) and blocking getmem calls to the odd PE
+ * through that context. The aggregate rate of each phase and the speedup
+ * over one thread are reported along with the mean context creation time.
+ */
+
+int max_threads = DEF_MAX_THREADS;
+int num_messages = DEF_NUM_MESSAGES;
+int message_size = DEF_MESSAGE_SIZE;
+
+double get_time() {
+  double seconds = 0.0;
+  struct timespec tv;
+
+  clock_gettime(CLOCK_MONOTONIC, &tv);
+  seconds = tv.tv_sec;
+  seconds += (double)tv.tv_nsec / 1.0e9;
+
+  return seconds;
+}
+
+struct ThreadTimes {
+  double create;
+  double put;
+  double get;
+  char pad[CACHE_LINE_SIZE - 3 * sizeof(double)];
+};
+
+void run_threads(int rank, int num_threads, char *dest_buf, char *source_buf,
+                 size_t buffer_size, ThreadTimes *times) {
+  int win_posts = num_messages / WINDOW_SIZE;
+
+  omp_set_num_threads(num_threads);
+
+#pragma omp parallel
+  {
+    int tid = omp_get_thread_num();
+    char *my_dest = &dest_buf[tid * buffer_size];
+    char *my_source = &source_buf[tid * buffer_size];
+    int target = rank + 1;
+    rocshmem_ctx_t ctx;
+    double t_start;
+
+    t_start = get_time();
+    if (rocshmem_ctx_create(0, &ctx)) {
+      printf("PE %d: thread %d could not create a context\n", rank, tid);
+      ctx = ROCSHMEM_CTX_DEFAULT;
+    }
+    times[tid].create = get_time() - t_start;
+
+#pragma omp barrier
+
+    t_start = get_time();
+    for (int w = 0; w < win_posts; w++) {
+      for (int i = 0; i < WINDOW_SIZE; i++) {
+        rocshmem_ctx_putmem_nbi(ctx, my_dest, my_source, message_size,
+                                 target);
+      }
+      rocshmem_ctx_quiet(ctx);
+    }
+    times[tid].put = get_time() - t_start;
+
+#pragma omp barrier
+
+    t_start = get_time();
+    for (int m = 0; m < win_posts * WINDOW_SIZE; m++) {
+      rocshmem_ctx_getmem(ctx, my_source, my_dest, message_size, target);
+    }
+    times[tid].get = get_time() - t_start;
+
+    if (ctx.ctx_opaque != ROCSHMEM_CTX_DEFAULT.ctx_opaque) {
+      rocshmem_ctx_destroy(ctx);
+    }
+  }
+}
+
+void print_usage(const char *argv0) {
+  printf("Usage:\n");
+  printf("  mpiexec -n 2 %s <options>\n", argv0);
+  printf("\n");
+  printf("Options:\n");
+  printf("  -T <max_threads>	largest thread count of the sweep\n");
+  printf("  -M <num_messages>	messages per thread and phase\n");
+  printf("  -S <message_size>	bytes per message\n");
+}
+
+int main(int argc, char *argv[]) {
+  int op, rank, size;
+
+  while ((op = getopt(argc, argv, "hT:M:S:")) != -1) {
+    switch (op) {
+      case 'T':
+        max_threads = atoi(optarg);
+        break;
+      case 'M':
+        num_messages = atoi(optarg);
+        break;
+      case 'S':
+        message_size = atoi(optarg);
+        break;
+      default:
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+  }
+
+  int provided;
+  rocshmem_init_thread(ROCSHMEM_THREAD_MULTIPLE, &provided);
+  if (provided != ROCSHMEM_THREAD_MULTIPLE) {
+    printf("ROCSHMEM_THREAD_MULTIPLE is not supported\n");
+    rocshmem_finalize();
+    return EXIT_FAILURE;
+  }
+
+  size = rocshmem_n_pes();
+  rank = rocshmem_my_pe();
+  if (size != 2) {
+    if (rank == 0) {
+      printf("Run with only two processes.\n");
+    }
+    rocshmem_finalize();
+    return EXIT_FAILURE;
+  }
+
+  size_t buffer_size = message_size + CACHE_LINE_SIZE;
+  char *dest_buf = (char *)rocshmem_malloc(buffer_size * max_threads);
+  char *source_buf = (char *)rocshmem_malloc(buffer_size * max_threads);
+  ThreadTimes *times = (ThreadTimes *)calloc(max_threads, sizeof(ThreadTimes));
+
+  double base_put_rate = 0.0, base_get_rate = 0.0;
+  long messages = (long)(num_messages / WINDOW_SIZE) * WINDOW_SIZE;
+
+  if (rank == 0) {
+    printf("%-10s%-14s%-14s%-14s%-14s%-14s\n", "Threads", "Put Mmsgs/s",
+           "Put speedup", "Get Mmsgs/s", "Get speedup", "Create us");
+  }
+
+  for (int threads = 1; threads <= max_threads; threads *= 2) {
+    rocshmem_barrier_all();
+
+    if (rank % 2 == 0) {
+      run_threads(rank, threads, dest_buf, source_buf, buffer_size, times);
+
+      double put_rate = 0.0, get_rate = 0.0, create = 0.0;
+      for (int t = 0; t < threads; t++) {
+        put_rate += messages / times[t].put / 1e6;
+        get_rate += messages / times[t].get / 1e6;
+        create += times[t].create;
+      }
+      if (threads == 1) {
+        base_put_rate = put_rate;
+        base_get_rate = get_rate;
+      }
+      printf("%-10d%-14.3f%-14.2f%-14.3f%-14.2f%-14.2f\n", threads, put_rate,
+             put_rate / base_put_rate, get_rate, get_rate / base_get_rate,
+             create / threads * 1e6);
+    }
+
+    rocshmem_barrier_all();
+  }
+
+  free(times);
+  rocshmem_free(source_buf);
+  rocshmem_free(dest_buf);
+
+  rocshmem_finalize();
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,168 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <rocshmem/rocshmem.hpp>
+
+using namespace rocshmem;
+
+/* Host alltoall, alltoallv and fcollect on ROCSHMEM_TEAM_WORLD.
+ *
+ * Each size is run twice: the small one takes the window put path and the
+ * large one is offloaded to the MPI collective (with the default
+ * ROCSHMEM_HOST_COLL_RMA_THRESHOLD). In alltoallv, PE i sends i + j + 1
+ * elements to PE j.
+ */
+
+static const int test_sizes[] = {4, 4096};
+
+static long value(int from, int to, int i) {
+  return (long)from * 1000000 + (long)to * 1000 + i;
+}
+
+int test_alltoall(int mype, int npes, int nelems) {
+  int errors = 0;
+  long *src = (long *)rocshmem_malloc(sizeof(long) * nelems * npes);
+  long *dst = (long *)rocshmem_malloc(sizeof(long) * nelems * npes);
+
+  for (int j = 0; j < npes; j++) {
+    for (int i = 0; i < nelems; i++) {
+      src[j * nelems + i] = value(mype, j, i);
+      dst[j * nelems + i] = -1;
+    }
+  }
+  rocshmem_barrier_all();
+
+  rocshmem_ctx_long_alltoall(ROCSHMEM_CTX_DEFAULT, ROCSHMEM_TEAM_WORLD, dst,
+                             src, nelems);
+
+  for (int j = 0; j < npes && !errors; j++) {
+    for (int i = 0; i < nelems; i++) {
+      if (dst[j * nelems + i] != value(j, mype, i)) {
+        printf("PE %d: alltoall(%d) dst[%d] = %ld, expected %ld\n", mype,
+               nelems, j * nelems + i, dst[j * nelems + i],
+               value(j, mype, i));
+        errors++;
+        break;
+      }
+    }
+  }
+
+  rocshmem_barrier_all();
+  rocshmem_free(dst);
+  rocshmem_free(src);
+  return errors;
+}
+
+int test_fcollect(int mype, int npes, int nelems) {
+  int errors = 0;
+  long *src = (long *)rocshmem_malloc(sizeof(long) * nelems);
+  long *dst = (long *)rocshmem_malloc(sizeof(long) * nelems * npes);
+
+  for (int i = 0; i < nelems; i++) {
+    src[i] = value(mype, 0, i);
+  }
+  for (int i = 0; i < nelems * npes; i++) {
+    dst[i] = -1;
+  }
+  rocshmem_barrier_all();
+
+  rocshmem_ctx_long_fcollect(ROCSHMEM_CTX_DEFAULT, ROCSHMEM_TEAM_WORLD, dst,
+                             src, nelems);
+
+  for (int j = 0; j < npes && !errors; j++) {
+    for (int i = 0; i < nelems; i++) {
+      if (dst[j * nelems + i] != value(j, 0, i)) {
+        printf("PE %d: fcollect(%d) dst[%d] = %ld, expected %ld\n", mype,
+               nelems, j * nelems + i, dst[j * nelems + i], value(j, 0, i));
+        errors++;
+        break;
+      }
+    }
+  }
+
+  rocshmem_barrier_all();
+  rocshmem_free(dst);
+  rocshmem_free(src);
+  return errors;
+}
+
+int test_alltoallv(int mype, int npes) {
+  int errors = 0;
+  int *source_counts = (int *)malloc(sizeof(int) * npes);
+  int *source_displs = (int *)malloc(sizeof(int) * npes);
+  int *dest_counts = (int *)malloc(sizeof(int) * npes);
+  int *dest_displs = (int *)malloc(sizeof(int) * npes);
+
+  /* Symmetric allocations need the same size on every PE */
+  int max_total = 0;
+  for (int j = 0; j < npes; j++) {
+    max_total += (npes - 1) + j + 1;
+  }
+
+  long *src = (long *)rocshmem_malloc(sizeof(long) * max_total);
+  long *dst = (long *)rocshmem_malloc(sizeof(long) * max_total);
+
+  int send_off = 0, recv_off = 0;
+  for (int j = 0; j < npes; j++) {
+    source_counts[j] = mype + j + 1;
+    source_displs[j] = send_off;
+    dest_counts[j] = j + mype + 1;
+    dest_displs[j] = recv_off;
+    for (int i = 0; i < source_counts[j]; i++) {
+      src[send_off + i] = value(mype, j, i);
+    }
+    send_off += source_counts[j];
+    recv_off += dest_counts[j];
+  }
+  for (int i = 0; i < max_total; i++) {
+    dst[i] = -1;
+  }
+  rocshmem_barrier_all();
+
+  rocshmem_ctx_long_alltoallv(ROCSHMEM_CTX_DEFAULT, ROCSHMEM_TEAM_WORLD, dst,
+                              dest_counts, dest_displs, src, source_counts,
+                              source_displs);
+
+  for (int j = 0; j < npes && !errors; j++) {
+    for (int i = 0; i < dest_counts[j]; i++) {
+      if (dst[dest_displs[j] + i] != value(j, mype, i)) {
+        printf("PE %d: alltoallv dst[%d] = %ld, expected %ld\n", mype,
+               dest_displs[j] + i, dst[dest_displs[j] + i], value(j, mype, i));
+        errors++;
+        break;
+      }
+    }
+  }
+
+  rocshmem_barrier_all();
+  rocshmem_free(dst);
+  rocshmem_free(src);
+  free(dest_displs);
+  free(dest_counts);
+  free(source_displs);
+  free(source_counts);
+  return errors;
+}
+
+int main(void) {
+  int errors = 0;
+
+  rocshmem_init();
+
+  const int mype = rocshmem_my_pe();
+  const int npes = rocshmem_n_pes();
+
+  for (int nelems : test_sizes) {
+    errors += test_alltoall(mype, npes, nelems);
+    errors += test_fcollect(mype, npes, nelems);
+  }
+  errors += test_alltoallv(mype, npes);
+
+  if (mype == 0 && errors == 0) {
+    printf("Passed\n");
+  }
+
+  rocshmem_finalize();
+
+  return errors ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,113 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <rocshmem/rocshmem.hpp>
+
+using namespace rocshmem;
+
+#define NCHUNKS 64
+#define CHUNK 16
+
+/* Host batched puts and gets.
+ *
+ * Every PE scatters NCHUNKS chunks of its source to each PE with a single
+ * rocshmem_batch, listing the descriptors in reverse order so the batch has
+ * to regroup them (adjacent chunks are merged). After a barrier it reads
+ * every PE's copy back with a second batch of gets, again in reverse order,
+ * and checks both the local and the fetched data.
+ */
+
+static char value(int from, int to, int i) {
+  return (char)(from * 31 + to * 7 + i);
+}
+
+int main(void) {
+  int errors = 0;
+
+  rocshmem_init();
+
+  const int mype = rocshmem_my_pe();
+  const int npes = rocshmem_n_pes();
+  const size_t region = (size_t)NCHUNKS * CHUNK;
+
+  char *src = (char *)rocshmem_malloc(region * npes);
+  char *dst = (char *)rocshmem_malloc(region * npes);
+  char *fetched = (char *)malloc(region * npes);
+  rocshmem_batch_op_t *ops = (rocshmem_batch_op_t *)malloc(
+      sizeof(rocshmem_batch_op_t) * NCHUNKS * npes);
+
+  for (int j = 0; j < npes; j++) {
+    for (size_t i = 0; i < region; i++) {
+      src[j * region + i] = value(mype, j, i);
+      dst[j * region + i] = -1;
+    }
+  }
+  rocshmem_barrier_all();
+
+  /* PE j receives our chunks in its dst slot for us */
+  int n = 0;
+  for (int c = NCHUNKS * npes - 1; c >= 0; c--) {
+    int j = c / NCHUNKS;
+    size_t off = (size_t)(c % NCHUNKS) * CHUNK;
+    ops[n].op = ROCSHMEM_BATCH_PUT;
+    ops[n].dest = &dst[mype * region + off];
+    ops[n].source = &src[j * region + off];
+    ops[n].nbytes = CHUNK;
+    ops[n].pe = j;
+    n++;
+  }
+  rocshmem_batch(ops, n);
+  rocshmem_quiet();
+  rocshmem_barrier_all();
+
+  for (int j = 0; j < npes && !errors; j++) {
+    for (size_t i = 0; i < region; i++) {
+      if (dst[j * region + i] != value(j, mype, i)) {
+        printf("PE %d: put dst[%zu] = %d, expected %d\n", mype, j * region + i,
+               dst[j * region + i], value(j, mype, i));
+        errors++;
+        break;
+      }
+    }
+  }
+
+  /* Fetch what we put on each PE */
+  n = 0;
+  for (int c = NCHUNKS * npes - 1; c >= 0; c--) {
+    int j = c / NCHUNKS;
+    size_t off = (size_t)(c % NCHUNKS) * CHUNK;
+    ops[n].op = ROCSHMEM_BATCH_GET;
+    ops[n].dest = &fetched[j * region + off];
+    ops[n].source = &dst[mype * region + off];
+    ops[n].nbytes = CHUNK;
+    ops[n].pe = j;
+    n++;
+  }
+  rocshmem_batch(ops, n);
+
+  for (int j = 0; j < npes && !errors; j++) {
+    for (size_t i = 0; i < region; i++) {
+      if (fetched[j * region + i] != value(mype, j, i)) {
+        printf("PE %d: get from PE %d [%zu] = %d, expected %d\n", mype, j, i,
+               fetched[j * region + i], value(mype, j, i));
+        errors++;
+        break;
+      }
+    }
+  }
+
+  rocshmem_barrier_all();
+
+  if (mype == 0 && errors == 0) {
+    printf("Passed\n");
+  }
+
+  free(ops);
+  free(fetched);
+  rocshmem_free(dst);
+  rocshmem_free(src);
+
+  rocshmem_finalize();
+
+  return errors ? EXIT_FAILURE : EXIT_SUCCESS;
+}
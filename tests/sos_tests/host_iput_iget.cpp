@@ -0,0 +1,81 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <rocshmem/rocshmem.hpp>
+
+using namespace rocshmem;
+
+#define NELEMS 64
+
+/* Host strided RMA.
+ *
+ * Every PE writes every third element of its source into every other
+ * element of the destination on the next PE with iput, then reads the same
+ * pattern back from the previous PE with iget. Elements skipped by the
+ * strides must be left untouched.
+ */
+
+static long value(int pe, int i) { return (long)pe * 1000 + i; }
+
+int main(void) {
+  int errors = 0;
+
+  rocshmem_init();
+
+  const int mype = rocshmem_my_pe();
+  const int npes = rocshmem_n_pes();
+  const int next = (mype + 1) % npes;
+  const int prev = (mype + npes - 1) % npes;
+
+  long *src = (long *)rocshmem_malloc(sizeof(long) * NELEMS * 3);
+  long *dst = (long *)rocshmem_malloc(sizeof(long) * NELEMS * 2);
+  long *back = (long *)rocshmem_malloc(sizeof(long) * NELEMS * 3);
+
+  for (int i = 0; i < NELEMS * 3; i++) {
+    src[i] = value(mype, i);
+    back[i] = -1;
+  }
+  for (int i = 0; i < NELEMS * 2; i++) {
+    dst[i] = -1;
+  }
+  rocshmem_barrier_all();
+
+  rocshmem_long_iput(dst, src, 2, 3, NELEMS, next);
+  rocshmem_barrier_all();
+
+  for (int i = 0; i < NELEMS * 2; i++) {
+    long expected = (i % 2) ? -1 : value(prev, (i / 2) * 3);
+    if (dst[i] != expected) {
+      printf("PE %d: iput dst[%d] = %ld, expected %ld\n", mype, i, dst[i],
+             expected);
+      errors++;
+      break;
+    }
+  }
+
+  rocshmem_long_iget(back, dst, 3, 2, NELEMS, prev);
+
+  for (int i = 0; i < NELEMS * 3; i++) {
+    long expected = (i % 3) ? -1 : value((prev + npes - 1) % npes, i);
+    if (back[i] != expected) {
+      printf("PE %d: iget back[%d] = %ld, expected %ld\n", mype, i, back[i],
+             expected);
+      errors++;
+      break;
+    }
+  }
+
+  rocshmem_barrier_all();
+
+  if (mype == 0 && errors == 0) {
+    printf("Passed\n");
+  }
+
+  rocshmem_free(back);
+  rocshmem_free(dst);
+  rocshmem_free(src);
+
+  rocshmem_finalize();
+
+  return errors ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,91 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <rocshmem/rocshmem.hpp>
+
+using namespace rocshmem;
+
+#define NELEMS 4096
+
+/* Non-blocking host collectives.
+ *
+ * Starts a sum reduction, a broadcast and a barrier with the *_nbi host
+ * calls, polls the first handle with rocshmem_test while doing local
+ * work, completes the rest with rocshmem_wait and checks the results.
+ */
+
+int main(void) {
+  int rc = EXIT_SUCCESS;
+
+  rocshmem_init();
+
+  const int mype = rocshmem_my_pe();
+  const int npes = rocshmem_n_pes();
+
+  long *src = (long *)rocshmem_malloc(sizeof(long) * NELEMS);
+  long *dst = (long *)rocshmem_malloc(sizeof(long) * NELEMS);
+  long *bcast = (long *)rocshmem_malloc(sizeof(long) * NELEMS);
+
+  for (int i = 0; i < NELEMS; i++) {
+    src[i] = mype + i;
+    dst[i] = -1;
+    bcast[i] = (mype == 0) ? i : -1;
+  }
+
+  rocshmem_barrier_all();
+
+  rocshmem_request_t reduce_req, bcast_req, barrier_req;
+
+  rocshmem_ctx_long_sum_reduce_nbi(ROCSHMEM_CTX_DEFAULT, ROCSHMEM_TEAM_WORLD,
+                                   dst, src, NELEMS, &reduce_req);
+  rocshmem_ctx_long_broadcast_nbi(ROCSHMEM_CTX_DEFAULT, ROCSHMEM_TEAM_WORLD,
+                                  bcast, bcast, NELEMS, 0, &bcast_req);
+
+  long polls = 0;
+  while (!rocshmem_test(&reduce_req)) {
+    polls++;
+  }
+  if (reduce_req != ROCSHMEM_REQUEST_NULL) {
+    printf("PE %d: request not released after rocshmem_test\n", mype);
+    rc = EXIT_FAILURE;
+  }
+
+  rocshmem_wait(&bcast_req);
+
+  /* Completed handles are null and must be accepted again */
+  rocshmem_wait(&bcast_req);
+  if (!rocshmem_test(&bcast_req)) {
+    printf("PE %d: rocshmem_test on a null request returned 0\n", mype);
+    rc = EXIT_FAILURE;
+  }
+
+  const long base = (long)npes * (npes - 1) / 2;
+  for (int i = 0; i < NELEMS; i++) {
+    if (dst[i] != base + (long)npes * i) {
+      printf("PE %d: dst[%d] = %ld, expected %ld\n", mype, i, dst[i],
+             base + (long)npes * i);
+      rc = EXIT_FAILURE;
+      break;
+    }
+    if (bcast[i] != i) {
+      printf("PE %d: bcast[%d] = %ld, expected %d\n", mype, i, bcast[i], i);
+      rc = EXIT_FAILURE;
+      break;
+    }
+  }
+
+  rocshmem_barrier_all_nbi(&barrier_req);
+  rocshmem_wait(&barrier_req);
+
+  if (mype == 0 && rc == EXIT_SUCCESS) {
+    printf("Passed (%ld polls before the reduction completed)\n", polls);
+  }
+
+  rocshmem_free(bcast);
+  rocshmem_free(dst);
+  rocshmem_free(src);
+
+  rocshmem_finalize();
+
+  return rc;
+}
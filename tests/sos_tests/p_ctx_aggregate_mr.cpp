@@ -0,0 +1,141 @@
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <rocshmem/rocshmem.hpp>
+
+using namespace rocshmem;
+
+#define DEF_NUM_MESSAGES 1000000
+#define DEF_NUM_ELEMS 4096
+#define WINDOW_SIZE 1024
+
+/* A scalar host put message-rate benchmark.
+ *
+ * Each PE issues rocshmem_ctx_long_p to pseudo-random elements on
+ * pseudo-random PEs, calling quiet every WINDOW_SIZE puts. The run is
+ * repeated with a default context and with a ROCSHMEM_CTX_AGGREGATE
+ * context, and the final array contents are checked against each other.
+ */
+
+int num_messages = DEF_NUM_MESSAGES;
+int num_elems = DEF_NUM_ELEMS;
+
+double get_time() {
+  double seconds = 0.0;
+  struct timespec tv;
+
+  clock_gettime(CLOCK_MONOTONIC, &tv);
+  seconds = tv.tv_sec;
+  seconds += (double)tv.tv_nsec / 1.0e9;
+
+  return seconds;
+}
+
+double run_bench(long options, long *dest, int rank, int size) {
+  rocshmem_ctx_t ctx;
+  unsigned int seed = rank + 1;
+  double t_start, t_end;
+
+  if (rocshmem_ctx_create(options, &ctx)) {
+    printf("PE %d: could not create context (options %ld)\n", rank, options);
+    return -1.0;
+  }
+
+  for (int i = 0; i < num_elems; i++) {
+    rocshmem_long_p(&dest[i], 0, rank);
+  }
+  rocshmem_quiet();
+  rocshmem_barrier_all();
+
+  t_start = get_time();
+  for (int i = 0; i < num_messages; i++) {
+    int pe = rand_r(&seed) % size;
+    int elem = rand_r(&seed) % num_elems;
+    rocshmem_ctx_long_p(ctx, &dest[elem], (long)rank * num_messages + i, pe);
+    if ((i + 1) % WINDOW_SIZE == 0) {
+      rocshmem_ctx_quiet(ctx);
+    }
+  }
+  rocshmem_ctx_quiet(ctx);
+  t_end = get_time();
+
+  rocshmem_ctx_destroy(ctx);
+  rocshmem_barrier_all();
+
+  return t_end - t_start;
+}
+
+void print_usage(const char *argv0) {
+  printf("Usage:\n");
+  printf("  mpiexec -n <#PEs> %s <options>\n", argv0);
+  printf("\n");
+  printf("Options:\n");
+  printf("  -M <num_messages>	number of puts per PE\n");
+  printf("  -E <num_elems>		number of target elements per PE\n");
+}
+
+int main(int argc, char *argv[]) {
+  int op, rank, size, errors = 0;
+  long *dest, *check;
+  double t_plain, t_aggregate;
+
+  while ((op = getopt(argc, argv, "hM:E:")) != -1) {
+    switch (op) {
+      case 'M':
+        num_messages = atoi(optarg);
+        break;
+      case 'E':
+        num_elems = atoi(optarg);
+        break;
+      default:
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+  }
+
+  rocshmem_init();
+
+  rank = rocshmem_my_pe();
+  size = rocshmem_n_pes();
+
+  dest = (long *)rocshmem_malloc(num_elems * sizeof(long));
+  check = (long *)malloc(num_elems * sizeof(long));
+
+  /*
+   * Puts from different PEs to the same element race, so each run
+   * writes from one PE at a time to get comparable final contents.
+   */
+  t_plain = 0.0;
+  t_aggregate = 0.0;
+  for (int writer = 0; writer < size; writer++) {
+    int saved = num_messages;
+    if (rank != writer) num_messages = 0;
+
+    t_plain += run_bench(0, dest, rank, size);
+    for (int i = 0; i < num_elems; i++) {
+      check[i] = rocshmem_long_g(&dest[i], rank);
+    }
+
+    t_aggregate += run_bench(ROCSHMEM_CTX_AGGREGATE, dest, rank, size);
+    for (int i = 0; i < num_elems; i++) {
+      if (check[i] != rocshmem_long_g(&dest[i], rank)) errors++;
+    }
+
+    num_messages = saved;
+  }
+
+  if (errors) {
+    printf("PE %d: %d elements differ between the runs\n", rank, errors);
+  }
+
+  printf("PE %d: %.3f Mmsgs/s default, %.3f Mmsgs/s aggregated\n", rank,
+         num_messages / t_plain / 1e6, num_messages / t_aggregate / 1e6);
+
+  free(check);
+  rocshmem_free(dest);
+  rocshmem_finalize();
+
+  return errors ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,182 @@
+/******************************************************************************
+ * Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+
+#include "allreduce_schedule_gtest.hpp"
+
+using namespace rocshmem;
+
+namespace {
+
+constexpr int WRK_ELEMS{1024};
+
+const AllreduceAlgorithm scheduled[]{AllreduceAlgorithm::RECURSIVE_DOUBLING,
+                                     AllreduceAlgorithm::RABENSEIFNER};
+
+}  // namespace
+
+TEST(AllreduceScheduleTest, pof2_and_log2) {
+  ASSERT_EQ(allreduce_pof2(1), 1);
+  ASSERT_EQ(allreduce_pof2(2), 2);
+  ASSERT_EQ(allreduce_pof2(3), 2);
+  ASSERT_EQ(allreduce_pof2(64), 64);
+  ASSERT_EQ(allreduce_pof2(100), 64);
+  ASSERT_EQ(allreduce_log2(1), 0);
+  ASSERT_EQ(allreduce_log2(64), 6);
+}
+
+TEST(AllreduceScheduleTest, core_ranks_are_inverse) {
+  for (int n_pes{1}; n_pes <= 70; n_pes++) {
+    int pof2{allreduce_pof2(n_pes)};
+    int folded{0};
+    for (int rank{0}; rank < n_pes; rank++) {
+      int core{allreduce_core_rank(rank, n_pes)};
+      if (core < 0) {
+        folded++;
+        continue;
+      }
+      ASSERT_LT(core, pof2);
+      ASSERT_EQ(allreduce_team_rank(core, n_pes), rank);
+    }
+    ASSERT_EQ(folded, n_pes - pof2);
+  }
+}
+
+TEST(AllreduceScheduleTest, steps_pair_up) {
+  for (AllreduceAlgorithm algo : scheduled) {
+    for (int n_pes{1}; n_pes <= 40; n_pes++) {
+      for (int count : {1, 7, 64, 253}) {
+        for (int step{0}; step < allreduce_num_steps(algo, n_pes); step++) {
+          for (int rank{0}; rank < n_pes; rank++) {
+            AllreduceStep mine{allreduce_step(algo, rank, n_pes, count, step)};
+            if (mine.peer < 0) {
+              continue;
+            }
+            ASSERT_NE(mine.peer, rank);
+            ASSERT_LT(mine.peer, n_pes);
+            AllreduceStep theirs{
+                allreduce_step(algo, mine.peer, n_pes, count, step)};
+            ASSERT_EQ(theirs.peer, rank);
+            ASSERT_EQ(mine.sends, theirs.recvs);
+            ASSERT_EQ(mine.recvs, theirs.sends);
+            ASSERT_EQ(mine.reduce, theirs.reduce);
+            ASSERT_EQ(mine.wrk_offset, theirs.wrk_offset);
+            if (mine.sends) {
+              ASSERT_EQ(mine.send_count, theirs.recv_count);
+              ASSERT_EQ(mine.send_offset, theirs.recv_offset);
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(AllreduceScheduleTest, passes_fit_workspace) {
+  for (AllreduceAlgorithm algo : scheduled) {
+    for (int n_pes : {1, 2, 3, 8, 33, 64, 100, 256}) {
+      for (int wrk_elems : {256, 1024, 4096}) {
+        int pass{allreduce_pass_elems(algo, n_pes, wrk_elems)};
+        if (pass == 0) {
+          continue;
+        }
+        ASSERT_LE(allreduce_pass_wrk_elems(algo, n_pes, pass), wrk_elems / 2);
+        for (int rank{0}; rank < n_pes; rank++) {
+          for (int step{0}; step < allreduce_num_steps(algo, n_pes); step++) {
+            AllreduceStep s{allreduce_step(algo, rank, n_pes, pass, step)};
+            if (s.reduce && s.recvs) {
+              ASSERT_LE(s.wrk_offset + s.recv_count, wrk_elems / 2);
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(AllreduceScheduleTest, simulation_any_team_size) {
+  for (AllreduceAlgorithm algo : scheduled) {
+    for (int n_pes{1}; n_pes <= 40; n_pes++) {
+      for (int nelems : {1, 5, 100, 1000}) {
+        AllreduceSimulation sim{algo, n_pes, nelems, WRK_ELEMS,
+                                static_cast<uint64_t>(n_pes * 7919 + nelems)};
+        ASSERT_TRUE(sim.run()) << "deadlock, n_pes " << n_pes;
+        ASSERT_FALSE(sim.out_of_bounds()) << "n_pes " << n_pes;
+        ASSERT_FALSE(sim.overwrite()) << "n_pes " << n_pes;
+        ASSERT_TRUE(sim.flags_clear()) << "n_pes " << n_pes;
+        ASSERT_TRUE(sim.correct())
+            << "n_pes " << n_pes << " nelems " << nelems;
+      }
+    }
+  }
+}
+
+TEST(AllreduceScheduleTest, simulation_random_interleavings) {
+  for (AllreduceAlgorithm algo : scheduled) {
+    for (int n_pes : {3, 6, 8, 13, 63}) {
+      for (uint64_t seed{0}; seed < 20; seed++) {
+        AllreduceSimulation sim{algo, n_pes, 700, 256, seed};
+        ASSERT_TRUE(sim.run());
+        ASSERT_FALSE(sim.out_of_bounds());
+        ASSERT_FALSE(sim.overwrite());
+        ASSERT_TRUE(sim.flags_clear());
+        ASSERT_TRUE(sim.correct());
+      }
+    }
+  }
+}
+
+TEST(AllreduceScheduleTest, select_small_vectors_direct) {
+  ASSERT_EQ(allreduce_select(8, 16, sizeof(double), WRK_ELEMS, 256),
+            AllreduceAlgorithm::DIRECT);
+}
+
+TEST(AllreduceScheduleTest, select_mid_vectors_logarithmic) {
+  AllreduceAlgorithm algo{
+      allreduce_select(8, 200, sizeof(double), WRK_ELEMS, 256)};
+  ASSERT_TRUE(algo == AllreduceAlgorithm::RECURSIVE_DOUBLING ||
+              algo == AllreduceAlgorithm::RABENSEIFNER);
+
+  ASSERT_EQ(allreduce_select(64, 1000, sizeof(double), WRK_ELEMS, 256),
+            AllreduceAlgorithm::RABENSEIFNER);
+}
+
+TEST(AllreduceScheduleTest, select_large_teams_without_ring) {
+  /* The ring needs 2 * n_pes sync slots */
+  for (int n_pes : {129, 200, 256, 1000}) {
+    AllreduceAlgorithm algo{
+        allreduce_select(n_pes, 4096, sizeof(double), WRK_ELEMS, 256)};
+    ASSERT_NE(algo, AllreduceAlgorithm::NONE) << "n_pes " << n_pes;
+    ASSERT_NE(algo, AllreduceAlgorithm::RING) << "n_pes " << n_pes;
+  }
+}
+
+TEST(AllreduceScheduleTest, cost_rejects_what_does_not_fit) {
+  ASSERT_EQ(allreduce_cost(AllreduceAlgorithm::DIRECT, 8, 129, 8, WRK_ELEMS,
+                           256),
+            0u);
+  ASSERT_EQ(allreduce_cost(AllreduceAlgorithm::RING, 129, 1, 8, WRK_ELEMS,
+                           256),
+            0u);
+  ASSERT_EQ(allreduce_cost(AllreduceAlgorithm::RABENSEIFNER, 1024, 1, 8,
+                           WRK_ELEMS, 256),
+            0u);
+}
@@ -0,0 +1,286 @@
+/******************************************************************************
+ * Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+
+#ifndef ROCSHMEM_ALLREDUCE_SCHEDULE_GTEST_HPP
+#define ROCSHMEM_ALLREDUCE_SCHEDULE_GTEST_HPP
+
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "../src/sync/allreduce_schedule.hpp"
+
+namespace rocshmem {
+
+/**
+ * @brief CPU simulation of a team running a scheduled allreduce
+ *
+ * Each PE mirrors the device loop: for every pass and step it puts its
+ * data (into the peer's workspace or vector), sets the peer's flag, waits
+ * for its own flag, clears it and finally combines the received workspace
+ * slot. A seeded scheduler steps one runnable PE at a time, so a PE can run
+ * passes ahead of its peers. Sums wrap around, and every PE contributes a
+ * distinct power of two per element, so a lost, duplicated or overwritten
+ * contribution changes the result.
+ */
+class AllreduceSimulation {
+ public:
+  AllreduceSimulation(AllreduceAlgorithm algo, int n_pes, int nelems,
+                      int wrk_elems, uint64_t seed)
+      : algo_{algo},
+        n_pes_{n_pes},
+        nelems_{nelems},
+        wrk_half_{wrk_elems / 2},
+        num_steps_{allreduce_num_steps(algo, n_pes)},
+        pass_elems_{allreduce_pass_elems(algo, n_pes, wrk_elems)},
+        rng_{seed},
+        pes_(n_pes) {
+    for (int pe{0}; pe < n_pes_; pe++) {
+      PeState& s{pes_[pe]};
+      s.dst.resize(nelems_);
+      for (int i{0}; i < nelems_; i++) {
+        s.dst[i] = contribution(pe, i);
+      }
+      s.wrk.assign(2 * wrk_half_, 0);
+      s.pending.assign(2 * wrk_half_, false);
+      s.flags.assign(2 * num_steps_, 0);
+    }
+  }
+
+  /**
+   * @brief Steps random runnable PEs until every PE has finished
+   *
+   * @return false if the team deadlocked
+   */
+  bool run() {
+    std::vector<int> runnable;
+    while (true) {
+      runnable.clear();
+      bool all_done{true};
+      for (int pe{0}; pe < n_pes_; pe++) {
+        if (!done(pe)) {
+          all_done = false;
+          if (can_step(pe)) {
+            runnable.push_back(pe);
+          }
+        }
+      }
+      if (all_done) {
+        return true;
+      }
+      if (runnable.empty()) {
+        return false;
+      }
+      std::uniform_int_distribution<size_t> pick{0, runnable.size() - 1};
+      step(runnable[pick(rng_)]);
+    }
+  }
+
+  /**
+   * @brief Checks that every PE holds the full reduction
+   */
+  bool correct() const {
+    for (const PeState& s : pes_) {
+      for (int i{0}; i < nelems_; i++) {
+        if (s.dst[i] != expected(i)) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  /**
+   * @brief A put landed on a workspace slot or flag not yet consumed
+   */
+  bool overwrite() const { return overwrite_; }
+
+  /**
+   * @brief A step moved data outside the pass or the workspace half
+   */
+  bool out_of_bounds() const { return out_of_bounds_; }
+
+  /**
+   * @brief Checks that every flag is clear again
+   */
+  bool flags_clear() const {
+    for (const PeState& s : pes_) {
+      for (int64_t flag : s.flags) {
+        if (flag != 0) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+ private:
+  enum Phase {
+    SEND = 0,
+    WAIT,
+    REDUCE,
+  };
+
+  struct PeState {
+    std::vector<uint64_t> dst;
+    std::vector<uint64_t> wrk;
+    std::vector<bool> pending;
+    std::vector<int64_t> flags;
+    int pass{0};
+    int step{0};
+    Phase phase{SEND};
+  };
+
+  static uint64_t contribution(int pe, int i) {
+    return (uint64_t{1} << (pe % 64)) * static_cast<uint64_t>(i % 7 + 1);
+  }
+
+  uint64_t expected(int i) const {
+    uint64_t sum{0};
+    for (int pe{0}; pe < n_pes_; pe++) {
+      sum += contribution(pe, i);
+    }
+    return sum;
+  }
+
+  int num_passes() const {
+    return (nelems_ + pass_elems_ - 1) / pass_elems_;
+  }
+
+  int pass_base(int pass) const { return pass * pass_elems_; }
+
+  int pass_count(int pass) const {
+    int left{nelems_ - pass_base(pass)};
+    return (left < pass_elems_) ? left : pass_elems_;
+  }
+
+  bool done(int pe) const { return pes_[pe].pass >= num_passes(); }
+
+  AllreduceStep current(int pe) const {
+    const PeState& s{pes_[pe]};
+    return allreduce_step(algo_, pe, n_pes_, pass_count(s.pass), s.step);
+  }
+
+  int flag_index(const PeState& s) const {
+    return (s.pass & 1) * num_steps_ + s.step;
+  }
+
+  int wrk_base(const PeState& s) const { return (s.pass & 1) * wrk_half_; }
+
+  bool can_step(int pe) const {
+    const PeState& s{pes_[pe]};
+    if (s.phase != WAIT) {
+      return true;
+    }
+    return s.flags[flag_index(s)] == 1;
+  }
+
+  void check_range(int offset, int count, int limit) {
+    if (offset < 0 || count < 0 || offset + count > limit) {
+      out_of_bounds_ = true;
+    }
+  }
+
+  void next_step(PeState* s) {
+    s->phase = SEND;
+    if (++s->step == num_steps_) {
+      s->step = 0;
+      s->pass++;
+    }
+  }
+
+  void step(int pe) {
+    PeState& s{pes_[pe]};
+    AllreduceStep st{current(pe)};
+    int base{pass_base(s.pass)};
+    int count{pass_count(s.pass)};
+
+    switch (s.phase) {
+      case SEND:
+        if (st.peer >= 0 && st.sends) {
+          PeState& peer{pes_[st.peer]};
+          check_range(st.send_offset, st.send_count, count);
+          for (int i{0}; i < st.send_count && !out_of_bounds_; i++) {
+            uint64_t value{s.dst[base + st.send_offset + i]};
+            if (st.reduce) {
+              check_range(st.wrk_offset, st.send_count, wrk_half_);
+              int slot{wrk_base(s) + st.wrk_offset + i};
+              if (out_of_bounds_) {
+                break;
+              }
+              if (peer.pending[slot]) {
+                overwrite_ = true;
+              }
+              peer.wrk[slot] = value;
+              peer.pending[slot] = true;
+            } else {
+              peer.dst[base + st.send_offset + i] = value;
+            }
+          }
+          int64_t& flag{peer.flags[flag_index(s)]};
+          if (flag != 0) {
+            overwrite_ = true;
+          }
+          flag = 1;
+        }
+        if (st.peer >= 0 && st.recvs) {
+          s.phase = WAIT;
+        } else {
+          next_step(&s);
+        }
+        return;
+      case WAIT:
+        s.flags[flag_index(s)] = 0;
+        s.phase = REDUCE;
+        return;
+      case REDUCE:
+        if (st.reduce) {
+          check_range(st.recv_offset, st.recv_count, count);
+          check_range(st.wrk_offset, st.recv_count, wrk_half_);
+          for (int i{0}; i < st.recv_count && !out_of_bounds_; i++) {
+            int slot{wrk_base(s) + st.wrk_offset + i};
+            s.dst[base + st.recv_offset + i] += s.wrk[slot];
+            s.pending[slot] = false;
+          }
+        }
+        next_step(&s);
+        return;
+    }
+  }
+
+  AllreduceAlgorithm algo_;
+  int n_pes_;
+  int nelems_;
+  int wrk_half_;
+  int num_steps_;
+  int pass_elems_;
+  std::mt19937_64 rng_;
+  std::vector<PeState> pes_;
+  bool overwrite_{false};
+  bool out_of_bounds_{false};
+};
+
+}  // namespace rocshmem
+
+#endif  // ROCSHMEM_ALLREDUCE_SCHEDULE_GTEST_HPP
@@ -0,0 +1,90 @@
+/******************************************************************************
+ * Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+
+#include "alltoall_schedule_gtest.hpp"
+
+#include <vector>
+
+using namespace rocshmem;
+
+TEST(AlltoallScheduleTest, every_step_is_a_permutation) {
+  for (int n_pes{1}; n_pes <= 70; n_pes++) {
+    for (int step{0}; step < n_pes; step++) {
+      std::vector<int> receivers(n_pes, 0);
+      for (int rank{0}; rank < n_pes; rank++) {
+        int peer{alltoall_peer(rank, step, n_pes)};
+        ASSERT_GE(peer, 0);
+        ASSERT_LT(peer, n_pes);
+        receivers[peer]++;
+      }
+      for (int count : receivers) {
+        ASSERT_EQ(count, 1) << "n_pes " << n_pes << " step " << step;
+      }
+    }
+  }
+}
+
+TEST(AlltoallScheduleTest, every_peer_once_per_rank) {
+  for (int n_pes{1}; n_pes <= 70; n_pes++) {
+    for (int rank{0}; rank < n_pes; rank++) {
+      std::vector<int> seen(n_pes, 0);
+      for (int step{0}; step < n_pes; step++) {
+        seen[alltoall_peer(rank, step, n_pes)]++;
+      }
+      ASSERT_EQ(alltoall_peer(rank, 0, n_pes), rank);
+      for (int count : seen) {
+        ASSERT_EQ(count, 1) << "n_pes " << n_pes << " rank " << rank;
+      }
+    }
+  }
+}
+
+TEST(AlltoallScheduleTest, xor_pairs_for_powers_of_two) {
+  for (int n_pes : {2, 4, 8, 64}) {
+    for (int step{1}; step < n_pes; step++) {
+      for (int rank{0}; rank < n_pes; rank++) {
+        int peer{alltoall_peer(rank, step, n_pes)};
+        ASSERT_EQ(alltoall_peer(peer, step, n_pes), rank);
+      }
+    }
+  }
+}
+
+TEST(AlltoallScheduleTest, select_by_size) {
+  auto AUTO{AlltoallSchedule::AUTO};
+  ASSERT_EQ(alltoall_select(AUTO, 8, 1024, 4),
+            AlltoallSchedule::PAIRWISE_WAVE);
+  ASSERT_EQ(alltoall_select(AUTO, 8, ALLTOALL_WAVE_MAX_BYTES + 1, 4),
+            AlltoallSchedule::PAIRWISE);
+  ASSERT_EQ(alltoall_select(AUTO, 8, 1024, 1), AlltoallSchedule::PAIRWISE);
+  ASSERT_EQ(alltoall_select(AUTO, 2, 1024, 4), AlltoallSchedule::PAIRWISE);
+}
+
+TEST(AlltoallScheduleTest, select_forced) {
+  ASSERT_EQ(alltoall_select(AlltoallSchedule::LINEAR, 8, 1024, 4),
+            AlltoallSchedule::LINEAR);
+  ASSERT_EQ(alltoall_select(AlltoallSchedule::PAIRWISE_WAVE, 8, 1 << 20, 4),
+            AlltoallSchedule::PAIRWISE_WAVE);
+  /* A single wavefront cannot spread the steps */
+  ASSERT_EQ(alltoall_select(AlltoallSchedule::PAIRWISE_WAVE, 8, 1024, 1),
+            AlltoallSchedule::PAIRWISE);
+}
@@ -0,0 +1,145 @@
+/******************************************************************************
+ * Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+
+#include "barrier_schedule_gtest.hpp"
+
+using namespace rocshmem;
+
+TEST(BarrierScheduleTest, kind_by_team_size) {
+  ASSERT_EQ(barrier_kind(1), BarrierKind::DIRECT);
+  ASSERT_EQ(barrier_kind(BARRIER_TREE_MIN_PES - 1), BarrierKind::DIRECT);
+  ASSERT_EQ(barrier_kind(BARRIER_TREE_MIN_PES), BarrierKind::TREE);
+  ASSERT_EQ(barrier_kind(BARRIER_DISSEMINATION_MIN_PES - 1),
+            BarrierKind::TREE);
+  ASSERT_EQ(barrier_kind(BARRIER_DISSEMINATION_MIN_PES),
+            BarrierKind::DISSEMINATION);
+  ASSERT_EQ(barrier_kind(4096), BarrierKind::DISSEMINATION);
+}
+
+TEST(BarrierScheduleTest, dissemination_rounds) {
+  ASSERT_EQ(dissemination_rounds(1), 0);
+  ASSERT_EQ(dissemination_rounds(2), 1);
+  ASSERT_EQ(dissemination_rounds(3), 2);
+  ASSERT_EQ(dissemination_rounds(64), 6);
+  ASSERT_EQ(dissemination_rounds(65), 7);
+}
+
+TEST(BarrierScheduleTest, dissemination_peers_are_inverse) {
+  for (int n_pes : {2, 3, 7, 64, 100}) {
+    for (int round{0}; round < dissemination_rounds(n_pes); round++) {
+      for (int rank{0}; rank < n_pes; rank++) {
+        int to{dissemination_to(rank, round, n_pes)};
+        ASSERT_NE(to, rank);
+        ASSERT_EQ(dissemination_from(to, round, n_pes), rank);
+      }
+    }
+  }
+}
+
+TEST(BarrierScheduleTest, dissemination_spreads_every_arrival) {
+  for (int n_pes : {1, 2, 3, 5, 31, 64, 100}) {
+    /* knows[rank][p]: rank has (transitively) heard that p arrived */
+    std::vector<std::vector<bool>> knows(n_pes, std::vector<bool>(n_pes));
+    for (int rank{0}; rank < n_pes; rank++) {
+      knows[rank][rank] = true;
+    }
+    for (int round{0}; round < dissemination_rounds(n_pes); round++) {
+      auto before{knows};
+      for (int rank{0}; rank < n_pes; rank++) {
+        const auto& from{before[dissemination_from(rank, round, n_pes)]};
+        for (int p{0}; p < n_pes; p++) {
+          knows[rank][p] = knows[rank][p] || from[p];
+        }
+      }
+    }
+    for (int rank{0}; rank < n_pes; rank++) {
+      for (int p{0}; p < n_pes; p++) {
+        ASSERT_TRUE(knows[rank][p]) << n_pes << " PEs: " << rank << " " << p;
+      }
+    }
+  }
+}
+
+TEST(BarrierScheduleTest, tree_links_every_rank_once) {
+  for (int n_pes : {1, 2, 4, 5, 17, 63, 100}) {
+    std::vector<int> seen(n_pes, 0);
+    for (int rank{0}; rank < n_pes; rank++) {
+      int first{tree_first_child(rank, BARRIER_TREE_RADIX)};
+      int children{tree_num_children(rank, BARRIER_TREE_RADIX, n_pes)};
+      ASSERT_LE(children, BARRIER_TREE_RADIX);
+      for (int i{0}; i < children; i++) {
+        int child{first + i};
+        ASSERT_LT(child, n_pes);
+        ASSERT_EQ(tree_parent(child, BARRIER_TREE_RADIX), rank);
+        ASSERT_EQ(tree_child_index(child, BARRIER_TREE_RADIX), i);
+        seen[child]++;
+      }
+    }
+    ASSERT_EQ(seen[0], 0);
+    for (int rank{1}; rank < n_pes; rank++) {
+      ASSERT_EQ(seen[rank], 1);
+    }
+  }
+}
+
+class BarrierSimulationTest
+    : public ::testing::TestWithParam<std::tuple<BarrierKind, int>> {};
+
+TEST_P(BarrierSimulationTest, consecutive_barriers) {
+  BarrierKind kind{std::get<0>(GetParam())};
+  int n_pes{std::get<1>(GetParam())};
+
+  for (uint64_t seed{1}; seed <= 20; seed++) {
+    BarrierSimulation sim{kind, n_pes, 8, seed};
+    ASSERT_TRUE(sim.run()) << "deadlock, seed " << seed;
+    ASSERT_FALSE(sim.early_exit()) << "seed " << seed;
+    ASSERT_FALSE(sim.lost_signal()) << "seed " << seed;
+    ASSERT_TRUE(sim.flags_clear()) << "seed " << seed;
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    Direct, BarrierSimulationTest,
+    ::testing::Combine(::testing::Values(BarrierKind::DIRECT),
+                       ::testing::Values(1, 2, 3, 8, 15)));
+
+INSTANTIATE_TEST_SUITE_P(
+    Tree, BarrierSimulationTest,
+    ::testing::Combine(::testing::Values(BarrierKind::TREE),
+                       ::testing::Values(1, 2, 5, 16, 21, 63, 200)));
+
+INSTANTIATE_TEST_SUITE_P(
+    Dissemination, BarrierSimulationTest,
+    ::testing::Combine(::testing::Values(BarrierKind::DISSEMINATION),
+                       ::testing::Values(1, 2, 3, 64, 100, 256)));
+
+TEST(BarrierScheduleTest, forced_kind) {
+  ASSERT_EQ(barrier_select(BarrierKind::AUTO, 2), BarrierKind::DIRECT);
+  ASSERT_EQ(barrier_select(BarrierKind::AUTO, BARRIER_DISSEMINATION_MIN_PES),
+            BarrierKind::DISSEMINATION);
+  ASSERT_EQ(barrier_select(BarrierKind::DISSEMINATION, 2),
+            BarrierKind::DISSEMINATION);
+  ASSERT_EQ(barrier_select(BarrierKind::TREE, 2), BarrierKind::TREE);
+  ASSERT_EQ(barrier_select(BarrierKind::DIRECT, 100), BarrierKind::DIRECT);
+  ASSERT_EQ(barrier_select(BarrierKind::DIRECT, 1024),
+            BarrierKind::DISSEMINATION);
+}
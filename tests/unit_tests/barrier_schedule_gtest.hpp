@@ -0,0 +1,306 @@
+/******************************************************************************
+ * Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+
+#ifndef ROCSHMEM_BARRIER_SCHEDULE_GTEST_HPP
+#define ROCSHMEM_BARRIER_SCHEDULE_GTEST_HPP
+
+#include "gtest/gtest.h"
+
+#include <random>
+#include <vector>
+
+#include "../src/sync/barrier_schedule.hpp"
+
+namespace rocshmem {
+
+/**
+ * @brief CPU simulation of a team running back-to-back barriers
+ *
+ * Each PE is a small state machine that mirrors the device barrier for its
+ * BarrierKind and touches only its own pSync and the slots the schedule
+ * names on other PEs. A seeded scheduler steps one runnable PE at a time,
+ * so any interleaving of the PEs can be explored. The simulation records
+ * whether a PE left a barrier before every PE had entered it, whether a
+ * set/reset flag was set twice (a lost signal) and whether the team
+ * deadlocked.
+ */
+class BarrierSimulation {
+ public:
+  BarrierSimulation(BarrierKind kind, int n_pes, int num_barriers,
+                    uint64_t seed)
+      : kind_{barrier_select(kind, n_pes)},
+        n_pes_{n_pes},
+        num_barriers_{num_barriers},
+        rng_{seed},
+        psync_(n_pes, std::vector<int64_t>(ROCSHMEM_BARRIER_SYNC_SIZE, 0)),
+        pes_(n_pes) {}
+
+  /**
+   * @brief Steps random runnable PEs until every PE has finished
+   *
+   * @return false if the team deadlocked
+   */
+  bool run() {
+    std::vector<int> runnable;
+    while (true) {
+      runnable.clear();
+      bool all_done{true};
+      for (int pe{0}; pe < n_pes_; pe++) {
+        if (pes_[pe].barrier < num_barriers_) {
+          all_done = false;
+          if (can_step(pe)) {
+            runnable.push_back(pe);
+          }
+        }
+      }
+      if (all_done) {
+        return true;
+      }
+      if (runnable.empty()) {
+        return false;
+      }
+      std::uniform_int_distribution<size_t> pick{0, runnable.size() - 1};
+      step(runnable[pick(rng_)]);
+    }
+  }
+
+  bool early_exit() const { return early_exit_; }
+
+  bool lost_signal() const { return lost_signal_; }
+
+  /**
+   * @brief Checks that every flag is back to ROCSHMEM_SYNC_VALUE
+   */
+  bool flags_clear() const {
+    for (const auto& slots : psync_) {
+      for (int64_t slot : slots) {
+        if (slot != ROCSHMEM_SYNC_VALUE) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+ private:
+  /**
+   * @brief Progress of one PE
+   *
+   * phase and index encode the position inside the current barrier.
+   */
+  struct PeState {
+    int barrier{0};
+    int phase{0};
+    int index{0};
+  };
+
+  enum Phase {
+    ENTER = 0,
+    GATHER,
+    ARRIVE,
+    WAIT_RELEASE,
+    RELEASE,
+    SIGNAL,
+    WAIT_SIGNAL,
+  };
+
+  int rank_children(int rank) const {
+    return tree_num_children(rank, BARRIER_TREE_RADIX, n_pes_);
+  }
+
+  void set_flag(int pe, int slot) {
+    if (psync_[pe][slot] != ROCSHMEM_SYNC_VALUE) {
+      lost_signal_ = true;
+    }
+    psync_[pe][slot] = 1;
+  }
+
+  bool can_step(int pe) const {
+    const PeState& s{pes_[pe]};
+    const auto& slots{psync_[pe]};
+    switch (s.phase) {
+      case GATHER:
+        if (kind_ == BarrierKind::DIRECT) {
+          return slots[s.index + 1] == 1;
+        }
+        return slots[BARRIER_TREE_ARRIVAL_SLOT + s.index] == 1;
+      case WAIT_RELEASE:
+        return slots[BARRIER_TREE_RELEASE_SLOT] == 1;
+      case WAIT_SIGNAL:
+        return slots[s.index] >= 1;
+      default:
+        return true;
+    }
+  }
+
+  void enter(int pe) {
+    PeState& s{pes_[pe]};
+    s.index = 0;
+    entered_[s.barrier]++;
+  }
+
+  void leave(int pe) {
+    PeState& s{pes_[pe]};
+    if (entered_[s.barrier] != n_pes_) {
+      early_exit_ = true;
+    }
+    s.barrier++;
+    s.phase = ENTER;
+  }
+
+  void step(int pe) {
+    PeState& s{pes_[pe]};
+    if (s.phase == ENTER) {
+      if (entered_.size() <= static_cast<size_t>(s.barrier)) {
+        entered_.resize(s.barrier + 1, 0);
+      }
+      enter(pe);
+    }
+    switch (kind_) {
+      case BarrierKind::DIRECT:
+        step_direct(pe);
+        break;
+      case BarrierKind::TREE:
+        step_tree(pe);
+        break;
+      case BarrierKind::DISSEMINATION:
+        step_dissemination(pe);
+        break;
+      case BarrierKind::AUTO:
+        /* Resolved by barrier_select in the constructor */
+        break;
+    }
+  }
+
+  void step_direct(int pe) {
+    PeState& s{pes_[pe]};
+    switch (s.phase) {
+      case ENTER:
+        s.phase = (pe == 0) ? GATHER : ARRIVE;
+        if (pe == 0 && n_pes_ == 1) {
+          leave(pe);
+        }
+        return;
+      case GATHER:
+        psync_[pe][s.index + 1] = ROCSHMEM_SYNC_VALUE;
+        if (++s.index == n_pes_ - 1) {
+          s.phase = RELEASE;
+          s.index = 0;
+        }
+        return;
+      case RELEASE:
+        set_flag(s.index + 1, 0);
+        if (++s.index == n_pes_ - 1) {
+          leave(pe);
+        }
+        return;
+      case ARRIVE:
+        set_flag(0, pe);
+        s.phase = WAIT_RELEASE;
+        return;
+      case WAIT_RELEASE:
+        psync_[pe][0] = ROCSHMEM_SYNC_VALUE;
+        leave(pe);
+        return;
+    }
+  }
+
+  void step_tree(int pe) {
+    PeState& s{pes_[pe]};
+    switch (s.phase) {
+      case ENTER:
+        s.phase = GATHER;
+        if (rank_children(pe) == 0) {
+          s.phase = (pe == 0) ? RELEASE : ARRIVE;
+          if (pe == 0) {
+            leave(pe);
+          }
+        }
+        return;
+      case GATHER:
+        psync_[pe][BARRIER_TREE_ARRIVAL_SLOT + s.index] = ROCSHMEM_SYNC_VALUE;
+        if (++s.index == rank_children(pe)) {
+          s.index = 0;
+          s.phase = (pe == 0) ? RELEASE : ARRIVE;
+        }
+        return;
+      case ARRIVE:
+        set_flag(tree_parent(pe, BARRIER_TREE_RADIX),
+                 BARRIER_TREE_ARRIVAL_SLOT +
+                     tree_child_index(pe, BARRIER_TREE_RADIX));
+        s.phase = WAIT_RELEASE;
+        return;
+      case WAIT_RELEASE:
+        psync_[pe][BARRIER_TREE_RELEASE_SLOT] = ROCSHMEM_SYNC_VALUE;
+        s.phase = RELEASE;
+        if (rank_children(pe) == 0) {
+          leave(pe);
+        }
+        return;
+      case RELEASE:
+        set_flag(tree_first_child(pe, BARRIER_TREE_RADIX) + s.index,
+                 BARRIER_TREE_RELEASE_SLOT);
+        if (++s.index == rank_children(pe)) {
+          leave(pe);
+        }
+        return;
+    }
+  }
+
+  void step_dissemination(int pe) {
+    PeState& s{pes_[pe]};
+    int rounds{dissemination_rounds(n_pes_)};
+    switch (s.phase) {
+      case ENTER:
+        s.phase = SIGNAL;
+        if (rounds == 0) {
+          leave(pe);
+        }
+        return;
+      case SIGNAL:
+        psync_[dissemination_to(pe, s.index, n_pes_)][s.index]++;
+        s.phase = WAIT_SIGNAL;
+        return;
+      case WAIT_SIGNAL:
+        psync_[pe][s.index]--;
+        s.phase = SIGNAL;
+        if (++s.index == rounds) {
+          leave(pe);
+        }
+        return;
+    }
+  }
+
+  BarrierKind kind_;
+  int n_pes_;
+  int num_barriers_;
+  std::mt19937_64 rng_;
+  std::vector<std::vector<int64_t>> psync_;
+  std::vector<PeState> pes_;
+  std::vector<int> entered_;
+  bool early_exit_{false};
+  bool lost_signal_{false};
+};
+
+}  // namespace rocshmem
+
+#endif  // ROCSHMEM_BARRIER_SCHEDULE_GTEST_HPP
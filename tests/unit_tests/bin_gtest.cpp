@@ -50,3 +50,21 @@ TEST_F(BinTestFixture, retrieval_check) {
   ASSERT_EQ(p_xa, g_xa);
   ASSERT_EQ(p_xb, g_xb);
 }
+
+TEST_F(BinTestFixture, take_if_check) {
+  char* p_xa{reinterpret_cast<char*>(0xa)};
+  char* p_xb{reinterpret_cast<char*>(0xb)};
+  char* p_xc{reinterpret_cast<char*>(0xc)};
+  bin_.put(p_xa);
+  bin_.put(p_xb);
+  bin_.put(p_xc);
+
+  char* taken{nullptr};
+  ASSERT_TRUE(bin_.take_if([&](char* p) { return p == p_xb; }, &taken));
+  ASSERT_EQ(taken, p_xb);
+  ASSERT_EQ(bin_.size(), 2);
+  ASSERT_FALSE(bin_.take_if([&](char* p) { return p == p_xb; }, &taken));
+
+  ASSERT_EQ(bin_.get(), p_xc);
+  ASSERT_EQ(bin_.get(), p_xa);
+}
@@ -0,0 +1,68 @@
+/******************************************************************************
+ * Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+
+#include "broadcast_schedule_gtest.hpp"
+
+using namespace rocshmem;
+
+TEST(BroadcastScheduleTest, every_pe_reached_once) {
+  for (BroadcastTopology topo :
+       {BroadcastTopology::CHAIN, BroadcastTopology::BINARY_TREE}) {
+    for (int n_pes{1}; n_pes <= 100; n_pes++) {
+      ASSERT_EQ(broadcast_arrival_rounds(n_pes, topo).size(),
+                static_cast<size_t>(n_pes))
+          << "n_pes " << n_pes;
+    }
+  }
+}
+
+TEST(BroadcastScheduleTest, parent_matches_children) {
+  for (BroadcastTopology topo :
+       {BroadcastTopology::CHAIN, BroadcastTopology::BINARY_TREE}) {
+    for (int n_pes : {2, 3, 7, 8, 33}) {
+      ASSERT_EQ(broadcast_parent(0, topo), -1);
+      for (int vrank{0}; vrank < n_pes; vrank++) {
+        for (int i{0}; i < broadcast_num_children(vrank, n_pes, topo); i++) {
+          ASSERT_EQ(broadcast_parent(broadcast_child(vrank, i, topo), topo),
+                    vrank);
+        }
+      }
+    }
+  }
+}
+
+TEST(BroadcastScheduleTest, tree_depth) {
+  ASSERT_EQ(broadcast_tree_depth(1), 0);
+  ASSERT_EQ(broadcast_tree_depth(3), 1);
+  ASSERT_EQ(broadcast_tree_depth(4), 2);
+  ASSERT_EQ(broadcast_tree_depth(7), 2);
+  ASSERT_EQ(broadcast_tree_depth(8), 3);
+}
+
+TEST(BroadcastScheduleTest, topology_by_chunks) {
+  /* Many chunks amortize the chain fill */
+  ASSERT_EQ(broadcast_topology(8, 64), BroadcastTopology::CHAIN);
+  ASSERT_EQ(broadcast_topology(64, 256), BroadcastTopology::CHAIN);
+  /* Few chunks over many PEs favour the shallow tree */
+  ASSERT_EQ(broadcast_topology(64, 2), BroadcastTopology::BINARY_TREE);
+  ASSERT_EQ(broadcast_topology(3, 1), BroadcastTopology::CHAIN);
+}
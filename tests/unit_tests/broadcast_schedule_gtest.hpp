@@ -0,0 +1,61 @@
+/******************************************************************************
+ * Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+
+#ifndef ROCSHMEM_BROADCAST_SCHEDULE_GTEST_HPP
+#define ROCSHMEM_BROADCAST_SCHEDULE_GTEST_HPP
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+#include "../src/sync/broadcast_schedule.hpp"
+
+namespace rocshmem {
+
+/**
+ * @brief Round in which every vrank first holds a chunk
+ *
+ * Simulates one chunk travelling down the topology, one send per PE and
+ * round. Returns an empty vector if a vrank is reached twice or never.
+ */
+inline std::vector<int> broadcast_arrival_rounds(int n_pes,
+                                                 BroadcastTopology topo) {
+  std::vector<int> arrival(n_pes, -1);
+  arrival[0] = 0;
+  for (int vrank{0}; vrank < n_pes; vrank++) {
+    if (arrival[vrank] < 0) {
+      return {};
+    }
+    for (int i{0}; i < broadcast_num_children(vrank, n_pes, topo); i++) {
+      int child{broadcast_child(vrank, i, topo)};
+      if (child <= vrank || child >= n_pes || arrival[child] >= 0) {
+        return {};
+      }
+      arrival[child] = arrival[vrank] + i + 1;
+    }
+  }
+  return arrival;
+}
+
+}  // namespace rocshmem
+
+#endif  // ROCSHMEM_BROADCAST_SCHEDULE_GTEST_HPP
@@ -0,0 +1,118 @@
+/******************************************************************************
+ * Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+
+#include "dirty_pe_mask_gtest.hpp"
+
+#include <thread>
+
+using namespace rocshmem;
+
+TEST_F(DirtyPeMaskTestFixture, empty_mask) {
+  ASSERT_TRUE(marked().empty());
+  ASSERT_FALSE(mask_.test(0));
+}
+
+TEST_F(DirtyPeMaskTestFixture, marked_pes_visited_once_in_order) {
+  ASSERT_TRUE(mask_.mark(129));
+  ASSERT_TRUE(mask_.mark(3));
+  ASSERT_FALSE(mask_.mark(129));
+  ASSERT_TRUE(mask_.mark(64));
+  ASSERT_TRUE(mask_.mark(DirtyPeMask::CAPACITY - 1));
+
+  ASSERT_EQ(marked(),
+            (std::vector<int>{3, 64, 129, DirtyPeMask::CAPACITY - 1}));
+  ASSERT_TRUE(mask_.test(64));
+  ASSERT_FALSE(mask_.test(65));
+}
+
+TEST_F(DirtyPeMaskTestFixture, clear_unmarks_all) {
+  mask_.mark(1);
+  mask_.mark(200);
+  mask_.clear();
+
+  ASSERT_TRUE(marked().empty());
+  ASSERT_TRUE(mask_.mark(200));
+}
+
+TEST_F(DirtyPeMaskTestFixture, fits_capacity) {
+  ASSERT_TRUE(DirtyPeMask::fits(DirtyPeMask::CAPACITY));
+  ASSERT_FALSE(DirtyPeMask::fits(DirtyPeMask::CAPACITY + 1));
+}
+
+TEST_F(DirtyPeMaskTestFixture, concurrent_marks_set_each_bit_once) {
+  constexpr int num_threads{8};
+  std::vector<int> first_marks(num_threads, 0);
+  std::vector<std::thread> threads;
+  for (int t{0}; t < num_threads; t++) {
+    threads.emplace_back([&, t] {
+      for (int pe{0}; pe < DirtyPeMask::CAPACITY; pe++) {
+        first_marks[t] += mask_.mark(pe);
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  int total{0};
+  for (int count : first_marks) {
+    total += count;
+  }
+  ASSERT_EQ(total, DirtyPeMask::CAPACITY);
+  ASSERT_EQ(marked().size(), DirtyPeMask::CAPACITY);
+}
+
+TEST_F(DirtyPeMaskTestFixture, next_epoch_takes_marked_pes) {
+  mask_.mark(200);
+  mask_.mark(1);
+
+  std::vector<int> taken;
+  mask_.next_epoch([&](int pe) { taken.push_back(pe); });
+
+  ASSERT_EQ(taken, (std::vector<int>{1, 200}));
+  ASSERT_TRUE(marked().empty());
+  ASSERT_TRUE(mask_.mark(200));
+}
+
+TEST_F(DirtyPeMaskTestFixture, concurrent_marks_survive_next_epoch) {
+  constexpr int num_threads{4};
+  std::vector<int> visits(DirtyPeMask::CAPACITY, 0);
+  std::vector<std::thread> threads;
+  for (int t{0}; t < num_threads; t++) {
+    threads.emplace_back([&, t] {
+      for (int pe{t}; pe < DirtyPeMask::CAPACITY; pe += num_threads) {
+        mask_.mark(pe);
+      }
+    });
+  }
+  for (int i{0}; i < 100; i++) {
+    mask_.next_epoch([&](int pe) { visits[pe]++; });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  mask_.next_epoch([&](int pe) { visits[pe]++; });
+
+  for (int count : visits) {
+    ASSERT_EQ(count, 1);
+  }
+}
@@ -0,0 +1,51 @@
+/******************************************************************************
+ * Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+
+#ifndef ROCSHMEM_DIRTY_PE_MASK_GTEST_HPP
+#define ROCSHMEM_DIRTY_PE_MASK_GTEST_HPP
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+#include "../src/memory/dirty_pe_mask.hpp"
+
+namespace rocshmem {
+
+class DirtyPeMaskTestFixture : public ::testing::Test
+{
+  protected:
+    /**
+     * @brief Collects the marked PEs in visiting order
+     */
+    std::vector<int> marked() {
+        std::vector<int> pes;
+        mask_.for_each([&](int pe) { pes.push_back(pe); });
+        return pes;
+    }
+
+    DirtyPeMask mask_ {};
+};
+
+} // namespace rocshmem
+
+#endif // ROCSHMEM_DIRTY_PE_MASK_GTEST_HPP
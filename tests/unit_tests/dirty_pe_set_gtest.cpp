@@ -0,0 +1,102 @@
+/******************************************************************************
+ * Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+
+#include "dirty_pe_set_gtest.hpp"
+
+using namespace rocshmem;
+
+TEST_F(DirtyPeSetTestFixture, empty_set) {
+  ASSERT_EQ(set_.size(), 0);
+  ASSERT_TRUE(dirty_list().empty());
+}
+
+TEST_F(DirtyPeSetTestFixture, written_pes_listed_once) {
+  set_.mark_written(129);
+  set_.mark_written(3);
+  set_.mark_written(129);
+  set_.mark_written(64);
+
+  ASSERT_EQ(set_.size(), 3);
+  ASSERT_EQ(dirty_list(), (std::vector<int>{129, 3, 64}));
+}
+
+TEST_F(DirtyPeSetTestFixture, amos_share_flush) {
+  ASSERT_TRUE(set_.mark_amo(7));
+  ASSERT_FALSE(set_.mark_amo(7));
+  ASSERT_TRUE(set_.mark_amo(8));
+  ASSERT_EQ(set_.size(), 2);
+}
+
+TEST_F(DirtyPeSetTestFixture, write_requires_new_amo_flush) {
+  ASSERT_TRUE(set_.mark_amo(7));
+  set_.mark_written(7);
+  ASSERT_TRUE(set_.mark_amo(7));
+  ASSERT_EQ(set_.size(), 1);
+}
+
+TEST_F(DirtyPeSetTestFixture, clear_starts_new_epoch) {
+  set_.mark_written(1);
+  ASSERT_TRUE(set_.mark_amo(100));
+  set_.clear();
+
+  ASSERT_EQ(set_.size(), 0);
+  ASSERT_TRUE(set_.mark_amo(100));
+  set_.mark_written(1);
+  ASSERT_EQ(dirty_list(), (std::vector<int>{100, 1}));
+}
+
+TEST_F(DirtyPeSetTestFixture, concurrent_marks_survive_take) {
+  set_.set_shared(true);
+  std::vector<std::thread> threads;
+  std::vector<int> taken;
+  for (int t = 0; t < 4; t++) {
+    threads.emplace_back([this, t] {
+      for (int pe = t; pe < 130; pe += 4) {
+        set_.mark_written(pe);
+        set_.mark_amo(pe);
+      }
+    });
+  }
+  for (int i = 0; i < 100; i++) {
+    for (int pe : set_.take()) {
+      taken.push_back(pe);
+    }
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  for (int pe : set_.take()) {
+    taken.push_back(pe);
+  }
+
+  std::sort(taken.begin(), taken.end());
+  taken.erase(std::unique(taken.begin(), taken.end()), taken.end());
+  ASSERT_EQ(taken.size(), 130);
+}
+
+TEST_F(DirtyPeSetTestFixture, move_keeps_dirty_pes) {
+  set_.mark_written(5);
+  DirtyPeSet moved{std::move(set_)};
+
+  ASSERT_EQ(moved.take(), (std::vector<int>{5}));
+  ASSERT_TRUE(moved.mark_amo(5));
+}
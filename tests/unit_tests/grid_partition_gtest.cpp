@@ -0,0 +1,78 @@
+/******************************************************************************
+ * Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+
+#include "grid_partition_gtest.hpp"
+
+using namespace rocshmem;
+
+TEST(GridPartitionTest, slices_cover_buffer_in_order) {
+  for (size_t elem_size : {1, 4, 8, 16}) {
+    for (size_t num_parts : {1, 3, 8, 104}) {
+      for (size_t nelems : {0, 1, 63, 64, 1000, 123457}) {
+        size_t next{0};
+        for (size_t part{0}; part < num_parts; part++) {
+          GridSlice s{grid_slice(part, num_parts, nelems, elem_size)};
+          ASSERT_EQ(s.offset, next) << "part " << part << " of " << num_parts;
+          next += s.count;
+        }
+        ASSERT_EQ(next, nelems);
+      }
+    }
+  }
+}
+
+TEST(GridPartitionTest, slices_start_on_granule) {
+  for (size_t elem_size : {1, 2, 4, 8}) {
+    size_t granule{GRID_SLICE_BYTES / elem_size};
+    for (size_t part{0}; part < 7; part++) {
+      GridSlice s{grid_slice(part, 7, 100000, elem_size)};
+      ASSERT_EQ(s.offset % granule, 0u);
+    }
+  }
+}
+
+TEST(GridPartitionTest, slices_are_balanced) {
+  size_t granule{GRID_SLICE_BYTES / 8};
+  size_t smallest{~size_t{0}};
+  size_t largest{0};
+  for (size_t part{0}; part < 13; part++) {
+    GridSlice s{grid_slice(part, 13, 1 << 20, 8)};
+    smallest = std::min(smallest, s.count);
+    largest = std::max(largest, s.count);
+  }
+  ASSERT_LE(largest - smallest, granule);
+}
+
+TEST(GridPartitionTest, short_buffer_leaves_parts_empty) {
+  GridSlice first{grid_slice(0, 8, 10, 4)};
+  ASSERT_EQ(first.offset, 0u);
+  ASSERT_EQ(first.count, 10u);
+  for (size_t part{1}; part < 8; part++) {
+    ASSERT_EQ(grid_slice(part, 8, 10, 4).count, 0u);
+  }
+}
+
+TEST(GridPartitionTest, oversized_element_uses_one_per_granule) {
+  GridSlice s{grid_slice(1, 4, 4, 512)};
+  ASSERT_EQ(s.offset, 1u);
+  ASSERT_EQ(s.count, 1u);
+}
@@ -37,3 +37,51 @@ TEST_F(HeapMemoryTestFixture, size_check) {
 TEST_F(HeapMemoryTestFixture, ptr_check) {
   ASSERT_NE(heap_mem_.get_ptr(), nullptr);
 }
+
+TEST(HeapMemoryTest, huge_page_allocator) {
+  size_t size{3 << 20};
+  HeapMemory<HostHugePageAllocator> heap_mem{size};
+  ASSERT_EQ(heap_mem.get_size(), size);
+
+  char* ptr{heap_mem.get_ptr()};
+  ASSERT_NE(ptr, nullptr);
+  ASSERT_EQ(reinterpret_cast<uintptr_t>(ptr) % getpagesize(), 0);
+
+  ptr[0] = 1;
+  ptr[size - 1] = 1;
+  ASSERT_EQ(ptr[0] + ptr[size - 1], 2);
+}
+
+TEST(HeapMemoryTest, huge_page_allocator_prefault) {
+  size_t size{8 << 20};
+  setenv("ROCSHMEM_HOST_HEAP_PREFAULT_THREADS", "4", 1);
+  setenv("ROCSHMEM_HOST_HEAP_NUMA_NODE", "0", 1);
+  HeapMemory<HostHugePageAllocator> heap_mem{size};
+  unsetenv("ROCSHMEM_HOST_HEAP_NUMA_NODE");
+  unsetenv("ROCSHMEM_HOST_HEAP_PREFAULT_THREADS");
+
+  char* ptr{heap_mem.get_ptr()};
+  ASSERT_NE(ptr, nullptr);
+
+  /* Every page is resident before the test touches it */
+  size_t page_size = getpagesize();
+  size_t num_pages{size / page_size};
+  std::vector<unsigned char> resident(num_pages);
+  ASSERT_EQ(mincore(ptr, size, resident.data()), 0);
+  for (size_t i{0}; i < num_pages; i++) {
+    ASSERT_TRUE(resident[i] & 1) << "page " << i;
+  }
+
+  /* and was placed on the requested node */
+  std::vector<void*> pages(num_pages);
+  for (size_t i{0}; i < num_pages; i++) {
+    pages[i] = ptr + i * page_size;
+  }
+  std::vector<int> nodes(num_pages, -1);
+  ASSERT_EQ(syscall(SYS_move_pages, 0, num_pages, pages.data(), nullptr,
+                    nodes.data(), 0),
+            0);
+  for (size_t i{0}; i < num_pages; i++) {
+    ASSERT_EQ(nodes[i], 0) << "page " << i;
+  }
+}
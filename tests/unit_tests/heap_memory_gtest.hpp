@@ -26,6 +26,11 @@
 #include "gtest/gtest.h"
 
 #include <hip/hip_runtime_api.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <vector>
 
 #include "../src/memory/hip_allocator.hpp"
 #include "../src/memory/heap_memory.hpp"
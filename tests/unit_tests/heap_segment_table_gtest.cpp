@@ -0,0 +1,78 @@
+/******************************************************************************
+ * Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+
+
+#include "heap_segment_table_gtest.hpp"
+
+using namespace rocshmem;
+
+TEST_F(HeapSegmentTableTestFixture, empty_table) {
+  ASSERT_EQ(table_.get_num_segments(), 0);
+  ASSERT_EQ(table_.find_segment(segment_0_bases_[0]), -1);
+  ASSERT_EQ(table_.translate(segment_0_bases_[0], 1), nullptr);
+}
+
+TEST_F(HeapSegmentTableTestFixture, add_segments) {
+  ASSERT_EQ(table_.add_segment(segment_0_bases_[0], 0x1000, segment_0_bases_),
+            0);
+  ASSERT_EQ(table_.add_segment(segment_1_bases_[0], 0x2000, segment_1_bases_),
+            1);
+  ASSERT_EQ(table_.get_num_segments(), 2);
+  ASSERT_EQ(table_.get_local_base(1), segment_1_bases_[0]);
+  ASSERT_EQ(table_.get_size(1), 0x2000);
+  ASSERT_EQ(table_.get_remote_bases(1), segment_1_bases_);
+}
+
+TEST_F(HeapSegmentTableTestFixture, table_full) {
+  for (int i {0}; i < HeapSegmentTable::MAX_NUM_SEGMENTS; i++) {
+    ASSERT_EQ(table_.add_segment(segment_0_bases_[0] + i * 0x1000, 0x1000,
+                                 segment_0_bases_),
+              i);
+  }
+  ASSERT_EQ(table_.add_segment(segment_1_bases_[0], 0x1000, segment_1_bases_),
+            -1);
+}
+
+TEST_F(HeapSegmentTableTestFixture, find_segment) {
+  table_.add_segment(segment_0_bases_[0], 0x1000, segment_0_bases_);
+  table_.add_segment(segment_1_bases_[0], 0x2000, segment_1_bases_);
+
+  ASSERT_EQ(table_.find_segment(segment_0_bases_[0]), 0);
+  ASSERT_EQ(table_.find_segment(segment_0_bases_[0] + 0xfff), 0);
+  ASSERT_EQ(table_.find_segment(segment_0_bases_[0] + 0x1000), -1);
+  ASSERT_EQ(table_.find_segment(segment_1_bases_[0]), 1);
+  ASSERT_EQ(table_.find_segment(segment_1_bases_[0] + 0x1fff), 1);
+  ASSERT_EQ(table_.find_segment(segment_1_bases_[0] + 0x2000), -1);
+}
+
+TEST_F(HeapSegmentTableTestFixture, translate) {
+  table_.add_segment(segment_0_bases_[0], 0x1000, segment_0_bases_);
+  table_.add_segment(segment_1_bases_[0], 0x2000, segment_1_bases_);
+
+  ASSERT_EQ(table_.translate(segment_0_bases_[0] + 0x80, 1),
+            segment_0_bases_[1] + 0x80);
+  ASSERT_EQ(table_.translate(segment_1_bases_[0] + 0x1800, 1),
+            segment_1_bases_[1] + 0x1800);
+  ASSERT_EQ(table_.translate(segment_1_bases_[0] + 0x1800, 0),
+            segment_1_bases_[0] + 0x1800);
+  ASSERT_EQ(table_.translate(segment_1_bases_[0] + 0x2000, 1), nullptr);
+}
@@ -0,0 +1,94 @@
+/******************************************************************************
+ * Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+
+#include "index_free_list_gtest.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace rocshmem;
+
+TEST_F(IndexFreeListTestFixture, pops_in_ascending_order) {
+  for (int i {0}; i < capacity_; i++) {
+    ASSERT_EQ(list_.pop(), i);
+  }
+  ASSERT_EQ(list_.pop(), -1);
+}
+
+TEST_F(IndexFreeListTestFixture, push_makes_index_available) {
+  for (int i {0}; i < capacity_; i++) {
+    list_.pop();
+  }
+  list_.push(17);
+  list_.push(3);
+  ASSERT_EQ(list_.pop(), 3);
+  ASSERT_EQ(list_.pop(), 17);
+  ASSERT_EQ(list_.pop(), -1);
+}
+
+TEST_F(IndexFreeListTestFixture, empty_list) {
+  IndexFreeList empty {0};
+  ASSERT_EQ(empty.pop(), -1);
+}
+
+TEST_F(IndexFreeListTestFixture, concurrent_owners_are_exclusive) {
+  constexpr int num_threads {8};
+  constexpr int iterations {20000};
+  std::vector<std::atomic<int>> owners(capacity_);
+  std::atomic<int> violations {0};
+
+  auto worker = [&](int id) {
+    for (int i {0}; i < iterations; i++) {
+      int index {list_.pop()};
+      if (index < 0) {
+        continue;
+      }
+      int expected {0};
+      if (!owners[index].compare_exchange_strong(expected, id + 1)) {
+        violations++;
+      }
+      owners[index].store(0);
+      list_.push(index);
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (int t {0}; t < num_threads; t++) {
+    threads.emplace_back(worker, t);
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  ASSERT_EQ(violations.load(), 0);
+
+  /* Every index is back on the list exactly once */
+  std::vector<bool> seen(capacity_, false);
+  for (int i {0}; i < capacity_; i++) {
+    int index {list_.pop()};
+    ASSERT_GE(index, 0);
+    ASSERT_FALSE(seen[index]);
+    seen[index] = true;
+  }
+  ASSERT_EQ(list_.pop(), -1);
+}
@@ -0,0 +1,48 @@
+/******************************************************************************
+ * Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+
+#ifndef ROCSHMEM_INDEX_FREE_LIST_GTEST_HPP
+#define ROCSHMEM_INDEX_FREE_LIST_GTEST_HPP
+
+#include "gtest/gtest.h"
+
+#include "../src/host/index_free_list.hpp"
+
+namespace rocshmem {
+
+class IndexFreeListTestFixture : public ::testing::Test
+{
+  protected:
+    /**
+     * @brief Number of slots in the list under test
+     */
+    static constexpr int capacity_ {40};
+
+    /**
+     * @brief List under test
+     */
+    IndexFreeList list_ {capacity_};
+};
+
+} // namespace rocshmem
+
+#endif // ROCSHMEM_INDEX_FREE_LIST_GTEST_HPP
@@ -140,3 +140,108 @@ TEST_F(SingleHeapTestFixture, alloc_4097) {
   expected_avail = single_heap_.get_size();
   ASSERT_EQ(single_heap_.get_avail(), expected_avail);
 }
+
+TEST_F(SingleHeapTestFixture, add_segment) {
+  size_t request_size{single_heap_.get_size()};
+  void* ptr_1{nullptr};
+  void* ptr_2{nullptr};
+
+  single_heap_.malloc(&ptr_1, request_size);
+  ASSERT_NE(ptr_1, nullptr);
+  single_heap_.malloc(&ptr_2, request_size);
+  ASSERT_EQ(ptr_2, nullptr);
+
+  int segment{single_heap_.add_segment(request_size)};
+  ASSERT_EQ(segment, 1);
+  ASSERT_EQ(single_heap_.get_num_segments(), 2);
+  ASSERT_EQ(single_heap_.get_segment_size(segment), request_size);
+  ASSERT_EQ(single_heap_.get_size(), 2 * request_size);
+
+  single_heap_.malloc(&ptr_2, request_size);
+  ASSERT_EQ(ptr_2, single_heap_.get_segment_base_ptr(segment));
+  ASSERT_EQ(single_heap_.get_used(), 2 * request_size);
+
+  single_heap_.free(ptr_1);
+  single_heap_.free(ptr_2);
+  ASSERT_EQ(single_heap_.get_used(), 0);
+}
+
+TEST_F(SingleHeapTestFixture, realloc_in_place) {
+  void* ptr{nullptr};
+  single_heap_.malloc(&ptr, 128);
+  ASSERT_NE(ptr, nullptr);
+
+  void* new_ptr{single_heap_.realloc(ptr, 256)};
+  ASSERT_EQ(new_ptr, ptr);
+  ASSERT_EQ(single_heap_.get_used(), 256);
+
+  single_heap_.free(new_ptr);
+  ASSERT_EQ(single_heap_.get_used(), 0);
+}
+
+TEST_F(SingleHeapTestFixture, realloc_moves) {
+  void* ptr{nullptr};
+  void* neighbor{nullptr};
+  single_heap_.malloc(&ptr, 256);
+  single_heap_.malloc(&neighbor, 256);
+  ASSERT_EQ(reinterpret_cast<char*>(neighbor), reinterpret_cast<char*>(ptr) + 256);
+
+  void* new_ptr{single_heap_.realloc(ptr, 512)};
+  ASSERT_NE(new_ptr, nullptr);
+  ASSERT_NE(new_ptr, ptr);
+  ASSERT_EQ(single_heap_.get_used(), 768);
+
+  single_heap_.free(new_ptr);
+  single_heap_.free(neighbor);
+  ASSERT_EQ(single_heap_.get_used(), 0);
+}
+
+TEST_F(SingleHeapTestFixture, malign) {
+  size_t alignment{1 << 16};
+  void* ptr{single_heap_.malign(alignment, 300)};
+  ASSERT_NE(ptr, nullptr);
+  ASSERT_EQ(reinterpret_cast<uintptr_t>(ptr) % alignment, 0);
+  ASSERT_EQ(single_heap_.get_used(), 512);
+
+  ASSERT_EQ(single_heap_.malign(3, 300), nullptr);
+
+  single_heap_.free(ptr);
+  ASSERT_EQ(single_heap_.get_used(), 0);
+}
+
+TEST_F(SingleHeapTestFixture, calloc_overflow) {
+  ASSERT_EQ(single_heap_.calloc(SIZE_MAX, 2), nullptr);
+  ASSERT_EQ(single_heap_.get_used(), 0);
+}
+
+TEST_F(SingleHeapTestFixture, stats) {
+  void* ptr_1{nullptr};
+  void* ptr_2{nullptr};
+  single_heap_.malloc(&ptr_1, 200);
+  single_heap_.malloc(&ptr_2, 1000);
+
+  rocshmem_heap_stats_t stats;
+  single_heap_.get_stats(&stats);
+  ASSERT_EQ(stats.used_bytes, 1280);
+  ASSERT_EQ(stats.used_bytes + stats.free_bytes, single_heap_.get_size());
+  ASSERT_EQ(stats.high_water_bytes, 1280);
+  ASSERT_EQ(stats.largest_free_block, single_heap_.get_size() / 2);
+  ASSERT_EQ(stats.num_segments, 1);
+  ASSERT_EQ(stats.num_allocs, 2);
+  ASSERT_EQ(stats.allocated_blocks[8], 1);
+  ASSERT_EQ(stats.allocated_blocks[10], 1);
+
+  single_heap_.free(ptr_1);
+  single_heap_.free(ptr_2);
+  single_heap_.get_stats(&stats);
+  ASSERT_EQ(stats.used_bytes, 0);
+  ASSERT_EQ(stats.high_water_bytes, 1280);
+  ASSERT_EQ(stats.num_frees, 2);
+  ASSERT_EQ(stats.allocated_blocks[8], 0);
+
+  single_heap_.reset_stats();
+  single_heap_.get_stats(&stats);
+  ASSERT_EQ(stats.high_water_bytes, 0);
+  ASSERT_EQ(stats.num_allocs, 0);
+  ASSERT_EQ(stats.num_frees, 0);
+}
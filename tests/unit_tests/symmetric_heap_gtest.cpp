@@ -42,6 +42,32 @@ TEST_F(SymmetricHeapTestFixture, window_info) {
                    &flag);
   ASSERT_NE(0, flag);
   ASSERT_NE(nullptr, window_base_addr);
+  ASSERT_TRUE(win_info_ptr->contains(symmetric_heap_.get_local_heap_base()));
+}
+
+TEST_F(SymmetricHeapTestFixture, grow_attaches_window) {
+  auto win_info_ptr{symmetric_heap_.get_window_info()};
+
+  int segment{symmetric_heap_.grow(symmetric_heap_.get_base_size())};
+  ASSERT_GT(segment, 0);
+
+  auto *segment_table{symmetric_heap_.get_segment_table()};
+  char *segment_base{segment_table->get_local_base(segment)};
+  ASSERT_TRUE(win_info_ptr->contains(segment_base));
+  ASSERT_FALSE(win_info_ptr->in_base(segment_base));
+
+  int *flavor{nullptr};
+  int flag{0};
+  MPI_Win_get_attr(win_info_ptr->get_win(segment_base), MPI_WIN_CREATE_FLAVOR,
+                   &flavor, &flag);
+  ASSERT_NE(0, flag);
+  ASSERT_EQ(MPI_WIN_FLAVOR_DYNAMIC, *flavor);
+
+  int my_pe{0};
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_pe);
+  MPI_Aint address{0};
+  MPI_Get_address(segment_base + 8, &address);
+  ASSERT_EQ(address, win_info_ptr->get_offset(segment_base + 8, my_pe));
 }
 
 TEST_F(SymmetricHeapTestFixture, heap_bases) {
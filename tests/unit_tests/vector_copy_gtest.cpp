@@ -0,0 +1,84 @@
+/******************************************************************************
+ * Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+
+#include "vector_copy_gtest.hpp"
+
+using namespace rocshmem;
+
+TEST_F(VectorCopyTestFixture, small_copy_has_no_body) {
+  CopySplit split {copy_split(addr(0), addr(0), VECTOR_COPY_MIN_BYTES - 1)};
+  ASSERT_EQ(split.head, VECTOR_COPY_MIN_BYTES - 1);
+  ASSERT_EQ(split.body, 0);
+  ASSERT_EQ(split.tail, 0);
+}
+
+TEST_F(VectorCopyTestFixture, misaligned_pair_has_no_body) {
+  CopySplit split {copy_split(addr(0), addr(8), 4096)};
+  ASSERT_EQ(split.head, 4096);
+  ASSERT_EQ(split.body, 0);
+  ASSERT_EQ(split.tail, 0);
+}
+
+TEST_F(VectorCopyTestFixture, aligned_copy_is_all_body) {
+  CopySplit split {copy_split(addr(32), addr(64), 4096)};
+  ASSERT_EQ(split.head, 0);
+  ASSERT_EQ(split.body, 4096);
+  ASSERT_EQ(split.tail, 0);
+}
+
+TEST_F(VectorCopyTestFixture, split_covers_copy_for_every_alignment) {
+  for (uintptr_t offset {0}; offset < VECTOR_COPY_WIDTH; offset++) {
+    for (size_t size : {VECTOR_COPY_MIN_BYTES, VECTOR_COPY_MIN_BYTES + 1,
+                        size_t {1000}, size_t {65537}}) {
+      CopySplit split {copy_split(addr(offset), addr(offset + 48), size)};
+      ASSERT_EQ(split.head + split.body + split.tail, size);
+      ASSERT_EQ((offset + split.head) % VECTOR_COPY_WIDTH, 0);
+      ASSERT_LT(split.head, VECTOR_COPY_WIDTH);
+      ASSERT_LT(split.tail, VECTOR_COPY_WIDTH);
+      ASSERT_EQ(split.body % VECTOR_COPY_WIDTH, 0);
+      ASSERT_GT(split.body, 0);
+    }
+  }
+}
+
+TEST_F(VectorCopyTestFixture, every_vector_copied_once) {
+  for (size_t num_lanes : {1, 3, 64, 256, 1024}) {
+    for (size_t num_vectors : {0, 1, 63, 64, 65, 255, 256, 257, 4099}) {
+      std::vector<int> count {visits(num_lanes, num_vectors)};
+      for (size_t v {0}; v < num_vectors; v++) {
+        ASSERT_EQ(count[v], 1) << num_lanes << " lanes, vector " << v;
+      }
+    }
+  }
+}
+
+TEST_F(VectorCopyTestFixture, lanes_unroll_full_groups) {
+  size_t num_lanes {64};
+  size_t groups {0};
+  for_each_vector_group(5, num_lanes, num_lanes * VECTOR_COPY_UNROLL * 3,
+                        [&](size_t first, size_t, int n) {
+    ASSERT_EQ(n, VECTOR_COPY_UNROLL);
+    ASSERT_EQ(first, 5 + groups * num_lanes * VECTOR_COPY_UNROLL);
+    groups++;
+  });
+  ASSERT_EQ(groups, 3);
+}
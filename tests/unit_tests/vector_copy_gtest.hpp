@@ -0,0 +1,72 @@
+/******************************************************************************
+ * Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+
+#ifndef ROCSHMEM_VECTOR_COPY_GTEST_HPP
+#define ROCSHMEM_VECTOR_COPY_GTEST_HPP
+
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <vector>
+
+#include "../src/memory/vector_copy.hpp"
+
+namespace rocshmem {
+
+class VectorCopyTestFixture : public ::testing::Test
+{
+  protected:
+    /**
+     * @brief Address at the given offset from a 16-byte boundary
+     */
+    const void* addr(uintptr_t offset) {
+        return reinterpret_cast<const void*>(0x10000 + offset);
+    }
+
+    /**
+     * @brief Counts the visits of every vector by num_lanes lanes
+     */
+    std::vector<int> visits(size_t num_lanes, size_t num_vectors) {
+        std::vector<int> count(num_vectors, 0);
+        for (size_t lane {0}; lane < num_lanes; lane++) {
+            for_each_vector_group(lane, num_lanes, num_vectors,
+                                  [&](size_t first, size_t stride, int n) {
+                EXPECT_GE(n, 1);
+                EXPECT_LE(n, VECTOR_COPY_UNROLL);
+                EXPECT_EQ(stride, num_lanes);
+                for (int k {0}; k < n; k++) {
+                    size_t v {first + k * stride};
+                    EXPECT_LT(v, num_vectors);
+                    EXPECT_EQ(v % num_lanes, lane);
+                    if (v < num_vectors) {
+                        count[v]++;
+                    }
+                }
+            });
+        }
+        return count;
+    }
+};
+
+} // namespace rocshmem
+
+#endif // ROCSHMEM_VECTOR_COPY_GTEST_HPP
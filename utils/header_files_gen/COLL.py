@@ -45,6 +45,9 @@ def alltoall_api(T, TNAME):
     return (
         f"__device__ ATTR_NO_INLINE void rocshmem_ctx_{TNAME}_wg_alltoall(\n"
         f"    rocshmem_ctx_t ctx, rocshmem_team_t team, {T} *dest,\n"
+        f"    const {T} *source, int nelems);\n"
+        f"__host__ void rocshmem_ctx_{TNAME}_alltoall(\n"
+        f"    rocshmem_ctx_t ctx, rocshmem_team_t team, {T} *dest,\n"
         f"    const {T} *source, int nelems);\n\n"
     )
 
@@ -73,6 +76,45 @@ def generate_alltoall_api():
     return expanded_code
 
 
+def alltoallv_api(T, TNAME):
+    return (
+        f"__host__ void rocshmem_ctx_{TNAME}_alltoallv(\n"
+        f"    rocshmem_ctx_t ctx, rocshmem_team_t team, {T} *dest,\n"
+        f"    const int *dest_counts, const int *dest_displs, const {T} *source,\n"
+        f"    const int *source_counts, const int *source_displs);\n\n"
+    )
+
+
+def generate_alltoallv_api():
+    expanded_code = """
+/**
+ * @name SHMEM_ALLTOALLV
+ * @brief Exchanges a variable amount of contiguous data between all pairs
+ * of PEs participating in the collective routine. The caller is blocked
+ * until the exchange completes.
+ *
+ * Counts and displacements are in elements and are indexed by the PE number
+ * in the team. The counts must match pairwise: source_counts[j] on PE i
+ * equals dest_counts[i] on PE j.
+ *
+ * @param[in] team          The team participating in the collective.
+ * @param[in] dest          Destination address. Must be an address on the
+ *                          symmetric heap.
+ * @param[in] dest_counts   Number of elements received from each PE.
+ * @param[in] dest_displs   Offset in dest of the data received from each PE.
+ * @param[in] source        Source address. Must be an address on the
+ *                          symmetric heap.
+ * @param[in] source_counts Number of elements sent to each PE.
+ * @param[in] source_displs Offset in source of the data sent to each PE.
+ *
+ * @return void
+ */\n"""
+    for type_, tname_ in types:
+        expanded_code += alltoallv_api(type_, tname_)
+
+    return expanded_code
+
+
 def broadcast_api(T, TNAME):
     return (
         f"__device__ ATTR_NO_INLINE void rocshmem_ctx_{TNAME}_wg_broadcast(\n"
@@ -84,7 +126,11 @@ def broadcast_api(T, TNAME):
         f"    int pe_size, long *p_sync);\n"
         f"__host__ void rocshmem_ctx_{TNAME}_broadcast(\n"
         f"    rocshmem_ctx_t ctx, rocshmem_team_t team, {T} *dest,\n"
-        f"    const {T} *source, int nelems, int pe_root);\n\n"
+        f"    const {T} *source, int nelems, int pe_root);\n"
+        f"__host__ void rocshmem_ctx_{TNAME}_broadcast_nbi(\n"
+        f"    rocshmem_ctx_t ctx, rocshmem_team_t team, {T} *dest,\n"
+        f"    const {T} *source, int nelems, int pe_root,\n"
+        f"    rocshmem_request_t *request);\n\n"
     )
 
 
@@ -109,6 +155,9 @@ def generate_broadcast_api():
  * @param[in] PE_size      Number PEs participating in the reduction.
  * @param[in] pSync        Temporary sync buffer provided to ROCSHMEM. Must
                            be of size at least ROCSHMEM_REDUCE_SYNC_SIZE.
+ * @param[out] request     Handle of a host *_nbi broadcast. The caller
+                           returns immediately and completes the broadcast
+                           with rocshmem_test or rocshmem_wait.
  *
  * @return void
  */\n"""
@@ -122,6 +171,9 @@ def fcollect_api(T, TNAME):
     return (
         f"__device__ ATTR_NO_INLINE void rocshmem_ctx_{TNAME}_wg_fcollect(\n"
         f"    rocshmem_ctx_t ctx, rocshmem_team_t team, {T} *dest,\n"
+        f"    const {T} *source, int nelems);\n"
+        f"__host__ void rocshmem_ctx_{TNAME}_fcollect(\n"
+        f"    rocshmem_ctx_t ctx, rocshmem_team_t team, {T} *dest,\n"
         f"    const {T} *source, int nelems);\n\n"
     )
 
@@ -157,7 +209,10 @@ def reduction_api(T, TNAME, Op_API):
         f"    int nreduce);\n"
         f"__host__ int rocshmem_ctx_{TNAME}_{Op_API}_reduce(\n"
         f"    rocshmem_ctx_t ctx, rocshmem_team_t team, {T} *dest, const {T} *source,\n"
-        f"    int nreduce);\n\n"
+        f"    int nreduce);\n"
+        f"__host__ int rocshmem_ctx_{TNAME}_{Op_API}_reduce_nbi(\n"
+        f"    rocshmem_ctx_t ctx, rocshmem_team_t team, {T} *dest, const {T} *source,\n"
+        f"    int nreduce, rocshmem_request_t *request);\n\n"
     )
 
 
@@ -185,6 +240,9 @@ def generate_reduction_api():
  * @param[in] source       Source address. Must be an address on the symmetric
                            heap.
  * @param[in] nreduce      Size of the buffer to participate in the reduction.
+ * @param[out] request     Handle of a host *_nbi reduction. The caller
+                           returns immediately and completes the reduction
+                           with rocshmem_test or rocshmem_wait.
  *
  * @return int (Zero on successful local completion. Nonzero otherwise.)
  */\n"""
@@ -228,6 +286,7 @@ namespace rocshmem {
 
     expanded_code += (
         generate_alltoall_api() +
+        generate_alltoallv_api() +
         generate_broadcast_api() +
         generate_fcollect_api() +
         generate_reduction_api()
@@ -298,6 +298,103 @@ def generate_get_nbi_api():
     return expanded_code
 
 
+def iput_api(T, TNAME):
+    return (
+        f"__device__ ATTR_NO_INLINE void rocshmem_ctx_{TNAME}_iput(\n"
+        f"    rocshmem_ctx_t ctx, {T} *dest, const {T} *source,\n"
+        f"    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);\n"
+        f"__device__ ATTR_NO_INLINE void rocshmem_{TNAME}_iput(\n"
+        f"    {T} *dest, const {T} *source, ptrdiff_t dst, ptrdiff_t sst,\n"
+        f"    size_t nelems, int pe);\n"
+        f"__host__ void rocshmem_ctx_{TNAME}_iput(\n"
+        f"    rocshmem_ctx_t ctx, {T} *dest, const {T} *source,\n"
+        f"    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);\n"
+        f"__host__ void rocshmem_{TNAME}_iput({T} *dest,\n"
+        f"    const {T} *source, ptrdiff_t dst, ptrdiff_t sst,\n"
+        f"    size_t nelems, int pe);\n\n"
+    )
+
+
+def generate_iput_api():
+    expanded_code = """
+/**
+ * @name SHMEM_IPUT
+ * @brief Writes \p nelems elements from \p source on the calling PE, read
+ * with a stride of \p sst elements, to \p dest at \p pe, written with a
+ * stride of \p dst elements. The caller will block until the operation
+ * completes locally (it is safe to reuse \p source). The caller must
+ * call into rocshmem_quiet() if remote completion is required.
+ *
+ * This function can be called from divergent control paths at per-thread
+ * granularity.
+ *
+ * @param[in] ctx    Context with which to perform this operation.
+ * @param[in] dest   Destination address. Must be an address on the symmetric
+ *                   heap.
+ * @param[in] source Source address. Must be an address on the symmetric heap.
+ * @param[in] dst    Stride between consecutive elements of \p dest, in
+ *                   elements.
+ * @param[in] sst    Stride between consecutive elements of \p source, in
+ *                   elements.
+ * @param[in] nelems Number of elements to transfer.
+ * @param[in] pe     PE of the remote process.
+ *
+ * @return void.
+ */\n"""
+    for type_, tname_ in types:
+        expanded_code += iput_api(type_, tname_)
+
+    return expanded_code
+
+
+def iget_api(T, TNAME):
+    return (
+        f"__device__ ATTR_NO_INLINE void rocshmem_ctx_{TNAME}_iget(\n"
+        f"    rocshmem_ctx_t ctx, {T} *dest, const {T} *source,\n"
+        f"    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);\n"
+        f"__device__ ATTR_NO_INLINE void rocshmem_{TNAME}_iget(\n"
+        f"    {T} *dest, const {T} *source, ptrdiff_t dst, ptrdiff_t sst,\n"
+        f"    size_t nelems, int pe);\n"
+        f"__host__ void rocshmem_ctx_{TNAME}_iget(\n"
+        f"    rocshmem_ctx_t ctx, {T} *dest, const {T} *source,\n"
+        f"    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);\n"
+        f"__host__ void rocshmem_{TNAME}_iget({T} *dest,\n"
+        f"    const {T} *source, ptrdiff_t dst, ptrdiff_t sst,\n"
+        f"    size_t nelems, int pe);\n\n"
+    )
+
+
+def generate_iget_api():
+    expanded_code = """
+/**
+ * @name SHMEM_IGET
+ * @brief Reads \p nelems elements from \p source on \p pe, read with a
+ * stride of \p sst elements, into \p dest on the calling PE, written with
+ * a stride of \p dst elements. The caller will block until the operation
+ * completes (it is safe to read \p dest).
+ *
+ * This function can be called from divergent control paths at per-thread
+ * granularity.
+ *
+ * @param[in] ctx    Context with which to perform this operation.
+ * @param[in] dest   Destination address. Must be an address on the symmetric
+ *                   heap.
+ * @param[in] source Source address. Must be an address on the symmetric heap.
+ * @param[in] dst    Stride between consecutive elements of \p dest, in
+ *                   elements.
+ * @param[in] sst    Stride between consecutive elements of \p source, in
+ *                   elements.
+ * @param[in] nelems Number of elements to transfer.
+ * @param[in] pe     PE of the remote process.
+ *
+ * @return void.
+ */\n"""
+    for type_, tname_ in types:
+        expanded_code += iget_api(type_, tname_)
+
+    return expanded_code
+
+
 def write_to_file(filename, content):
     with open(filename, 'w') as file:
         file.write(content)
@@ -319,7 +416,9 @@ namespace rocshmem {
         generate_get_api() +
         generate_g_api() +
         generate_put_nbi_api() +
-        generate_get_nbi_api()
+        generate_get_nbi_api() +
+        generate_iput_api() +
+        generate_iget_api()
     )
 
     expanded_code += """
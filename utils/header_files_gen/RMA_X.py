@@ -283,6 +283,91 @@ def generate_get_nbi_api_x():
     return expanded_code
 
 
+def iput_api_x(GRAN, T, TNAME):
+    return (
+        f"__device__ ATTR_NO_INLINE void rocshmem_ctx_{TNAME}_iput_{GRAN}(\n"
+        f"    rocshmem_ctx_t ctx, {T} *dest, const {T} *source,\n"
+        f"    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);\n"
+        f"__device__ ATTR_NO_INLINE void rocshmem_{TNAME}_iput_{GRAN}(\n"
+        f"    {T} *dest, const {T} *source, ptrdiff_t dst, ptrdiff_t sst,\n"
+        f"    size_t nelems, int pe);\n\n"
+    )
+
+
+def generate_iput_api_x():
+    expanded_code = """
+/**
+ * @brief Writes \p nelems elements from \p source on the calling PE, read
+ * with a stride of \p sst elements, to \p dest at \p pe, written with a
+ * stride of \p dst elements. The elements are spread across the lanes of
+ * the wave. The caller will block until the operation completes locally (it
+ * is safe to reuse \p source).
+ *
+ * This function can be called from divergent control paths at per-wave
+ * granularity. However, all threads in a wave must collectively participate
+ * in the call using the same arguments
+ *
+ * @param[in] ctx    Context with which to perform this operation.
+ * @param[in] dest   Destination address. Must be an address on the symmetric
+ *                   heap.
+ * @param[in] source Source address. Must be an address on the symmetric heap.
+ * @param[in] dst    Stride between consecutive elements of \p dest, in
+ *                   elements.
+ * @param[in] sst    Stride between consecutive elements of \p source, in
+ *                   elements.
+ * @param[in] nelems Number of elements to transfer.
+ * @param[in] pe     PE of the remote process.
+ *
+ * @return void.
+ */\n"""
+    for type_, tname_ in types:
+        expanded_code += iput_api_x("wave", type_, tname_)
+
+    return expanded_code
+
+
+def iget_api_x(GRAN, T, TNAME):
+    return (
+        f"__device__ ATTR_NO_INLINE void rocshmem_ctx_{TNAME}_iget_{GRAN}(\n"
+        f"    rocshmem_ctx_t ctx, {T} *dest, const {T} *source,\n"
+        f"    ptrdiff_t dst, ptrdiff_t sst, size_t nelems, int pe);\n"
+        f"__device__ ATTR_NO_INLINE void rocshmem_{TNAME}_iget_{GRAN}(\n"
+        f"    {T} *dest, const {T} *source, ptrdiff_t dst, ptrdiff_t sst,\n"
+        f"    size_t nelems, int pe);\n\n"
+    )
+
+
+def generate_iget_api_x():
+    expanded_code = """
+/**
+ * @brief Reads \p nelems elements from \p source on \p pe, read with a
+ * stride of \p sst elements, into \p dest on the calling PE, written with
+ * a stride of \p dst elements. The elements are spread across the lanes of
+ * the wave. The caller will block until the operation completes.
+ *
+ * This function can be called from divergent control paths at per-wave
+ * granularity. However, all threads in a wave must collectively participate
+ * in the call using the same arguments
+ *
+ * @param[in] ctx    Context with which to perform this operation.
+ * @param[in] dest   Destination address. Must be an address on the symmetric
+ *                   heap.
+ * @param[in] source Source address. Must be an address on the symmetric heap.
+ * @param[in] dst    Stride between consecutive elements of \p dest, in
+ *                   elements.
+ * @param[in] sst    Stride between consecutive elements of \p source, in
+ *                   elements.
+ * @param[in] nelems Number of elements to transfer.
+ * @param[in] pe     PE of the remote process.
+ *
+ * @return void.
+ */\n"""
+    for type_, tname_ in types:
+        expanded_code += iget_api_x("wave", type_, tname_)
+
+    return expanded_code
+
+
 def write_to_file(filename, content):
     with open(filename, 'w') as file:
         file.write(content)
@@ -302,7 +387,9 @@ namespace rocshmem {
         generate_put_api_x() +
         generate_get_api_x() +
         generate_put_nbi_api_x() +
-        generate_get_nbi_api_x()
+        generate_get_nbi_api_x() +
+        generate_iput_api_x() +
+        generate_iget_api_x()
     )
 
     expanded_code += """